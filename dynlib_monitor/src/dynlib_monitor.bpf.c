@@ -2,316 +2,3670 @@
 #include <bpf/bpf_helpers.h>
 #include <bpf/bpf_tracing.h>
 #include <bpf/bpf_core_read.h>
+#include <bpf/usdt.bpf.h>
+#include "dynlib_monitor.h"
 
 // 指定GPL许可证，eBPF程序必需
 char LICENSE[] SEC("license") = "GPL";
 
 /**
- * @brief 事件数据结构
- * 用于在内核和用户空间之间传递动态链接相关的事件信息
+ * @brief glibc公开的struct link_map头部字段（见<link.h>）
+ * dlopen返回的句柄就是指向该结构的指针，位于被监控进程的用户空间
  */
-struct event {
-    __u64 timestamp;      ///< 事件发生的时间戳（纳秒）
-    __u32 pid;           ///< 进程ID
-    __u32 uid;           ///< 用户ID
-    char comm[16];       ///< 进程名
-    char lib_path[64];   ///< 动态库路径
-    __u64 lib_addr;      ///< 动态库加载地址或句柄
-    char symbol_name[32]; ///< 符号名称
-    in event_type;      ///< 事件类型（1:加载, 2:卸载, 3:符号解析）
-    int flags;           ///< dlopen的标志
-    __u64 symbol_addr;   ///< 符号地址
-    int result;          ///< 操作结果
+struct user_link_map {
+    __u64 l_addr;   ///< 加载基址，即库中地址相对ELF文件中地址的偏移
+    __u64 l_name;   ///< 库的绝对路径字符串指针
+    __u64 l_ld;     ///< 动态段地址
+    __u64 l_next;   ///< 链表中的下一个已加载对象
+    __u64 l_prev;   ///< 链表中的上一个已加载对象
 };
 
 /**
- * @brief 句柄到库路径的映射
- * 用于跟踪已加载库的句柄和对应的路径
+ * @brief 句柄到库信息的映射
+ * 用于跟踪已加载库的句柄和对应的路径编号。使用LRU哈希表，
+ * 容量由用户空间在加载前按--max-handles设置，表满时淘汰最久未用的项，
+ * 进程退出时清理其全部表项
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_LRU_HASH);
+    __uint(max_entries, 65536);
+    __type(key, struct handle_key);
+    __type(value, struct handle_info);
+} handle_to_path SEC(".maps");
+
+/**
+ * @brief link_map到对象信息的缓存
+ * 以（进程, link_map）为键，供符号查找、延迟绑定等按对象统计时取得路径编号，
+ * 依赖库等非dlopen对象也记录在此。进程退出后的残留项由LRU淘汰，
+ * 使用前核对基址和l_name指针，避免进程ID和地址复用后误用
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_LRU_HASH);
+    __uint(max_entries, 65536);
+    __type(key, struct handle_key);
+    __type(value, struct object_info);
+} object_paths SEC(".maps");
+
+/**
+ * @brief 各进程在handle_to_path中的表项数
+ * 进程退出时只有计数非0才需要遍历句柄映射，其余进程退出时不遍历。
+ * 使用普通哈希表，计数不会被淘汰，否则该进程的句柄映射在退出时不会被清理；
+ * 计数因handle_to_path的LRU淘汰可能偏大，只会导致多遍历一次。
+ * 表满时新进程无法登记，其句柄映射只能依靠LRU淘汰
  */
 struct {
     __uint(type, BPF_MAP_TYPE_HASH);
-    __uint(max_entries, 1024);
+    __uint(max_entries, 65536);
+    __type(key, __u32);
+    __type(value, __u32);
+} handle_counts SEC(".maps");
+
+/**
+ * @brief 库路径字符串表
+ * 以路径内容的哈希值为编号，每个不同的路径只保存一份；
+ * 事件中只携带编号，用户空间按需查询并缓存；
+ * 用户空间每个输出周期将已登记的路径转入自己的缓存后删除，因此无需LRU淘汰
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 8192);
+    __uint(map_flags, BPF_F_NO_PREALLOC);
     __type(key, __u64);
-    __type(value, char[64]);
-} handle_to_path SEC(".maps");
+    __type(value, char[MAX_PATH_LEN]);
+} lib_paths SEC(".maps");
+
+#define EVENT_BUF_SIZE (sizeof(struct event) + MAX_PATH_LEN + MAX_SYMBOL_LEN)
+
+/**
+ * @brief 变长事件的构造缓冲区
+ * 携带字符串的事件先在这里按实际长度拼装，再整体输出到环形缓冲区
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_PERCPU_ARRAY);
+    __uint(max_entries, 1);
+    __type(key, __u32);
+    __type(value, char[EVENT_BUF_SIZE]);
+} event_buf SEC(".maps");
+
+/**
+ * @brief 事件输出环形缓冲区
+ * 所有CPU共享的BPF环形缓冲区，定长事件直接在缓冲区内构造，
+ * 用户空间通过mmap原地读取，避免perf buffer的栈上构造和额外拷贝
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_RINGBUF);
+    __uint(max_entries, 1024 * 1024);
+} events SEC(".maps");
+
+/**
+ * @brief 丢弃事件计数
+ * 环形缓冲区空间不足导致预留失败时累加，供用户空间统计丢失率
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_PERCPU_ARRAY);
+    __uint(max_entries, 1);
+    __type(key, __u32);
+    __type(value, __u64);
+} dropped_events SEC(".maps");
+
+/**
+ * @brief dlopen调用入口状态
+ * 在dlopen的enter和return之间传递参数，按线程保存
+ */
+struct dlopen_args {
+    __u64 start_ts;   ///< 进入dlopen的时间戳（纳秒）
+    __u64 filename;   ///< 请求加载的库路径（用户空间指针，返回时仍然有效）
+    __u64 caller_addr; ///< glibc内部调用时调用方的返回地址
+    __s64 lmid;       ///< 加载到的命名空间，map_start探针触发时更新为实际编号
+    int flags;        ///< dlopen的标志
+    int stack_id;     ///< 调用点的用户栈编号（--stacks），负数表示未取到
+    __u32 search_base; ///< 进入时线程已累计的失败打开尝试数，嵌套调用据此计算自身的部分
+    __u32 pad;
+};
+
+#define MAX_DL_DEPTH 4   ///< dl*调用记录入口状态的最大嵌套层数，须为2的幂
+
+/**
+ * @brief 线程中进行中的dlopen调用栈
+ *
+ * 构造函数或NSS等glibc内部加载会在dlopen中再次进入dlopen，按层保存
+ * 入口状态，内层调用不覆盖外层。超过MAX_DL_DEPTH的层只计数不记录
+ */
+struct dlopen_stack {
+    __u32 depth;                                    ///< 当前嵌套层数
+    __u32 pad;
+    struct dlopen_args frames[MAX_DL_DEPTH];    ///< 各层的入口状态
+};
+
+/**
+ * @brief 进行中的dlopen调用
+ * 以线程ID为键，使不同线程/进程的并发dlopen互不覆盖；
+ * 表项存在即线程处于dlopen中，最外层返回时删除
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct dlopen_stack);
+} dlopen_args SEC(".maps");
+
+/**
+ * @brief 取得线程最内层dlopen的入口状态，未记录时返回NULL
+ */
+static __always_inline struct dlopen_args *current_dlopen(__u32 tid)
+{
+    struct dlopen_stack *stack = bpf_map_lookup_elem(&dlopen_args, &tid);
+    if (!stack || stack->depth == 0 || stack->depth > MAX_DL_DEPTH)
+        return NULL;
+    return &stack->frames[(stack->depth - 1) & (MAX_DL_DEPTH - 1)];
+}
+
+/**
+ * @brief dlsym调用入口状态
+ */
+struct dlsym_args {
+    __u64 start_ts;   ///< 进入dlsym的时间戳（纳秒）
+    __u64 handle;     ///< 查找的库句柄
+    __u64 symbol;     ///< 请求的符号名（用户空间指针）
+    __u64 version;    ///< dlvsym请求的符号版本（用户空间指针），dlsym为0
+    __u64 caller_addr; ///< glibc内部调用时调用方的返回地址
+    int stack_id;     ///< 调用点的用户栈编号（--stacks），负数表示未取到
+};
+
+/**
+ * @brief 线程中进行中的dlsym调用栈
+ *
+ * IFUNC解析函数或构造函数中的dlsym会在dlsym中再次进入，按层保存入口状态
+ */
+struct dlsym_stack {
+    __u32 depth;                                ///< 当前嵌套层数
+    __u32 pad;
+    struct dlsym_args frames[MAX_DL_DEPTH];     ///< 各层的入口状态
+};
+
+/**
+ * @brief 进行中的dlsym调用，以线程ID为键，最外层返回时删除
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct dlsym_stack);
+} dlsym_args SEC(".maps");
+
+/**
+ * @brief 是否记录dlopen/dlsym调用点的用户栈（--stacks）
+ */
+const volatile bool stack_capture = false;
+
+/**
+ * @brief 用户栈，相同的栈只存一份，统计项和事件中只携带栈编号
+ * 表项不会自动删除，用户空间回收连续几个输出周期未被引用的栈；
+ * 编号冲突时以BPF_F_REUSE_STACKID用新栈覆盖旧栈，避免表项耗尽后取不到栈
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_STACK_TRACE);
+    __uint(max_entries, 16384);
+    __uint(key_size, sizeof(__u32));
+    __uint(value_size, MAX_STACK_DEPTH * sizeof(__u64));
+} user_stacks SEC(".maps");
+
+/**
+ * @brief 按（进程, 操作, 栈）统计的调用点，stream和聚合模式下都统计
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct callsite_key);
+    __type(value, struct callsite_value);
+} callsite_stats SEC(".maps");
+
+/**
+ * @brief 取得调用点的用户栈编号，未开启时为-1
+ */
+static __always_inline int capture_user_stack(void *ctx)
+{
+    if (!stack_capture)
+        return -1;
+    return bpf_get_stackid(ctx, &user_stacks, BPF_F_USER_STACK | BPF_F_REUSE_STACKID);
+}
+
+/**
+ * @brief 把一次调用计入调用点统计
+ */
+static __always_inline void record_callsite(__u32 op, int stack_id, __u64 duration_ns)
+{
+    if (!stack_capture || stack_id < 0)
+        return;
+
+    struct callsite_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    key.op = op;
+    key.stack_id = stack_id;
+    struct callsite_value *val = bpf_map_lookup_elem(&callsite_stats, &key);
+    if (!val) {
+        struct callsite_value zero = {};
+        bpf_map_update_elem(&callsite_stats, &key, &zero, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&callsite_stats, &key);
+        if (!val)
+            return;
+    }
+    __sync_fetch_and_add(&val->calls, 1);
+    __sync_fetch_and_add(&val->total_ns, duration_ns);
+}
+
+/**
+ * @brief dlclose调用入口状态
+ */
+struct dlclose_args {
+    __u64 start_ts;   ///< 进入dlclose的时间戳（纳秒）
+    __u64 handle;     ///< 要卸载的库句柄
+    __u64 path_id;    ///< 库路径编号（入口处句柄映射即被清理，需提前保存）
+    __u64 base_addr;  ///< 库的加载基址
+    __s64 lmid;       ///< 库所在的命名空间
+};
+
+/**
+ * @brief 线程中进行中的dlclose调用栈
+ *
+ * 析构函数中的dlclose会在dlclose中再次进入，按层保存入口状态
+ */
+struct dlclose_stack {
+    __u32 depth;                                ///< 当前嵌套层数
+    __u32 pad;
+    struct dlclose_args frames[MAX_DL_DEPTH];   ///< 各层的入口状态
+};
+
+/**
+ * @brief 进行中的dlclose调用，以线程ID为键；表项存在即线程处于dlclose中，
+ * 最外层返回时删除
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct dlclose_stack);
+} dlclose_args SEC(".maps");
+
+/**
+ * @brief 是否启用聚合模式
+ * 聚合模式下不再逐次输出事件，而是在内核中按（进程, 库, 符号）累计统计
+ */
+const volatile bool aggregate_mode = false;
+
+/**
+ * @brief 聚合统计
+ * 由用户空间周期性地批量读取并清空
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct agg_key);
+    __type(value, struct agg_value);
+} agg_stats SEC(".maps");
+
+/**
+ * @brief 进程汇总统计，进程退出时输出并清除
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, __u32);
+    __type(value, struct proc_stats);
+} proc_stats SEC(".maps");
+
+/**
+ * @brief 符号名字符串表
+ * 与lib_paths类似，以符号名的哈希值为编号，聚合统计中只保存编号
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __uint(map_flags, BPF_F_NO_PREALLOC);
+    __type(key, __u64);
+    __type(value, char[MAX_SYMBOL_LEN]);
+} symbol_names SEC(".maps");
+
+/**
+ * @brief 是否启用目标进程过滤
+ * 由用户空间在加载前设置；为false时监控除监控程序自身外的所有进程
+ */
+const volatile bool filter_targets = false;
+
+/**
+ * @brief 监控程序自身的进程ID，用于避免自我监控
+ */
+const volatile __u32 monitor_tgid = 0;
+
+/**
+ * @brief 监控程序所在PID命名空间的设备号和inode号
+ * 监控程序运行在容器等非初始PID命名空间时由用户空间设置，为0表示位于初始命名空间；
+ * 此时monitor_tgid和用户指定的进程ID都是该命名空间中的编号
+ */
+const volatile __u64 pidns_dev = 0;
+const volatile __u64 pidns_ino = 0;
+
+/**
+ * @brief 目标进程集合
+ * 以进程ID（TGID）为键，包含用户指定的进程、进程名匹配的进程及其所有子进程
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, __u32);
+    __type(value, __u8);
+} target_tgids SEC(".maps");
+
+/**
+ * @brief 以监控程序命名空间中的进程ID表示的目标进程
+ * 仅在监控程序位于非初始PID命名空间时使用，进程首次命中后转存到target_tgids
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 1024);
+    __type(key, __u32);
+    __type(value, __u8);
+} target_ns_tgids SEC(".maps");
+
+/**
+ * @brief 目标进程名集合
+ * 进程执行exec后若进程名在此集合中，则将其加入目标进程集合
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 64);
+    __type(key, char[16]);
+    __type(value, __u8);
+} target_comms SEC(".maps");
+
+/**
+ * @brief 检查当前进程是否是目标进程
+ * 
+ * 未启用过滤时只排除监控程序自己；启用过滤时只需在目标进程集合中
+ * 查找一次当前TGID，进程名匹配和子进程继承都已在进程生命周期事件中处理
+ * 
+ * @return true 如果当前进程需要被监控
+ * @return false 如果当前进程不需要被监控
+ */
+static __always_inline bool is_target_process(void)
+{
+    __u32 tgid = bpf_get_current_pid_tgid() >> 32;
+    struct bpf_pidns_info ns = {};
+
+    if (!pidns_ino) {
+        if (!filter_targets)
+            return tgid != monitor_tgid;
+        return bpf_map_lookup_elem(&target_tgids, &tgid) != NULL;
+    }
+
+    // 不在监控程序命名空间中的任务，其进程ID不可能与用户指定的编号对应
+    if (!filter_targets)
+        return bpf_get_ns_current_pid_tgid(pidns_dev, pidns_ino, &ns, sizeof(ns)) ||
+               ns.tgid != monitor_tgid;
+    if (bpf_map_lookup_elem(&target_tgids, &tgid))
+        return true;
+    if (bpf_get_ns_current_pid_tgid(pidns_dev, pidns_ino, &ns, sizeof(ns)) ||
+        !bpf_map_lookup_elem(&target_ns_tgids, &ns.tgid))
+        return false;
+
+    // 之后的fork、exec和退出处理都使用初始命名空间中的TGID
+    __u8 one = 1;
+    bpf_map_update_elem(&target_tgids, &tgid, &one, BPF_ANY);
+    return true;
+}
+
+/**
+ * @brief 累加丢弃事件计数
+ */
+static __always_inline void count_dropped_event(void)
+{
+    __u32 key = 0;
+    __u64 *cnt = bpf_map_lookup_elem(&dropped_events, &key);
+    if (cnt)
+        (*cnt)++;
+}
+
+/**
+ * @brief 填充事件头部的公共字段
+ */
+static __always_inline void fill_event_header(struct event *e, int event_type)
+{
+    __u64 pid_tgid = bpf_get_current_pid_tgid();
+
+    e->timestamp = bpf_ktime_get_ns();
+    e->pid = pid_tgid >> 32;
+    e->tid = (__u32)pid_tgid;
+    e->uid = bpf_get_current_uid_gid() & 0xFFFFFFFF;
+    bpf_get_current_comm(&e->comm, sizeof(e->comm));
+    e->event_type = event_type;
+}
+
+/**
+ * @brief 在环形缓冲区中预留一个不带字符串的定长事件并填充基本信息
+ *
+ * 预留失败（缓冲区已满）时累加丢弃计数并返回NULL，
+ * 调用者填充完剩余字段后需调用bpf_ringbuf_submit提交
+ *
+ * @param event_type 事件类型
+ * @return 预留的事件指针，失败时返回NULL
+ */
+static __always_inline struct event *reserve_event(int event_type)
+{
+    struct event *e = bpf_ringbuf_reserve(&events, sizeof(*e), 0);
+    if (!e) {
+        count_dropped_event();
+        return NULL;
+    }
+
+    // 预留的内存未初始化，先清零以免向用户空间泄露残留数据
+    __builtin_memset(e, 0, sizeof(*e));
+    fill_event_header(e, event_type);
+    return e;
+}
+
+/**
+ * @brief 取得本CPU的变长事件构造缓冲区并填充基本信息
+ *
+ * 字符串通过append_path/append_symbol追加，最后调用output_event输出
+ */
+static __always_inline struct event *init_var_event(int event_type)
+{
+    __u32 key = 0;
+    struct event *e = bpf_map_lookup_elem(&event_buf, &key);
+    if (!e)
+        return NULL;
+
+    __builtin_memset(e, 0, sizeof(*e));
+    fill_event_header(e, event_type);
+    return e;
+}
+
+/**
+ * @brief 将用户空间的库路径按实际长度拷贝到事件的字符串区
+ */
+static __always_inline void append_path(struct event *e, const void *path)
+{
+    long len = bpf_probe_read_user_str(e->data, MAX_PATH_LEN, path);
+    e->path_len = len > 0 ? len : 0;
+}
+
+/**
+ * @brief 将用户空间的符号名按实际长度拷贝到库路径之后
+ */
+static __always_inline void append_symbol(struct event *e, const void *symbol)
+{
+    __u32 off = e->path_len;
+    if (off > MAX_PATH_LEN)
+        return;
+
+    long len = bpf_probe_read_user_str(e->data + off, MAX_SYMBOL_LEN, symbol);
+    e->symbol_len = len > 0 ? len : 0;
+}
+
+/**
+ * @brief 按实际长度将变长事件输出到环形缓冲区
+ *
+ * 字符串长度要读取用户内存后才知道，而bpf_ringbuf_reserve的大小须在预留时确定，
+ * 原地构造只能按上限（约5KB）预留，大多数事件的路径只有几十字节，环形缓冲区
+ * 能容纳的事件会减少两个数量级以上，突发时丢失更多事件。因此先在本CPU的缓冲区
+ * 中构造，再以bpf_ringbuf_output按实际长度拷贝一次；定长事件仍用reserve_event原地构造
+ */
+static __always_inline void output_event(struct event *e)
+{
+    __u32 path_len = e->path_len;
+    __u32 symbol_len = e->symbol_len;
+    if (path_len > MAX_PATH_LEN)
+        path_len = MAX_PATH_LEN;
+    if (symbol_len > MAX_SYMBOL_LEN)
+        symbol_len = MAX_SYMBOL_LEN;
+
+    if (bpf_ringbuf_output(&events, e, sizeof(*e) + path_len + symbol_len, 0))
+        count_dropped_event();
+}
+
+/**
+ * @brief 计算字符串的FNV-1a哈希值，作为库路径或符号名的编号
+ *
+ * 假定不同字符串的64位哈希值不冲突，不做比较；冲突时字符串表以BPF_NOEXIST
+ * 保留先登记的字符串，用户空间转存时比较内容并报告冲突次数
+ *
+ * @param s 内核可访问的字符串缓冲区
+ * @param len 字符串长度
+ */
+static __always_inline __u64 hash_string(const char *s, __u32 len)
+{
+    __u64 hash = 14695981039346656037ULL;
+
+    for (__u32 i = 0; i < MAX_PATH_LEN; i++) {
+        if (i >= len)
+            break;
+        hash ^= (unsigned char)s[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash ? hash : 1;
+}
+
+/**
+ * @brief 计算整数以2为底的对数（向下取整）
+ */
+static __always_inline __u32 log2_u32(__u32 v)
+{
+    __u32 r, shift;
+
+    r = (v > 0xFFFF) << 4; v >>= r;
+    shift = (v > 0xFF) << 3; v >>= shift; r |= shift;
+    shift = (v > 0xF) << 2; v >>= shift; r |= shift;
+    shift = (v > 0x3) << 1; v >>= shift; r |= shift;
+    r |= (v >> 1);
+    return r;
+}
+
+static __always_inline __u32 log2_u64(__u64 v)
+{
+    __u32 hi = v >> 32;
+    return hi ? log2_u32(hi) + 32 : log2_u32(v);
+}
+
+/**
+ * @brief 原子地把最大值统计更新为不小于v
+ * 多个CPU可能同时更新同一统计项，先比较再赋值会丢失其中较大的值；
+ * 比较交换失败说明他人刚更新过，重读后重试，次数有限以满足验证器
+ */
+static __always_inline void atomic_max_u64(__u64 *max, __u64 v)
+{
+    for (int i = 0; i < 4; i++) {
+        __u64 old = *(volatile __u64 *)max;
+        if (v <= old || __sync_val_compare_and_swap(max, old, v) == old)
+            return;
+    }
+}
+
+static __always_inline void atomic_max_u32(__u32 *max, __u32 v)
+{
+    for (int i = 0; i < 4; i++) {
+        __u32 old = *(volatile __u32 *)max;
+        if (v <= old || __sync_val_compare_and_swap(max, old, v) == old)
+            return;
+    }
+}
+
+/**
+ * @brief 取得进程的汇总统计，不存在时创建
+ */
+static __always_inline struct proc_stats *lookup_proc_stats(__u32 tgid)
+{
+    struct proc_stats *ps = bpf_map_lookup_elem(&proc_stats, &tgid);
+    if (ps)
+        return ps;
+
+    struct proc_stats zero = {};
+    bpf_map_update_elem(&proc_stats, &tgid, &zero, BPF_NOEXIST);
+    return bpf_map_lookup_elem(&proc_stats, &tgid);
+}
+
+/**
+ * @brief 将一次耗时计入统计值及其log2直方图
+ */
+static __always_inline void add_agg_value(struct agg_value *val, __u64 delta_ns, bool failed)
+{
+    __u32 slot = log2_u64(delta_ns);
+    if (slot >= MAX_SLOTS)
+        slot = MAX_SLOTS - 1;
+
+    __sync_fetch_and_add(&val->calls, 1);
+    if (failed)
+        __sync_fetch_and_add(&val->failures, 1);
+    __sync_fetch_and_add(&val->total_ns, delta_ns);
+    __sync_fetch_and_add(&val->slots[slot], 1);
+}
+
+/**
+ * @brief 将一次调用计入聚合统计和进程汇总
+ *
+ * @param event_type 操作类型
+ * @param path_id 库路径编号
+ * @param symbol_id 符号名编号
+ * @param delta_ns 调用耗时（纳秒）
+ * @param failed 调用是否失败
+ */
+static __always_inline void update_agg(int event_type, __u64 path_id, __u64 symbol_id,
+                                       __u64 delta_ns, bool failed)
+{
+    struct agg_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    key.event_type = event_type;
+    key.path_id = path_id;
+    key.symbol_id = symbol_id;
+
+    struct agg_value *val = bpf_map_lookup_elem(&agg_stats, &key);
+    if (!val) {
+        struct agg_value zero = {};
+        bpf_map_update_elem(&agg_stats, &key, &zero, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&agg_stats, &key);
+        if (!val)
+            return;
+    }
+
+    add_agg_value(val, delta_ns, failed);
+
+    struct proc_stats *ps = lookup_proc_stats(key.tgid);
+    if (!ps)
+        return;
+
+    if (event_type < EVENT_DLOPEN || event_type > EVENT_DLSYM)
+        return;
+    __sync_fetch_and_add(&ps->calls[event_type], 1);
+    if (failed)
+        __sync_fetch_and_add(&ps->failures[event_type], 1);
+    __sync_fetch_and_add(&ps->total_ns, delta_ns);
+}
+
+/**
+ * @brief 输出并清除进程的汇总记录
+ */
+static __always_inline void emit_proc_summary(__u32 tgid)
+{
+    struct proc_stats *ps = bpf_map_lookup_elem(&proc_stats, &tgid);
+    if (!ps)
+        return;
+
+    struct proc_summary_event *e = bpf_ringbuf_reserve(&events, sizeof(*e), 0);
+    if (e) {
+        e->event_type = EVENT_PROC_SUMMARY;
+        e->pid = tgid;
+        e->timestamp = bpf_ktime_get_ns();
+        bpf_get_current_comm(&e->comm, sizeof(e->comm));
+        __builtin_memcpy(&e->stats, ps, sizeof(e->stats));
+        bpf_ringbuf_submit(e, 0);
+    } else {
+        count_dropped_event();
+    }
+    bpf_map_delete_elem(&proc_stats, &tgid);
+}
+
+/**
+ * @brief 是否统计dl_iterate_phdr/dladdr等遍历接口的开销（--unwind-profile）
+ */
+const volatile bool unwind_profile = false;
+
+#define MAX_LOADED_OBJECTS 1024   ///< 统计已加载对象数时最多遍历的link_map数
+
+/**
+ * @brief glibc公开的struct r_debug头部字段（见<link.h>）
+ */
+struct user_r_debug {
+    int r_version;
+    __u32 pad;
+    __u64 r_map;    ///< 已加载对象link_map链表的头
+};
+
+/**
+ * @brief 各进程当前已加载的对象数
+ * 在动态链接器各阶段完成时沿r_debug->r_map链表重新计数，
+ * 遍历接口被调用时直接读取，无需每次遍历
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, __u32);
+    __type(value, __u32);
+} loaded_objects SEC(".maps");
+
+/**
+ * @brief 沿link_map链表统计当前进程已加载的对象数
+ */
+static __always_inline void count_loaded_objects(void *r_debug)
+{
+    struct user_r_debug rd = {};
+    if (!r_debug || bpf_probe_read_user(&rd, sizeof(rd), r_debug))
+        return;
+
+    __u32 count = 0;
+    __u64 map = rd.r_map;
+    for (int i = 0; i < MAX_LOADED_OBJECTS; i++) {
+        if (!map)
+            break;
+        count++;
+        if (bpf_probe_read_user(&map, sizeof(map), (void *)(map + __builtin_offsetof(struct user_link_map, l_next))))
+            break;
+    }
+
+    __u32 tgid = bpf_get_current_pid_tgid() >> 32;
+    bpf_map_update_elem(&loaded_objects, &tgid, &count, BPF_ANY);
+}
+
+/**
+ * @brief 是否测量动态链接器全局锁的争用（--lock-contention）
+ */
+const volatile bool lock_contention = false;
+
+/**
+ * @brief 各进程中动态链接器全局锁的地址，下标为enum loader_lock
+ */
+struct loader_locks {
+    __u64 addr[LOCK_MAX];
+};
+
+/**
+ * @brief 已识别的动态链接器全局锁
+ * 锁位于ld.so内部的_rtld_global中，布局随glibc版本变化，因此不按偏移计算，
+ * 而是在首次观察到争用时识别：等待方和持有方都处于动态链接操作中、
+ * 且等待的是递归互斥量时，把该互斥量记为对应的锁
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, __u32);
+    __type(value, struct loader_locks);
+} loader_locks SEC(".maps");
+
+/**
+ * @brief 是否统计dl*调用期间的off-CPU时间（--offcpu）
+ */
+const volatile bool offcpu_profile = false;
+
+/**
+ * @brief 线程当前进行的动态链接操作
+ * 构造函数中可以再次调用dlopen/dlsym，嵌套的操作只增加层数，
+ * 锁和off-CPU时间都归因到最外层的操作（持有dl_load_lock的正是它）
+ */
+struct loader_op_state {
+    __u32 op;           ///< 最外层的操作（enum loader_op）
+    __u32 depth;        ///< 嵌套层数
+    __u64 path_id;      ///< 最外层操作的库路径编号
+    __u32 vtid;         ///< 线程在其PID命名空间中的线程ID，与全局线程ID相同时为0
+    __u32 pad;
+};
+
+/**
+ * @brief 各线程当前进行的动态链接操作，以线程ID为键
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct loader_op_state);
+} loader_ops SEC(".maps");
+
+/**
+ * @brief 命名空间内线程ID的键
+ */
+struct vtid_key {
+    __u32 tgid;
+    __u32 vtid;
+};
+
+/**
+ * @brief 容器中处于动态链接操作的线程，命名空间内线程ID到全局线程ID的映射
+ * 互斥量中记录的持有者是命名空间内的线程ID，据此找到持有方的操作
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, struct vtid_key);
+    __type(value, __u32);
+} loader_op_vtids SEC(".maps");
+
+/**
+ * @brief 取得当前线程在其所属PID命名空间中的线程ID，位于初始命名空间时返回0
+ */
+static __always_inline __u32 current_vtid(void)
+{
+    struct task_struct *task = bpf_get_current_task_btf();
+    struct pid *pid = BPF_CORE_READ(task, thread_pid);
+    unsigned int level = BPF_CORE_READ(pid, level);
+    int nr = 0;
+
+    if (level == 0)
+        return 0;
+    bpf_core_read(&nr, sizeof(nr), &pid->numbers[level].nr);
+    return nr;
+}
+
+/**
+ * @brief 记录线程开始一个动态链接操作，仅在测量锁争用或off-CPU时间时使用
+ */
+static __always_inline void begin_loader_op(__u32 op, __u64 path_id)
+{
+    if (!lock_contention && !offcpu_profile)
+        return;
+
+    __u64 pid_tgid = bpf_get_current_pid_tgid();
+    __u32 tid = (__u32)pid_tgid;
+    struct loader_op_state *outer = bpf_map_lookup_elem(&loader_ops, &tid);
+    if (outer) {
+        outer->depth++;
+        return;
+    }
+
+    struct loader_op_state state = {};
+    state.op = op;
+    state.depth = 1;
+    state.path_id = path_id;
+    if (lock_contention) {
+        state.vtid = current_vtid();
+        if (state.vtid) {
+            struct vtid_key key = { .tgid = pid_tgid >> 32, .vtid = state.vtid };
+            bpf_map_update_elem(&loader_op_vtids, &key, &tid, BPF_ANY);
+        }
+    }
+    bpf_map_update_elem(&loader_ops, &tid, &state, BPF_ANY);
+}
+
+/**
+ * @brief 记录线程结束动态链接操作，最外层的操作结束时才删除
+ */
+static __always_inline void end_loader_op(void)
+{
+    if (!lock_contention && !offcpu_profile)
+        return;
+
+    __u64 pid_tgid = bpf_get_current_pid_tgid();
+    __u32 tid = (__u32)pid_tgid;
+    struct loader_op_state *state = bpf_map_lookup_elem(&loader_ops, &tid);
+    if (!state)
+        return;
+    if (state->depth > 1) {
+        state->depth--;
+        return;
+    }
+
+    if (state->vtid) {
+        struct vtid_key key = { .tgid = pid_tgid >> 32, .vtid = state->vtid };
+        bpf_map_delete_elem(&loader_op_vtids, &key);
+    }
+    bpf_map_delete_elem(&loader_ops, &tid);
+}
+
+/**
+ * @brief 在函数入口读取返回地址
+ */
+static __always_inline __u64 read_return_addr(struct pt_regs *ctx)
+{
+    __u64 ret_addr = 0;
+#if defined(__TARGET_ARCH_x86)
+    bpf_probe_read_user(&ret_addr, sizeof(ret_addr), (void *)PT_REGS_SP(ctx));
+#elif defined(__TARGET_ARCH_arm64)
+    ret_addr = PT_REGS_RET(ctx);
+#endif
+    return ret_addr;
+}
+
+/**
+ * @brief 计算用户空间字符串的编号并写入库路径字符串表
+ */
+static __always_inline __u64 intern_user_path(const void *path)
+{
+    if (!path)
+        return 0;
+
+    struct event *e = init_var_event(EVENT_DLOPEN);
+    if (!e)
+        return 0;
+    append_path(e, path);
+    if (e->path_len <= 1)
+        return 0;
+
+    __u64 path_id = hash_string(e->data, e->path_len);
+    bpf_map_update_elem(&lib_paths, &path_id, e->data, BPF_NOEXIST);
+    return path_id;
+}
+
+/**
+ * @brief 构造当前进程中指定句柄的映射键
+ */
+static __always_inline struct handle_key make_handle_key(__u64 handle)
+{
+    struct handle_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    key.handle = handle;
+    return key;
+}
+
+/**
+ * @brief 记录句柄对应的库信息，新增表项时累加进程的表项计数
+ */
+static __always_inline void add_handle(__u64 handle, struct handle_info *info)
+{
+    struct handle_key key = make_handle_key(handle);
+
+    if (bpf_map_update_elem(&handle_to_path, &key, info, BPF_NOEXIST) == 0) {
+        __u32 *cnt = bpf_map_lookup_elem(&handle_counts, &key.tgid);
+        if (cnt) {
+            __sync_fetch_and_add(cnt, 1);
+        } else {
+            __u32 one = 1;
+            bpf_map_update_elem(&handle_counts, &key.tgid, &one, BPF_NOEXIST);
+        }
+    } else {
+        // 同一句柄重复dlopen时只更新内容
+        bpf_map_update_elem(&handle_to_path, &key, info, BPF_EXIST);
+    }
+}
+
+/**
+ * @brief 删除句柄映射，删除成功时递减进程的表项计数
+ */
+static __always_inline void remove_handle(struct handle_key *key)
+{
+    if (bpf_map_delete_elem(&handle_to_path, key))
+        return;
+
+    __u32 *cnt = bpf_map_lookup_elem(&handle_counts, &key->tgid);
+    if (cnt && *cnt > 0)
+        __sync_fetch_and_sub(cnt, 1);
+}
+
+struct purge_ctx {
+    __u32 tgid;
+    __u32 remaining;    ///< 尚未删除的表项数，删完即停止遍历
+};
+
+/**
+ * @brief bpf_for_each_map_elem的回调，删除属于指定进程的句柄映射
+ */
+static long purge_handle(struct bpf_map *map, struct handle_key *key,
+                         struct handle_info *info, struct purge_ctx *ctx)
+{
+    if (key->tgid != ctx->tgid)
+        return 0;
+    bpf_map_delete_elem(map, key);
+    return --ctx->remaining == 0;
+}
+
+/**
+ * @brief 清理退出进程遗留的句柄映射（未调用dlclose的库）
+ */
+static __always_inline void purge_process_handles(__u32 tgid)
+{
+    __u32 *cnt = bpf_map_lookup_elem(&handle_counts, &tgid);
+    if (!cnt)
+        return;
+
+    struct purge_ctx ctx = { .tgid = tgid, .remaining = *cnt };
+    if (ctx.remaining > 0)
+        bpf_for_each_map_elem(&handle_to_path, purge_handle, &ctx, 0);
+    bpf_map_delete_elem(&handle_counts, &tgid);
+}
+
+/**
+ * @brief 跟踪进程创建
+ * 
+ * 父进程是目标进程时，将新创建的子进程加入目标进程集合，
+ * 从而自动覆盖整个服务进程树（如master及其worker）
+ */
+SEC("tp_btf/sched_process_fork")
+int BPF_PROG(handle_process_fork, struct task_struct *parent, struct task_struct *child)
+{
+    if (!filter_targets)
+        return 0;
+
+    // 创建线程时子任务与父任务同属一个线程组，无需处理
+    if (child->pid != child->tgid)
+        return 0;
+
+    // 跟踪点在父进程上下文中触发，父进程可能尚未从按命名空间编号的集合转存
+    __u32 parent_tgid = parent->tgid;
+    if (!bpf_map_lookup_elem(&target_tgids, &parent_tgid)) {
+        struct bpf_pidns_info ns = {};
+        if (!pidns_ino || bpf_get_ns_current_pid_tgid(pidns_dev, pidns_ino, &ns, sizeof(ns)) ||
+            !bpf_map_lookup_elem(&target_ns_tgids, &ns.tgid))
+            return 0;
+    }
+
+    __u32 child_tgid = child->tgid;
+    __u8 one = 1;
+    bpf_map_update_elem(&target_tgids, &child_tgid, &one, BPF_ANY);
+    return 0;
+}
+
+/**
+ * @brief 跟踪程序执行
+ * 
+ * 进程exec后进程名发生变化，若新进程名在目标进程名集合中则开始监控该进程
+ */
+SEC("tp_btf/sched_process_exec")
+int BPF_PROG(handle_process_exec, struct task_struct *p)
+{
+    if (!filter_targets)
+        return 0;
+
+    char comm[16] = {};
+    bpf_get_current_comm(&comm, sizeof(comm));
+    if (!bpf_map_lookup_elem(&target_comms, comm))
+        return 0;
+
+    __u32 tgid = bpf_get_current_pid_tgid() >> 32;
+    __u8 one = 1;
+    bpf_map_update_elem(&target_tgids, &tgid, &one, BPF_ANY);
+    return 0;
+}
+
+static __always_inline void release_thread_state(__u32 tid, __u32 tgid);
+
+/**
+ * @brief 跟踪进程退出
+ * 
+ * 每个线程退出时释放其遗留的入口状态；
+ * 线程组中最后一个线程退出时，清理该进程遗留的句柄映射，
+ * 聚合模式下输出该进程的汇总，并将进程从目标进程集合中移除
+ */
+SEC("tp_btf/sched_process_exit")
+int BPF_PROG(handle_process_exit, struct task_struct *p)
+{
+    // 退出的任务即当前任务，须在移出目标进程集合之前判断
+    if (is_target_process())
+        release_thread_state(p->pid, p->tgid);
+
+    // signal->live在调用该跟踪点前已递减，为0表示整个线程组都已退出
+    if (p->signal->live.counter != 0)
+        return 0;
+
+    __u32 tgid = p->tgid;
+    purge_process_handles(tgid);
+    if (aggregate_mode)
+        emit_proc_summary(tgid);
+    if (filter_targets) {
+        bpf_map_delete_elem(&target_tgids, &tgid);
+
+        // 退出的任务即当前任务，同时移除按命名空间编号登记的条目，避免进程ID复用后误匹配
+        struct bpf_pidns_info ns = {};
+        if (pidns_ino && !bpf_get_ns_current_pid_tgid(pidns_dev, pidns_ino, &ns, sizeof(ns)))
+            bpf_map_delete_elem(&target_ns_tgids, &ns.tgid);
+    }
+    if (lock_contention)
+        bpf_map_delete_elem(&loader_locks, &tgid);
+    if (unwind_profile)
+        bpf_map_delete_elem(&loaded_objects, &tgid);
+    return 0;
+}
+
+/**
+ * @brief 是否分解dlopen期间的系统调用（--syscalls）
+ */
+const volatile bool syscall_profile = false;
+
+/**
+ * @brief 线程在dlopen期间的系统调用状态
+ * 只在最外层dlopen进入时创建、返回时输出并删除，嵌套调用的系统调用计入最外层
+ */
+struct dlopen_syscall_state {
+    struct syscall_breakdown stats;   ///< 已完成系统调用的统计
+    __u64 sys_start;                  ///< 当前系统调用的开始时间戳，0表示不在系统调用中
+    __u64 sys_arg;                    ///< 当前系统调用需要在返回时使用的参数（mmap的长度）
+    __u32 sys_class;                  ///< 当前系统调用的分类（enum dl_syscall）
+    __u32 pad;
+};
+
+/**
+ * @brief 正在dlopen中的线程，以线程ID为键
+ * 表项即“处于dlopen中”的标志，系统调用跟踪点据此过滤其他线程
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct dlopen_syscall_state);
+} dlopen_syscalls SEC(".maps");
+
+/**
+ * @brief 是否记录库搜索时失败的打开尝试（--search-probes）
+ */
+const volatile bool search_probes = false;
+
+/**
+ * @brief 线程的库搜索状态
+ */
+struct search_state {
+    __u64 open_start;       ///< 当前open/openat的开始时间戳，0表示不在其中
+    __u64 open_path;        ///< 当前打开的路径（用户空间指针）
+    __u64 probe_ns;         ///< 上次打开成功以来失败尝试的耗时
+    __u32 probes;           ///< 上次打开成功以来失败尝试的次数
+    __u32 total_probes;     ///< 本次dlopen中失败尝试的总数
+    __u32 context;          ///< 场景（enum search_context）
+    __u32 pad;
+};
+
+/**
+ * @brief 正在dlopen或启动加载依赖的线程的搜索状态，以线程ID为键
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct search_state);
+} search_threads SEC(".maps");
+
+/**
+ * @brief 按最终打开的路径统计的搜索开销
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, __u64);
+    __type(value, struct search_value);
+} search_stats SEC(".maps");
+
+/**
+ * @brief 开始记录线程的库搜索
+ */
+static __always_inline void begin_search(__u32 tid, __u32 context)
+{
+    struct search_state state = {};
+    state.context = context;
+    bpf_map_update_elem(&search_threads, &tid, &state, BPF_ANY);
+}
+
+/**
+ * @brief 取得线程的库搜索到目前为止失败尝试的总数
+ */
+static __always_inline __u32 search_probe_count(__u32 tid)
+{
+    struct search_state *state = bpf_map_lookup_elem(&search_threads, &tid);
+    return state ? state->total_probes : 0;
+}
+
+/**
+ * @brief 结束线程的库搜索，返回期间失败尝试的总数
+ */
+static __always_inline __u32 end_search(__u32 tid)
+{
+    struct search_state *state = bpf_map_lookup_elem(&search_threads, &tid);
+    if (!state)
+        return 0;
+
+    __u32 probes = state->total_probes;
+    bpf_map_delete_elem(&search_threads, &tid);
+    return probes;
+}
+
+/**
+ * @brief 输出一次dlopen的系统调用分解并清除线程的标志
+ */
+static __always_inline void emit_dlopen_syscalls(__u32 tid, __u64 start_ts, __u64 duration_ns, __u64 path_id)
+{
+    struct dlopen_syscall_state *state = bpf_map_lookup_elem(&dlopen_syscalls, &tid);
+    if (!state)
+        return;
+
+    struct dlopen_syscalls_event *e = bpf_ringbuf_reserve(&events, sizeof(*e), 0);
+    if (e) {
+        __u64 pid_tgid = bpf_get_current_pid_tgid();
+        e->event_type = EVENT_DLOPEN_SYSCALLS;
+        e->pid = pid_tgid >> 32;
+        e->tid = (__u32)pid_tgid;
+        e->pad = 0;
+        e->timestamp = start_ts;
+        e->duration_ns = duration_ns;
+        e->path_id = path_id;
+        bpf_get_current_comm(&e->comm, sizeof(e->comm));
+        __builtin_memcpy(&e->stats, &state->stats, sizeof(e->stats));
+        bpf_ringbuf_submit(e, 0);
+    } else {
+        count_dropped_event();
+    }
+    bpf_map_delete_elem(&dlopen_syscalls, &tid);
+}
+
+/**
+ * @brief 保存dlopen/dlmopen的入口状态
+ */
+static __always_inline void enter_dlopen(struct pt_regs *ctx, __s64 lmid, const char *filename, int flags)
+{
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    // 返回探针无论是否找到入口状态都结束操作，这里先开始操作，两者保持配对
+    if (lock_contention || offcpu_profile)
+        begin_loader_op(OP_DLOPEN, intern_user_path(filename));
+
+    struct dlopen_stack *stack = bpf_map_lookup_elem(&dlopen_args, &tid);
+    if (!stack) {
+        struct dlopen_stack empty = {};
+        bpf_map_update_elem(&dlopen_args, &tid, &empty, BPF_NOEXIST);
+        stack = bpf_map_lookup_elem(&dlopen_args, &tid);
+        if (!stack)
+            return;
+    }
+
+    __u32 depth = stack->depth++;
+    if (depth < MAX_DL_DEPTH) {
+        struct dlopen_args *args = &stack->frames[depth & (MAX_DL_DEPTH - 1)];
+        args->start_ts = bpf_ktime_get_ns();
+        args->filename = (__u64)filename;
+        args->flags = flags;
+        args->lmid = lmid;
+        args->stack_id = capture_user_stack(ctx);
+        args->caller_addr = 0;
+        if (bpf_get_attach_cookie(ctx) & LIBC_ID_INTERNAL)
+            args->caller_addr = read_return_addr(ctx);
+        args->search_base = depth ? search_probe_count(tid) : 0;
+    }
+
+    // 嵌套的dlopen（如构造函数中）的系统调用计入最外层，不重置其统计
+    if (syscall_profile && !aggregate_mode && depth == 0) {
+        struct dlopen_syscall_state state = {};
+        bpf_map_update_elem(&dlopen_syscalls, &tid, &state, BPF_ANY);
+    }
+    // 嵌套的dlopen沿用最外层的搜索状态，不清零其中的累计
+    if (search_probes && depth == 0)
+        begin_search(tid, SEARCH_CTX_DLOPEN);
+}
+
+/**
+ * @brief 跟踪dlopen函数调用
+ * 
+ * 当进程调用dlopen加载动态库时触发此探针
+ * 只按线程保存调用参数和进入时间，事件在函数返回时统一输出
+ *
+ * 各dl*探针不在SEC中写死库路径，由用户空间发现系统和容器中
+ * 使用的C库后逐个附加，附加cookie为C库编号。同一程序也附加到glibc
+ * 内部的__libc_dlopen_mode，此时cookie带LIBC_ID_INTERNAL，并记录调用方地址
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_dlopen, const char *filename, int flags)
+{
+    if (!is_target_process())
+        return 0;
+
+    // 调用方在其他命名空间中时库会加载到该命名空间，由map_start探针更正
+    enter_dlopen(ctx, 0, filename, flags);
+    return 0;
+}
+
+/**
+ * @brief 跟踪dlmopen函数调用
+ *
+ * 与dlopen共用返回探针（附加cookie带LIBC_ID_VARIANT），入口额外记录
+ * 目标命名空间；LM_ID_NEWLM新建的命名空间编号由map_start探针取得
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_dlmopen, long lmid, const char *filename, int flags)
+{
+    if (!is_target_process())
+        return 0;
+
+    enter_dlopen(ctx, lmid, filename, flags);
+    return 0;
+}
+
+/**
+ * @brief 跟踪dlopen函数返回
+ * 
+ * 当dlopen返回时触发此探针，输出本次调用的完整记录
+ * 返回的句柄即struct link_map指针，直接从中读取库的实际路径
+ * 和加载基址，并更新句柄到库信息的映射
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_dlopen_ret, void *retval)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u64 handle = (__u64)retval;
+    struct user_link_map map = {};
+
+    // 取出本线程本层的入口状态，没有入口状态（监控启动前已进入）的调用无法计时，直接忽略
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct dlopen_stack *stack = bpf_map_lookup_elem(&dlopen_args, &tid);
+    if (!stack || stack->depth == 0) {
+        end_loader_op();
+        return 0;
+    }
+
+    __u32 depth = --stack->depth;
+    struct dlopen_args args = {};
+    struct event *e = NULL;
+    if (depth >= MAX_DL_DEPTH)
+        goto out;
+    args = stack->frames[depth & (MAX_DL_DEPTH - 1)];
+
+    e = init_var_event(EVENT_DLOPEN);
+    if (!e)
+        goto out;
+
+    e->duration_ns = e->timestamp - args.start_ts;
+    e->timestamp = args.start_ts;
+    e->flags = args.flags;
+    e->libc_id = bpf_get_attach_cookie(ctx);
+    e->caller_addr = args.caller_addr;
+    e->lmid = args.lmid;
+    e->stack_id = args.stack_id;
+    record_callsite(OP_DLOPEN, args.stack_id, e->duration_ns);
+    if (search_probes)
+        e->search_probes = depth ? search_probe_count(tid) - args.search_base : end_search(tid);
+    e->lib_addr = handle;
+    e->result = handle ? 0 : -1;
+    if (handle != 0 && bpf_probe_read_user(&map, sizeof(map), retval) == 0) {
+        e->base_addr = map.l_addr;
+        if (map.l_name)
+            append_path(e, (void *)map.l_name);
+    }
+    // 主程序等对象的l_name为空，加载失败时也没有link_map，使用请求路径
+    if (e->path_len <= 1 && args.filename)
+        append_path(e, (void *)args.filename);
+
+    if (e->path_len > 1) {
+        e->path_id = hash_string(e->data, e->path_len);
+        bpf_map_update_elem(&lib_paths, &e->path_id, e->data, BPF_NOEXIST);
+    }
+
+    if (handle != 0 && e->path_id) {
+        struct handle_info info = {};
+        info.path_id = e->path_id;
+        info.base_addr = e->base_addr;
+        info.lmid = e->lmid;
+        add_handle(handle, &info);
+    }
+
+    if (aggregate_mode) {
+        update_agg(EVENT_DLOPEN, e->path_id, 0, e->duration_ns, handle == 0);
+    } else {
+        // 请求的库名紧跟在实际路径之后
+        if (args.filename)
+            append_symbol(e, (void *)args.filename);
+        output_event(e);
+        if (syscall_profile && depth == 0)
+            emit_dlopen_syscalls(tid, args.start_ts, e->duration_ns, e->path_id);
+    }
+
+out:
+    if (depth == 0) {
+        bpf_map_delete_elem(&dlopen_args, &tid);
+        if (syscall_profile)
+            bpf_map_delete_elem(&dlopen_syscalls, &tid);
+        if (search_probes)
+            bpf_map_delete_elem(&search_threads, &tid);
+    }
+    end_loader_op();
+    return 0;
+}
+
+/**
+ * @brief 跟踪dlclose函数调用
+ * 
+ * 当进程调用dlclose卸载动态库时触发此探针
+ * 保存被卸载的库句柄和路径编号，并清理句柄映射
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_dlclose, void *handle)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct dlclose_args args = {};
+    args.start_ts = bpf_ktime_get_ns();
+    args.handle = (__u64)handle;
+
+    // 查找库路径编号，随后清理句柄映射
+    struct handle_key key = make_handle_key(args.handle);
+    struct handle_info *info = bpf_map_lookup_elem(&handle_to_path, &key);
+    if (info) {
+        args.path_id = info->path_id;
+        args.base_addr = info->base_addr;
+        args.lmid = info->lmid;
+    }
+    remove_handle(&key);
+    begin_loader_op(OP_DLCLOSE, args.path_id);
+
+    struct dlclose_stack *stack = bpf_map_lookup_elem(&dlclose_args, &tid);
+    if (!stack) {
+        struct dlclose_stack empty = {};
+        bpf_map_update_elem(&dlclose_args, &tid, &empty, BPF_NOEXIST);
+        stack = bpf_map_lookup_elem(&dlclose_args, &tid);
+        if (!stack)
+            return 0;
+    }
+    __u32 depth = stack->depth++;
+    if (depth < MAX_DL_DEPTH)
+        stack->frames[depth & (MAX_DL_DEPTH - 1)] = args;
+    return 0;
+}
+
+/**
+ * @brief 跟踪dlclose函数返回
+ * 
+ * 当dlclose返回时触发此探针
+ * 输出包含句柄、库路径编号、结果和耗时的完整记录
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_dlclose_ret, int retval)
+{
+    if (!is_target_process())
+        return 0;
+
+    // 没有入口状态（监控启动前已进入）的调用无法计时，只结束操作
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct dlclose_stack *stack = bpf_map_lookup_elem(&dlclose_args, &tid);
+    if (!stack || stack->depth == 0) {
+        end_loader_op();
+        return 0;
+    }
+
+    __u32 depth = --stack->depth;
+    if (depth < MAX_DL_DEPTH) {
+        struct dlclose_args args = stack->frames[depth & (MAX_DL_DEPTH - 1)];
+        __u64 delta_ns = bpf_ktime_get_ns() - args.start_ts;
+        if (aggregate_mode) {
+            update_agg(EVENT_DLCLOSE, args.path_id, 0, delta_ns, retval != 0);
+        } else {
+            struct event *e = reserve_event(EVENT_DLCLOSE);
+            if (e) {
+                e->timestamp = args.start_ts;
+                e->libc_id = bpf_get_attach_cookie(ctx);
+                e->lib_addr = args.handle;
+                e->path_id = args.path_id;
+                e->base_addr = args.base_addr;
+                e->lmid = args.lmid;
+                e->result = retval;
+                e->duration_ns = delta_ns;
+                bpf_ringbuf_submit(e, 0);
+            }
+        }
+    }
+
+    if (depth == 0)
+        bpf_map_delete_elem(&dlclose_args, &tid);
+    end_loader_op();
+    return 0;
+}
+
+/**
+ * @brief 保存dlsym/dlvsym的入口状态
+ */
+static __always_inline void enter_dlsym(struct pt_regs *ctx, void *handle, const char *symbol, const char *version)
+{
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct dlsym_args args = {};
+    args.start_ts = bpf_ktime_get_ns();
+    args.handle = (__u64)handle;
+    args.symbol = (__u64)symbol;
+    args.version = (__u64)version;
+    args.stack_id = capture_user_stack(ctx);
+    if (bpf_get_attach_cookie(ctx) & LIBC_ID_INTERNAL)
+        args.caller_addr = read_return_addr(ctx);
+
+    if (lock_contention || offcpu_profile) {
+        struct handle_key key = make_handle_key(args.handle);
+        struct handle_info *info = bpf_map_lookup_elem(&handle_to_path, &key);
+        begin_loader_op(OP_DLSYM, info ? info->path_id : 0);
+    }
+
+    struct dlsym_stack *stack = bpf_map_lookup_elem(&dlsym_args, &tid);
+    if (!stack) {
+        struct dlsym_stack empty = {};
+        bpf_map_update_elem(&dlsym_args, &tid, &empty, BPF_NOEXIST);
+        stack = bpf_map_lookup_elem(&dlsym_args, &tid);
+        if (!stack)
+            return;
+    }
+    __u32 depth = stack->depth++;
+    if (depth < MAX_DL_DEPTH)
+        stack->frames[depth & (MAX_DL_DEPTH - 1)] = args;
+}
+
+/**
+ * @brief 跟踪dlsym函数调用
+ * 
+ * 当进程调用dlsym解析符号时触发此探针
+ * 只按线程保存库句柄、符号名指针和进入时间
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_dlsym, void *handle, const char *symbol)
+{
+    if (!is_target_process())
+        return 0;
+
+    enter_dlsym(ctx, handle, symbol, NULL);
+    return 0;
+}
+
+/**
+ * @brief 跟踪dlvsym函数调用
+ *
+ * 与dlsym共用返回探针，入口额外保存请求的符号版本
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_dlvsym, void *handle, const char *symbol, const char *version)
+{
+    if (!is_target_process())
+        return 0;
+
+    enter_dlsym(ctx, handle, symbol, version);
+    return 0;
+}
+
+/**
+ * @brief 跟踪dlsym函数返回
+ * 
+ * 当dlsym返回时触发此探针
+ * 符号名从入口时保存的用户空间指针读取，输出包含符号名、
+ * 所属库、解析地址和耗时的完整记录；聚合模式下符号名
+ * 计算编号后写入符号名字符串表
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_dlsym_ret, void *retval)
+{
+    if (!is_target_process())
+        return 0;
+
+    // 没有入口状态（监控启动前已进入）的调用无法计时，只结束操作
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct dlsym_stack *stack = bpf_map_lookup_elem(&dlsym_args, &tid);
+    if (!stack || stack->depth == 0) {
+        end_loader_op();
+        return 0;
+    }
+
+    __u32 depth = --stack->depth;
+    struct dlsym_args args = {};
+    struct event *e = NULL;
+    if (depth >= MAX_DL_DEPTH)
+        goto out;
+    args = stack->frames[depth & (MAX_DL_DEPTH - 1)];
+
+    e = init_var_event(EVENT_DLSYM);
+    if (!e)
+        goto out;
+
+    e->duration_ns = e->timestamp - args.start_ts;
+    e->timestamp = args.start_ts;
+    e->libc_id = bpf_get_attach_cookie(ctx);
+    e->caller_addr = args.caller_addr;
+    e->lib_addr = args.handle;
+    e->symbol_addr = (__u64)retval;
+    e->result = retval ? 0 : -1;
+    e->stack_id = args.stack_id;
+    record_callsite(OP_DLSYM, args.stack_id, e->duration_ns);
+
+    struct handle_key key = make_handle_key(args.handle);
+    struct handle_info *info = bpf_map_lookup_elem(&handle_to_path, &key);
+    if (info) {
+        e->path_id = info->path_id;
+        e->base_addr = info->base_addr;
+        e->lmid = info->lmid;
+    }
+    // dlvsym记录的库路径区存放请求的符号版本；聚合模式下版本不区分
+    if (args.version && !aggregate_mode)
+        append_path(e, (void *)args.version);
+    append_symbol(e, (void *)args.symbol);
+
+    if (aggregate_mode) {
+        __u64 symbol_id = 0;
+        if (e->symbol_len > 1) {
+            symbol_id = hash_string(e->data, e->symbol_len);
+            bpf_map_update_elem(&symbol_names, &symbol_id, e->data, BPF_NOEXIST);
+        }
+        update_agg(EVENT_DLSYM, e->path_id, symbol_id, e->duration_ns, retval == 0);
+    } else {
+        output_event(e);
+    }
+
+out:
+    if (depth == 0)
+        bpf_map_delete_elem(&dlsym_args, &tid);
+    end_loader_op();
+    return 0;
+}
+
+/**
+ * @brief 取得对象（link_map）的路径编号
+ *
+ * 先查句柄映射（dlopen返回的句柄就是link_map），再查对象缓存，
+ * 都未命中时读取l_name写入字符串表，并把结果加入对象缓存；
+ * 主程序的路径编号0同样缓存，避免每次重新读取
+ */
+static __always_inline __u64 object_path_id(__u64 link_map)
+{
+    struct handle_key key = make_handle_key(link_map);
+    struct handle_info *handle = bpf_map_lookup_elem(&handle_to_path, &key);
+    if (handle)
+        return handle->path_id;
+
+    struct user_link_map map = {};
+    if (!link_map || bpf_probe_read_user(&map, sizeof(map), (void *)link_map) || !map.l_name)
+        return 0;
+
+    struct object_info *cached = bpf_map_lookup_elem(&object_paths, &key);
+    if (cached && cached->base_addr == map.l_addr && cached->name_addr == map.l_name)
+        return cached->path_id;
+
+    struct event *e = init_var_event(EVENT_DLSYM);
+    if (!e)
+        return 0;
+    append_path(e, (void *)map.l_name);
+
+    struct object_info info = {};
+    info.base_addr = map.l_addr;
+    info.name_addr = map.l_name;
+    // 主程序的l_name为空串，编号记为0
+    if (e->path_len > 1) {
+        info.path_id = hash_string(e->data, e->path_len);
+        bpf_map_update_elem(&lib_paths, &info.path_id, e->data, BPF_NOEXIST);
+    }
+    bpf_map_update_elem(&object_paths, &key, &info, BPF_ANY);
+    return info.path_id;
+}
+
+/**
+ * @brief bpf_find_vma的回调，取得地址所在映射的文件inode
+ */
+static long read_vma_inode(struct task_struct *task, struct vm_area_struct *vma, __u64 *inode)
+{
+    struct file *file = vma->vm_file;
+    if (file)
+        *inode = (__u64)BPF_CORE_READ(file, f_inode);
+    return 0;
+}
+
+/**
+ * @brief 是否统计动态TLS访问（--tls-profile）
+ */
+const volatile bool tls_profile = false;
+
+/**
+ * @brief struct link_map中l_tls_modid的偏移，由用户空间从ld.so的
+ * _thread_db_link_map_l_tls_modid描述符读出，0表示未知（不按模块解析库）
+ */
+const volatile __u32 tls_modid_offset = 0;
+
+/**
+ * @brief TLS模块编号到库的映射，以（进程, 模块编号）为键
+ *
+ * 模块编号在加载时分配并写入link_map的l_tls_modid，映射阶段完成后遍历
+ * 新对象记录；编号在卸载后可被复用，重新加载时覆盖旧项
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_LRU_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct tls_key);
+    __type(value, __u64);
+} tls_modules SEC(".maps");
+
+/**
+ * @brief 记录对象的TLS模块编号
+ *
+ * 没有TLS段的对象l_tls_modid为0，不记录
+ */
+static __always_inline void record_tls_module(__u64 link_map, __u64 path_id)
+{
+    struct tls_key key = {};
+    if (bpf_probe_read_user(&key.modid, sizeof(key.modid), (void *)(link_map + tls_modid_offset)) ||
+        !key.modid)
+        return;
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    bpf_map_update_elem(&tls_modules, &key, &path_id, BPF_ANY);
+}
+
+/**
+ * @brief 是否按命名空间统计已加载对象（--namespaces）
+ */
+const volatile bool namespace_profile = false;
+
+/**
+ * @brief 是否按库统计加载后的缺页和页缓存未命中（--fault-profile）
+ */
+const volatile bool fault_profile = false;
+
+/**
+ * @brief 加载后统计缺页的时间窗口（纳秒），0表示不限
+ */
+const volatile __u64 fault_window_ns = 0;
+
+/**
+ * @brief 已加载对象的键：（进程, 映射文件的inode）
+ */
+struct fault_object_key {
+    __u32 tgid;
+    __u32 pad;
+    __u64 inode;    ///< struct inode指针，与缺页时VMA的vm_file->f_inode比较
+};
+
+/**
+ * @brief 已加载对象的信息
+ */
+struct fault_object {
+    __u64 path_id;  ///< 库路径编号
+    __u64 load_ts;  ///< 加载的时间戳（纳秒）
+};
+
+/**
+ * @brief 目标进程中已加载对象的映射文件到库的映射，缺页时按VMA的文件查找
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_LRU_HASH);
+    __uint(max_entries, 65536);
+    __type(key, struct fault_object_key);
+    __type(value, struct fault_object);
+} fault_objects SEC(".maps");
+
+/**
+ * @brief 按库路径编号统计的缺页
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, __u64);
+    __type(value, struct fault_value);
+} fault_stats SEC(".maps");
+
+/**
+ * @brief 取得库的缺页统计，不存在时创建
+ */
+static __always_inline struct fault_value *lookup_fault_value(__u64 path_id)
+{
+    struct fault_value *val = bpf_map_lookup_elem(&fault_stats, &path_id);
+    if (val)
+        return val;
+
+    struct fault_value zero = {};
+    bpf_map_update_elem(&fault_stats, &path_id, &zero, BPF_NOEXIST);
+    return bpf_map_lookup_elem(&fault_stats, &path_id);
+}
+
+/**
+ * @brief 记录新加载对象的映射文件
+ *
+ * 加载器报告的基址范围对应同一文件的若干VMA，缺页时比较VMA的文件即可
+ * 判断落在哪个库中，不必逐个比较地址范围。动态段（l_ld）一定位于对象
+ * 自己的映射中，用它找到映射文件
+ */
+static __always_inline void register_fault_object(__u64 link_map, __u64 path_id, __u64 load_ts)
+{
+    __u64 l_ld = 0, inode = 0;
+    if (bpf_probe_read_user(&l_ld, sizeof(l_ld),
+                            (void *)(link_map + __builtin_offsetof(struct user_link_map, l_ld))) || !l_ld)
+        return;
+
+    struct task_struct *task = bpf_get_current_task_btf();
+    if (bpf_find_vma(task, l_ld, read_vma_inode, &inode, 0) || !inode)
+        return;
+
+    struct fault_object_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    key.inode = inode;
+    struct fault_object obj = {};
+    obj.path_id = path_id;
+    obj.load_ts = load_ts;
+    bpf_map_update_elem(&fault_objects, &key, &obj, BPF_ANY);
+
+    struct fault_value *val = lookup_fault_value(path_id);
+    if (val)
+        __sync_fetch_and_add(&val->loads, 1);
+}
+
+#define MAX_NEW_OBJECTS 256   ///< 一次加载中最多记录的新对象数
+
+/**
+ * @brief 遍历新加载对象的上下文
+ */
+struct ns_walk {
+    __u64 map;      ///< 当前对象的link_map
+    __s64 lmid;     ///< 所在命名空间
+    __u64 load_ts;  ///< 加载的时间戳
+};
+
+/**
+ * @brief bpf_loop的回调，把一个新加载的对象连同命名空间记入对象缓存，
+ * 统计缺页时同时记录它的映射文件
+ */
+static long track_ns_object(__u32 index, struct ns_walk *walk)
+{
+    if (!walk->map)
+        return 1;
+
+    struct handle_key key = make_handle_key(walk->map);
+    __u64 path_id = object_path_id(walk->map);
+    if (fault_profile && path_id)
+        register_fault_object(walk->map, path_id, walk->load_ts);
+    if (tls_profile && tls_modid_offset && path_id)
+        record_tls_module(walk->map, path_id);
+    struct handle_info *info = bpf_map_lookup_elem(&handle_to_path, &key);
+    if (info)
+        info->lmid = walk->lmid;
+    struct object_info *obj = bpf_map_lookup_elem(&object_paths, &key);
+    if (obj)
+        obj->lmid = walk->lmid;
+
+    if (bpf_probe_read_user(&walk->map, sizeof(walk->map),
+                            (void *)(walk->map + __builtin_offsetof(struct user_link_map, l_next))))
+        walk->map = 0;
+    return 0;
+}
+
+/**
+ * @brief 记录一次映射阶段新加载的全部对象
+ *
+ * 新对象追加在命名空间链表的末尾，从map_complete给出的第一个新对象沿
+ * l_next遍历即可。依赖库（如各命名空间各自的libstdc++）也由此进入对象
+ * 缓存，用户空间据此按命名空间统计对象数和内存
+ */
+static __always_inline void track_namespace_objects(__u64 new_map, __s64 lmid, __u64 load_ts)
+{
+    struct ns_walk walk = {};
+    walk.map = new_map;
+    walk.lmid = lmid;
+    walk.load_ts = load_ts;
+    bpf_loop(MAX_NEW_OBJECTS, track_ns_object, &walk, 0);
+}
+
+/**
+ * @brief 进行中的动态链接器阶段
+ */
+struct rtld_phase_state {
+    __u64 start_ts;     ///< 阶段开始的时间戳（纳秒）
+    __u64 nested_ns;    ///< 期间嵌套完成的其他阶段的独占耗时（纳秒），如构造函数中dlopen的映射和重定位
+};
+
+/**
+ * @brief 进行中的动态链接器阶段
+ * 键为（线程ID << 32 | 阶段）
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u64);
+    __type(value, struct rtld_phase_state);
+} rtld_phase_start SEC(".maps");
+
+/**
+ * @brief 跟踪动态链接器阶段开始
+ *
+ * 附加到glibc rtld的init_start/map_start/reloc_start/unmap_start
+ * SDT探针，USDT cookie为阶段编号（enum rtld_phase）；lmid为操作的命名空间
+ */
+SEC("usdt")
+int BPF_USDT(trace_rtld_start, long lmid, void *r_debug)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u64 phase = bpf_usdt_cookie(ctx);
+    __u64 pid_tgid = bpf_get_current_pid_tgid();
+    __u64 key = (pid_tgid << 32) | phase;
+    struct rtld_phase_state state = { .start_ts = bpf_ktime_get_ns() };
+    bpf_map_update_elem(&rtld_phase_start, &key, &state, BPF_ANY);
+
+    // 启动时加载依赖期间同样记录库搜索
+    if (search_probes && phase == RTLD_PHASE_INIT)
+        begin_search((__u32)pid_tgid, SEARCH_CTX_STARTUP);
+
+    // 进行中的dlopen/dlmopen以map_start给出的命名空间为准（含LM_ID_NEWLM新建的编号）
+    if (phase == RTLD_PHASE_MAP) {
+        __u32 tid = (__u32)pid_tgid;
+        struct dlopen_args *args = current_dlopen(tid);
+        if (args)
+            args->lmid = lmid;
+    }
+    return 0;
+}
+
+/**
+ * @brief 跟踪动态链接器阶段完成
+ *
+ * 附加到各*_complete探针，计算阶段耗时。map_complete和reloc_complete
+ * 的第三个参数是新加载对象的link_map，从中读取库路径；
+ * 当前线程正处于dlopen/dlclose调用中时记为dlopen场景，否则为进程启动
+ */
+SEC("usdt")
+int BPF_USDT(trace_rtld_complete, long lmid, void *r_debug, void *new_map)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 phase = bpf_usdt_cookie(ctx);
+    __u64 pid_tgid = bpf_get_current_pid_tgid();
+    __u32 tid = (__u32)pid_tgid;
+    __u64 key = (pid_tgid << 32) | phase;
+    struct rtld_phase_state *state = bpf_map_lookup_elem(&rtld_phase_start, &key);
+    if (!state)
+        return 0;
+
+    __u64 start = state->start_ts;
+    __u64 nested_ns = state->nested_ns;
+    bpf_map_delete_elem(&rtld_phase_start, &key);
+    if (phase >= RTLD_PHASE_MAX)
+        return 0;
+    if (search_probes && phase == RTLD_PHASE_INIT)
+        end_search(tid);
+
+    int context = RTLD_CTX_STARTUP;
+    if (bpf_map_lookup_elem(&dlopen_args, &tid) || bpf_map_lookup_elem(&dlclose_args, &tid))
+        context = RTLD_CTX_DLOPEN;
+
+    __u64 delta_ns = bpf_ktime_get_ns() - start;
+    __u64 exclusive_ns = delta_ns > nested_ns ? delta_ns - nested_ns : 0;
+
+    // 从仍在进行的外层阶段中扣除本阶段的独占耗时，各阶段之和不再重复计算嵌套部分
+    for (__u32 outer = 0; outer < RTLD_PHASE_MAX; outer++) {
+        if (outer == phase)
+            continue;
+        __u64 outer_key = (pid_tgid << 32) | outer;
+        struct rtld_phase_state *enclosing = bpf_map_lookup_elem(&rtld_phase_start, &outer_key);
+        if (enclosing)
+            enclosing->nested_ns += exclusive_ns;
+    }
+
+    if (unwind_profile)
+        count_loaded_objects(r_debug);
+    if ((namespace_profile || fault_profile || tls_profile) && phase == RTLD_PHASE_MAP && new_map)
+        track_namespace_objects((__u64)new_map, lmid, start);
+    // 启动时加载的对象没有map_complete，在init_complete时遍历整个链表
+    if ((fault_profile || (tls_profile && context == RTLD_CTX_STARTUP)) && phase == RTLD_PHASE_INIT) {
+        struct user_r_debug rd = {};
+        if (r_debug && bpf_probe_read_user(&rd, sizeof(rd), r_debug) == 0 && rd.r_map)
+            track_namespace_objects(rd.r_map, lmid, start);
+    }
+    if (aggregate_mode) {
+        struct proc_stats *ps = lookup_proc_stats(pid_tgid >> 32);
+        if (ps)
+            __sync_fetch_and_add(&ps->phase_ns[context][phase], exclusive_ns);
+        return 0;
+    }
+
+    struct event *e = init_var_event(EVENT_RTLD_PHASE);
+    if (!e)
+        return 0;
+
+    e->timestamp = start;
+    e->duration_ns = delta_ns;
+    e->symbol_addr = exclusive_ns;
+    e->flags = phase;
+    e->result = context;
+    e->lmid = lmid;
+
+    struct user_link_map map = {};
+    if ((phase == RTLD_PHASE_MAP || phase == RTLD_PHASE_RELOC) && new_map &&
+        bpf_probe_read_user(&map, sizeof(map), new_map) == 0) {
+        e->lib_addr = (__u64)new_map;
+        e->base_addr = map.l_addr;
+        if (map.l_name)
+            append_path(e, (void *)map.l_name);
+        if (e->path_len > 1) {
+            e->path_id = hash_string(e->data, e->path_len);
+            bpf_map_update_elem(&lib_paths, &e->path_id, e->data, BPF_NOEXIST);
+        }
+    }
+
+    output_event(e);
+    return 0;
+}
+
+/**
+ * @brief glibc内部的struct r_scope_elem（查找作用域）
+ */
+struct user_scope_elem {
+    __u64 r_list;     ///< struct link_map **，作用域中的对象数组
+    __u32 r_nlist;    ///< 对象个数
+};
+
+#define MAX_LOOKUP_SCOPES         4     ///< 统计搜索深度时最多遍历的作用域数
+#define MAX_LOOKUP_SCOPE_ENTRIES  512   ///< 每个作用域最多遍历的对象数
+#define LOOKUP_SCOPE_CHUNK        16    ///< 每次读取的作用域数组项数
+
+/**
+ * @brief _dl_lookup_symbol_x调用入口状态
+ */
+struct sym_lookup_args {
+    __u64 start_ts;       ///< 进入查找的时间戳（纳秒）
+    __u64 undef_name;     ///< 查找的符号名（用户空间指针）
+    __u64 undef_map;      ///< 发起查找的对象的link_map
+    __u64 symbol_scope;   ///< 查找作用域数组（struct r_scope_elem *[]）
+};
+
+/**
+ * @brief 进行中的符号查找，以线程ID为键
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct sym_lookup_args);
+} sym_lookup_args SEC(".maps");
+
+/**
+ * @brief 符号查找开销统计
+ * 查找极其频繁，只在内核中累计，由用户空间定期读取
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct lookup_key);
+    __type(value, struct lookup_value);
+} lookup_stats SEC(".maps");
+
+/**
+ * @brief 计算命中前搜索过的作用域对象数
+ *
+ * 按查找顺序遍历各作用域中的对象，直到遇到定义符号的对象；
+ * 未找到时返回遍历过的全部对象数。作用域数组按块读取，
+ * 每个作用域最多读取MAX_LOOKUP_SCOPE_ENTRIES / LOOKUP_SCOPE_CHUNK次
+ */
+static __always_inline __u32 count_scope_entries(__u64 symbol_scope, __u64 result)
+{
+    __u32 searched = 0;
+
+    for (int i = 0; i < MAX_LOOKUP_SCOPES; i++) {
+        __u64 scope_ptr = 0;
+        struct user_scope_elem scope = {};
+        if (bpf_probe_read_user(&scope_ptr, sizeof(scope_ptr), (void *)(symbol_scope + i * sizeof(__u64))) ||
+            !scope_ptr || bpf_probe_read_user(&scope, sizeof(scope), (void *)scope_ptr))
+            break;
+
+        __u32 nlist = scope.r_nlist < MAX_LOOKUP_SCOPE_ENTRIES ? scope.r_nlist : MAX_LOOKUP_SCOPE_ENTRIES;
+        // 未找到定义时必然搜索了全部对象，无需读取数组
+        if (!result) {
+            searched += nlist;
+            continue;
+        }
+        for (__u32 j = 0; j < MAX_LOOKUP_SCOPE_ENTRIES; j += LOOKUP_SCOPE_CHUNK) {
+            if (j >= nlist)
+                break;
+            // 只读取数组中实际存在的项，避免越过分配的末尾
+            __u32 n = nlist - j;
+            if (n > LOOKUP_SCOPE_CHUNK)
+                n = LOOKUP_SCOPE_CHUNK;
+            __u64 maps[LOOKUP_SCOPE_CHUNK] = {};
+            if (bpf_probe_read_user(maps, n * sizeof(__u64), (void *)(scope.r_list + j * sizeof(__u64)))) {
+                searched += n;
+                continue;
+            }
+            for (__u32 k = 0; k < LOOKUP_SCOPE_CHUNK; k++) {
+                if (k >= n)
+                    break;
+                searched++;
+                if (maps[k] == result)
+                    return searched;
+            }
+        }
+    }
+    return searched;
+}
+
+/**
+ * @brief 是否统计符号查找开销（--lookup-profile）
+ */
+const volatile bool lookup_profile = false;
+
+/**
+ * @brief 是否跟踪延迟绑定（--lazy-binding）
+ * 延迟绑定中符号名和定义所在对象从_dl_fixup内部的符号查找中取得
+ */
+const volatile bool lazy_binding = false;
+
+/**
+ * @brief 延迟绑定事件的采样率，每N次绑定输出一条事件，统计不受影响
+ */
+const volatile __u32 lazy_sample_rate = 1;
+
+/**
+ * @brief _dl_fixup调用入口状态
+ */
+struct fixup_args {
+    __u64 start_ts;     ///< 进入_dl_fixup的时间戳（纳秒）
+    __u64 link_map;     ///< 发生绑定的调用方对象
+    __u64 undef_name;   ///< 内部符号查找的符号名（用户空间指针）
+    __u64 def_map;      ///< 内部符号查找找到的定义所在对象
+    __u32 sampled;      ///< 本次绑定是否被采样输出
+};
+
+/**
+ * @brief 进行中的延迟绑定，以线程ID为键
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct fixup_args);
+} fixup_args SEC(".maps");
+
+/**
+ * @brief 按（进程, 调用方对象）统计的延迟绑定
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct lazy_key);
+    __type(value, struct lazy_value);
+} lazy_stats SEC(".maps");
+
+/**
+ * @brief 跟踪动态链接器内部的符号查找
+ *
+ * _dl_lookup_symbol_x是ld.so的内部函数，需要ld.so保留符号表，
+ * 由--lookup-profile或--lazy-binding开启时才加载和附加
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_lookup_symbol, const char *undef_name, void *undef_map,
+               void *ref, void *symbol_scope)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct sym_lookup_args args = {};
+    args.start_ts = bpf_ktime_get_ns();
+    args.undef_name = (__u64)undef_name;
+    args.undef_map = (__u64)undef_map;
+    args.symbol_scope = (__u64)symbol_scope;
+    bpf_map_update_elem(&sym_lookup_args, &tid, &args, BPF_ANY);
+    return 0;
+}
+
+/**
+ * @brief 跟踪符号查找返回
+ *
+ * 返回值为定义该符号的对象的link_map，NULL表示未找到；
+ * 按（进程, 发起对象, 符号）累计次数、耗时和搜索深度
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_lookup_symbol_ret, void *retval)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct sym_lookup_args *argp = bpf_map_lookup_elem(&sym_lookup_args, &tid);
+    if (!argp)
+        return 0;
+
+    struct sym_lookup_args args = *argp;
+    bpf_map_delete_elem(&sym_lookup_args, &tid);
+    __u64 delta_ns = bpf_ktime_get_ns() - args.start_ts;
+
+    // 处于延迟绑定中时，记下本次查找的符号和结果
+    if (lazy_binding) {
+        struct fixup_args *fixup = bpf_map_lookup_elem(&fixup_args, &tid);
+        if (fixup) {
+            fixup->undef_name = args.undef_name;
+            fixup->def_map = (__u64)retval;
+        }
+    }
+    if (!lookup_profile)
+        return 0;
+
+    struct lookup_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    key.object_id = object_path_id(args.undef_map);
+
+    struct event *e = init_var_event(EVENT_DLSYM);
+    if (!e)
+        return 0;
+    append_symbol(e, (void *)args.undef_name);
+    if (e->symbol_len > 1) {
+        key.symbol_id = hash_string(e->data, e->symbol_len);
+        bpf_map_update_elem(&symbol_names, &key.symbol_id, e->data, BPF_NOEXIST);
+    }
+
+    __u32 searched = count_scope_entries(args.symbol_scope, (__u64)retval);
+
+    struct lookup_value *val = bpf_map_lookup_elem(&lookup_stats, &key);
+    if (!val) {
+        struct lookup_value zero = {};
+        bpf_map_update_elem(&lookup_stats, &key, &zero, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&lookup_stats, &key);
+        if (!val)
+            return 0;
+    }
+
+    __sync_fetch_and_add(&val->calls, 1);
+    if (!retval)
+        __sync_fetch_and_add(&val->failures, 1);
+    __sync_fetch_and_add(&val->total_ns, delta_ns);
+    __sync_fetch_and_add(&val->scope_entries, searched);
+    atomic_max_u32(&val->max_entries, searched);
+    return 0;
+}
+
+/**
+ * @brief 跟踪延迟绑定
+ *
+ * 以RTLD_LAZY加载的库首次通过PLT调用函数时，_dl_runtime_resolve
+ * 调用_dl_fixup(link_map, reloc_arg)解析并回填GOT。第一个参数即
+ * 调用方对象，按采样率决定本次绑定是否输出事件
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_dl_fixup, void *link_map)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct fixup_args args = {};
+    args.start_ts = bpf_ktime_get_ns();
+    args.link_map = (__u64)link_map;
+    args.sampled = lazy_sample_rate <= 1 || bpf_get_prandom_u32() % lazy_sample_rate == 0;
+    bpf_map_update_elem(&fixup_args, &tid, &args, BPF_ANY);
+    return 0;
+}
+
+/**
+ * @brief 跟踪延迟绑定完成
+ *
+ * 返回值为绑定到的函数地址。所有绑定都计入按调用方对象的统计，
+ * 被采样的绑定在流式模式下输出事件
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_dl_fixup_ret, void *retval)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct fixup_args *argp = bpf_map_lookup_elem(&fixup_args, &tid);
+    if (!argp)
+        return 0;
+
+    struct fixup_args args = *argp;
+    bpf_map_delete_elem(&fixup_args, &tid);
+    __u64 now = bpf_ktime_get_ns();
+    __u64 delta_ns = now - args.start_ts;
+
+    struct lazy_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    key.path_id = object_path_id(args.link_map);
+
+    struct lazy_value *val = bpf_map_lookup_elem(&lazy_stats, &key);
+    if (!val) {
+        struct lazy_value init = {};
+        init.first_ts = args.start_ts;
+        bpf_map_update_elem(&lazy_stats, &key, &init, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&lazy_stats, &key);
+    }
+    if (val) {
+        __sync_fetch_and_add(&val->bindings, 1);
+        __sync_fetch_and_add(&val->total_ns, delta_ns);
+        val->last_ts = now;
+    }
+
+    if (!args.sampled || aggregate_mode)
+        return 0;
+
+    // 先取得定义所在对象的编号，object_path_id会占用事件构造缓冲区
+    __u64 def_path_id = object_path_id(args.def_map);
+
+    struct event *e = init_var_event(EVENT_LAZY_BIND);
+    if (!e)
+        return 0;
+
+    e->timestamp = args.start_ts;
+    e->duration_ns = delta_ns;
+    e->lib_addr = args.link_map;
+    e->path_id = key.path_id;
+    e->def_path_id = def_path_id;
+    e->symbol_addr = (__u64)retval;
+    if (args.undef_name)
+        append_symbol(e, (void *)args.undef_name);
+    output_event(e);
+    return 0;
+}
+
+#define MAX_INIT_DEPTH 8    ///< 构造函数中再次dlopen时允许的最大嵌套层数
+
+/**
+ * @brief 构造/析构调用栈
+ * 构造函数中可以再次调用dlopen，返回探针拿不到参数，
+ * 因此按线程保存一个小栈，记录每层的库和开始时间
+ */
+struct init_frames {
+    __u32 depth;                        ///< 当前嵌套层数
+    __u32 pad;
+    __u64 link_map[MAX_INIT_DEPTH];     ///< 每层对应的库（_dl_fini为0）
+    __u64 start_ts[MAX_INIT_DEPTH];     ///< 每层的开始时间戳（纳秒）
+};
+
+/**
+ * @brief 进行中的构造/析构调用，以线程ID为键
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct init_frames);
+} init_frames SEC(".maps");
+
+/**
+ * @brief 跟踪构造/析构函数开始
+ *
+ * 附加到call_init/_dl_call_fini等函数，第一个参数为库的link_map，
+ * 附加cookie为来源探针（enum init_fini_source）
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_init_fini, void *link_map)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct init_frames *frames = bpf_map_lookup_elem(&init_frames, &tid);
+    if (!frames) {
+        struct init_frames empty = {};
+        bpf_map_update_elem(&init_frames, &tid, &empty, BPF_NOEXIST);
+        frames = bpf_map_lookup_elem(&init_frames, &tid);
+        if (!frames)
+            return 0;
+    }
+
+    __u32 depth = frames->depth;
+    if (depth < MAX_INIT_DEPTH) {
+        // _dl_fini没有参数
+        frames->link_map[depth] = bpf_get_attach_cookie(ctx) == SRC_DL_FINI ? 0 : (__u64)link_map;
+        frames->start_ts[depth] = bpf_ktime_get_ns();
+    }
+    // 超过最大层数时只计数，保证返回时出栈配对
+    frames->depth = depth + 1;
+    return 0;
+}
+
+/**
+ * @brief 跟踪构造/析构函数完成
+ *
+ * 计算本层耗时并按库记录。线程正处于dlopen/dlclose中时记为
+ * 相应场景，否则构造函数记为进程启动，析构函数记为进程退出
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_init_fini_ret)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct init_frames *frames = bpf_map_lookup_elem(&init_frames, &tid);
+    if (!frames || frames->depth == 0)
+        return 0;
+
+    __u32 depth = --frames->depth;
+    if (depth >= MAX_INIT_DEPTH)
+        return 0;
+    __u64 link_map = frames->link_map[depth];
+    __u64 delta_ns = bpf_ktime_get_ns() - frames->start_ts[depth];
+    __u64 start_ts = frames->start_ts[depth];
+    if (depth == 0)
+        bpf_map_delete_elem(&init_frames, &tid);
+
+    __u32 source = bpf_get_attach_cookie(ctx);
+    int event_type = source <= SRC_DL_INIT ? EVENT_CTOR : EVENT_DTOR;
+    int context;
+    if (event_type == EVENT_CTOR)
+        context = bpf_map_lookup_elem(&dlopen_args, &tid) ? INIT_CTX_DLOPEN : INIT_CTX_STARTUP;
+    else
+        context = bpf_map_lookup_elem(&dlclose_args, &tid) ? INIT_CTX_DLCLOSE : INIT_CTX_EXIT;
+
+    __u64 path_id = object_path_id(link_map);
+    if (aggregate_mode) {
+        update_agg(event_type, path_id, 0, delta_ns, false);
+        return 0;
+    }
+
+    struct event *e = reserve_event(event_type);
+    if (!e)
+        return 0;
+
+    e->timestamp = start_ts;
+    e->duration_ns = delta_ns;
+    e->flags = source;
+    e->result = context;
+    e->lib_addr = link_map;
+    e->path_id = path_id;
+    bpf_ringbuf_submit(e, 0);
+    return 0;
+}
+
+/**
+ * @brief glibc struct __pthread_mutex_s的头部，x86_64与aarch64布局相同
+ */
+struct user_pthread_mutex {
+    int lock;           ///< futex字
+    __u32 count;        ///< 递归加锁层数
+    int owner;          ///< 持有线程在其PID命名空间中的线程ID，0表示未被持有
+    __u32 nusers;
+    int kind;           ///< 互斥量类型，低两位为PTHREAD_MUTEX_RECURSIVE_NP等
+};
+
+#define PTHREAD_MUTEX_KIND_MASK   3
+#define PTHREAD_MUTEX_RECURSIVE   1   ///< dl_load_lock和dl_load_write_lock都是递归锁
+
+#define FUTEX_WAIT          0
+#define FUTEX_WAIT_BITSET   9
+#define FUTEX_CMD_MASK      ~(128 | 256)    ///< 去掉FUTEX_PRIVATE_FLAG和FUTEX_CLOCK_REALTIME
+
+/**
+ * @brief 进行中的锁等待
+ */
+struct lock_wait {
+    __u64 start_ts;     ///< 进入futex等待的时间戳（纳秒）
+    struct lock_key key; ///< 归因信息
+};
+
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct lock_wait);
+} lock_waits SEC(".maps");
+
+/**
+ * @brief 锁等待统计，值中的calls为futex等待次数
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct lock_key);
+    __type(value, struct agg_value);
+} lock_stats SEC(".maps");
+
+/**
+ * @brief 判断系统调用号是否为futex等待
+ */
+static __always_inline bool is_futex_syscall(long nr)
+{
+#if defined(__TARGET_ARCH_x86)
+    return nr == 202 || nr == 449 || nr == 455;    // futex、futex_waitv、futex_wait
+#elif defined(__TARGET_ARCH_arm64)
+    return nr == 98 || nr == 449 || nr == 455;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief 取得系统调用上下文中的系统调用号
+ */
+static __always_inline long syscall_nr(struct pt_regs *regs)
+{
+#if defined(__TARGET_ARCH_x86)
+    return BPF_CORE_READ(regs, orig_ax);
+#elif defined(__TARGET_ARCH_arm64)
+    return BPF_CORE_READ(regs, syscallno);
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief 按持有者在互斥量中记录的线程ID查找其正在进行的动态链接操作
+ */
+static __always_inline struct loader_op_state *lookup_holder_op(__u32 tgid, __u32 owner)
+{
+    // 容器中的进程记录的是命名空间内的线程ID，需换算为全局线程ID
+    if (current_vtid()) {
+        struct vtid_key key = { .tgid = tgid, .vtid = owner };
+        __u32 *tid = bpf_map_lookup_elem(&loader_op_vtids, &key);
+        return tid ? bpf_map_lookup_elem(&loader_ops, tid) : NULL;
+    }
+    return bpf_map_lookup_elem(&loader_ops, &owner);
+}
+
+/**
+ * @brief 线程进入futex等待时，判断是否在等待动态链接器全局锁
+ *
+ * 互斥量无争用时加锁不进入内核，只有争用才会进入futex等待，因此只需跟踪
+ * futex系统调用，不必对每次pthread_mutex_lock/unlock设置探针。等待的地址
+ * 已识别为该进程的全局锁时直接计入；尚未识别时按等待方和持有方的操作识别。
+ * 持有者从互斥量的owner字段读取，归因到其最外层的操作
+ */
+static __always_inline void begin_lock_wait(struct pt_regs *regs)
+{
+    __u64 pid_tgid = bpf_get_current_pid_tgid();
+    __u32 tgid = pid_tgid >> 32;
+    __u32 tid = (__u32)pid_tgid;
+
+    struct loader_locks *locks = bpf_map_lookup_elem(&loader_locks, &tgid);
+    struct loader_op_state *op = bpf_map_lookup_elem(&loader_ops, &tid);
+    if (!locks && !op)
+        return;
+
+    __u32 cmd = PT_REGS_PARM2(regs) & FUTEX_CMD_MASK;
+    if (cmd != FUTEX_WAIT && cmd != FUTEX_WAIT_BITSET)
+        return;
+
+    __u64 addr = PT_REGS_PARM1(regs);
+    struct user_pthread_mutex mutex = {};
+    if (bpf_probe_read_user(&mutex, sizeof(mutex), (void *)addr))
+        return;
+    struct loader_op_state *holder = mutex.owner ? lookup_holder_op(tgid, mutex.owner) : NULL;
+
+    __u32 kind;
+    if (locks && addr == locks->addr[LOCK_LOAD]) {
+        kind = LOCK_LOAD;
+    } else if (locks && addr == locks->addr[LOCK_LOAD_WRITE]) {
+        kind = LOCK_LOAD_WRITE;
+    } else {
+        if (!op || !holder || (mutex.kind & PTHREAD_MUTEX_KIND_MASK) != PTHREAD_MUTEX_RECURSIVE)
+            return;
+        // dl_iterate_phdr只获取dl_load_write_lock，其余操作争用的是dl_load_lock
+        kind = op->op == OP_ITERATE_PHDR || holder->op == OP_ITERATE_PHDR ? LOCK_LOAD_WRITE : LOCK_LOAD;
+        if (!locks) {
+            struct loader_locks learned = {};
+            learned.addr[kind] = addr;
+            bpf_map_update_elem(&loader_locks, &tgid, &learned, BPF_NOEXIST);
+        } else if (!locks->addr[kind]) {
+            locks->addr[kind] = addr;
+        } else {
+            return;
+        }
+    }
+
+    struct lock_wait wait = {};
+    wait.start_ts = bpf_ktime_get_ns();
+    wait.key.tgid = tgid;
+    wait.key.lock = kind;
+    wait.key.waiter_op = op ? op->op : OP_NONE;
+    if (holder) {
+        wait.key.holder_op = holder->op;
+        wait.key.holder_path = holder->path_id;
+    }
+    bpf_map_update_elem(&lock_waits, &tid, &wait, BPF_ANY);
+}
+
+/**
+ * @brief 线程结束futex等待时，把等待时间累计到锁等待统计
+ */
+static __always_inline void end_lock_wait(__u32 tid)
+{
+    struct lock_wait *wait = bpf_map_lookup_elem(&lock_waits, &tid);
+    if (!wait)
+        return;
+
+    __u64 delta_ns = bpf_ktime_get_ns() - wait->start_ts;
+    struct lock_key key = wait->key;
+    bpf_map_delete_elem(&lock_waits, &tid);
+
+    struct agg_value *val = bpf_map_lookup_elem(&lock_stats, &key);
+    if (!val) {
+        struct agg_value zero = {};
+        bpf_map_update_elem(&lock_stats, &key, &zero, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&lock_stats, &key);
+        if (!val)
+            return;
+    }
+    add_agg_value(val, delta_ns, false);
+}
+
+#define MAX_API_DEPTH 4     ///< 遍历接口的最大嵌套层数（_Unwind_Find_FDE内部调用dl_iterate_phdr）
+
+/**
+ * @brief 遍历接口调用栈，返回探针拿不到参数和cookie以外的信息，按线程保存
+ */
+struct api_frames {
+    __u32 depth;
+    __u32 pad;
+    __u64 start_ts[MAX_API_DEPTH];    ///< 每层的开始时间戳（纳秒）
+    __u64 caller_id[MAX_API_DEPTH];   ///< 每层调用方模块的编号
+};
+
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct api_frames);
+} api_frames SEC(".maps");
+
+/**
+ * @brief 遍历接口的调用统计
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct api_key);
+    __type(value, struct api_value);
+} api_stats SEC(".maps");
+
+/**
+ * @brief bpf_find_vma回调的上下文
+ */
+struct caller_vma {
+    char name[64];      ///< 映射文件的文件名
+};
+
+/**
+ * @brief bpf_find_vma的回调，读取返回地址所在映射的文件名
+ */
+static long read_vma_name(struct task_struct *task, struct vm_area_struct *vma, struct caller_vma *data)
+{
+    struct file *file = vma->vm_file;
+    if (!file)
+        return 0;
+
+    const unsigned char *name = BPF_CORE_READ(file, f_path.dentry, d_name.name);
+    bpf_probe_read_kernel_str(data->name, sizeof(data->name), name);
+    return 0;
+}
+
+/**
+ * @brief 调用方缓存的键
+ */
+struct caller_key {
+    __u32 tgid;
+    __u32 pad;
+    __u64 addr;     ///< 调用方的返回地址
+};
+
+/**
+ * @brief 返回地址到调用方模块编号的缓存
+ * 同一调用点（如展开器中的同一条调用指令）会反复调用遍历接口，
+ * 命中缓存时不必每次都用bpf_find_vma查找映射
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_LRU_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct caller_key);
+    __type(value, __u64);
+} caller_modules SEC(".maps");
+
+/**
+ * @brief 取得调用方模块的编号
+ *
+ * 在函数入口读取返回地址，用bpf_find_vma找到其所在映射的文件名，
+ * 写入库路径字符串表后返回编号。字符串表的值与库路径等长，文件名
+ * 先复制到事件构造缓冲区再写入，结果按返回地址缓存
+ */
+static __always_inline __u64 caller_module_id(struct pt_regs *ctx)
+{
+    struct caller_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    key.addr = read_return_addr(ctx);
+    if (!key.addr)
+        return 0;
+
+    __u64 *cached = bpf_map_lookup_elem(&caller_modules, &key);
+    if (cached)
+        return *cached;
+
+    struct caller_vma vma = {};
+    struct task_struct *task = bpf_get_current_task_btf();
+    if (bpf_find_vma(task, key.addr, read_vma_name, &vma, 0) || !vma.name[0])
+        return 0;
+
+    __u32 len = 0;
+    for (; len < sizeof(vma.name) - 1; len++) {
+        if (!vma.name[len])
+            break;
+    }
+    __u64 id = hash_string(vma.name, len + 1);
+
+    struct event *e = init_var_event(EVENT_DLOPEN);
+    if (!e)
+        return 0;
+    __builtin_memcpy(e->data, vma.name, sizeof(vma.name));
+    bpf_map_update_elem(&lib_paths, &id, e->data, BPF_NOEXIST);
+    bpf_map_update_elem(&caller_modules, &key, &id, BPF_ANY);
+    return id;
+}
+
+/**
+ * @brief 跟踪遍历已加载对象的接口
+ *
+ * 附加到dl_iterate_phdr、dladdr、dladdr1和_Unwind_Find_FDE，cookie为接口
+ * （enum dl_api）。测量锁争用时dl_iterate_phdr同时作为锁归因的操作
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_dl_api)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 api = bpf_get_attach_cookie(ctx);
+    if (api == API_DL_ITERATE_PHDR)
+        begin_loader_op(OP_ITERATE_PHDR, 0);
+    if (!unwind_profile)
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct api_frames *frames = bpf_map_lookup_elem(&api_frames, &tid);
+    if (!frames) {
+        struct api_frames empty = {};
+        bpf_map_update_elem(&api_frames, &tid, &empty, BPF_NOEXIST);
+        frames = bpf_map_lookup_elem(&api_frames, &tid);
+        if (!frames)
+            return 0;
+    }
+
+    __u32 depth = frames->depth;
+    if (depth < MAX_API_DEPTH) {
+        frames->caller_id[depth] = caller_module_id(ctx);
+        frames->start_ts[depth] = bpf_ktime_get_ns();
+    }
+    frames->depth = depth + 1;
+    return 0;
+}
+
+/**
+ * @brief 跟踪遍历接口返回，按（进程, 接口, 调用方模块）累计
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_dl_api_ret)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 api = bpf_get_attach_cookie(ctx);
+    if (api == API_DL_ITERATE_PHDR)
+        end_loader_op();
+    if (!unwind_profile)
+        return 0;
+
+    __u64 pid_tgid = bpf_get_current_pid_tgid();
+    __u32 tid = (__u32)pid_tgid;
+    struct api_frames *frames = bpf_map_lookup_elem(&api_frames, &tid);
+    if (!frames || frames->depth == 0)
+        return 0;
+
+    __u32 depth = --frames->depth;
+    if (depth >= MAX_API_DEPTH)
+        return 0;
+
+    struct api_key key = {};
+    key.tgid = pid_tgid >> 32;
+    key.api = api;
+    key.caller_id = frames->caller_id[depth];
+    __u64 delta_ns = bpf_ktime_get_ns() - frames->start_ts[depth];
+    if (depth == 0)
+        bpf_map_delete_elem(&api_frames, &tid);
+
+    struct api_value *val = bpf_map_lookup_elem(&api_stats, &key);
+    if (!val) {
+        struct api_value zero = {};
+        bpf_map_update_elem(&api_stats, &key, &zero, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&api_stats, &key);
+        if (!val)
+            return 0;
+    }
+
+    __u32 *objects = bpf_map_lookup_elem(&loaded_objects, &key.tgid);
+    __u32 slot = log2_u64(delta_ns);
+    if (slot >= MAX_SLOTS)
+        slot = MAX_SLOTS - 1;
+
+    __sync_fetch_and_add(&val->calls, 1);
+    __sync_fetch_and_add(&val->total_ns, delta_ns);
+    if (objects) {
+        __sync_fetch_and_add(&val->objects, *objects);
+        __sync_fetch_and_add(&val->object_samples, 1);
+    }
+    __sync_fetch_and_add(&val->slots[slot], 1);
+    return 0;
+}
+
+/**
+ * @brief TLS访问的采样率，每N次访问计一次并按N放大，慢路径不受影响
+ */
+const volatile __u32 tls_sample_rate = 1;
+
+/**
+ * @brief glibc的tls_index，__tls_get_addr的参数，位于调用方对象的GOT中
+ */
+struct user_tls_index {
+    __u64 ti_module;    ///< 模块编号
+    __u64 ti_offset;    ///< 变量在模块TLS块中的偏移
+};
+
+/**
+ * @brief glibc的struct tlsdesc，_dl_tlsdesc_dynamic的参数，位于调用方对象的GOT中
+ * 动态描述符的arg指向以tls_index开头的struct tlsdesc_dynamic_arg
+ */
+struct user_tlsdesc {
+    __u64 entry;        ///< 解析函数
+    __u64 arg;          ///< 解析函数的参数
+};
+
+/**
+ * @brief 按（进程, 模块编号）统计的TLS访问
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct tls_key);
+    __type(value, struct tls_value);
+} tls_stats SEC(".maps");
+
+/**
+ * @brief 按线程统计的TLS慢路径
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct tls_thread_key);
+    __type(value, struct tls_thread_value);
+} tls_threads SEC(".maps");
+
+/**
+ * @brief 进入TLS慢路径时的状态
+ */
+struct tls_slow_args {
+    __u64 start_ts;     ///< 进入慢路径的时间戳（纳秒）
+    __u64 modid;        ///< 模块编号
+};
+
+/**
+ * @brief 进行中的TLS慢路径，以线程ID为键
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct tls_slow_args);
+} tls_slow_args SEC(".maps");
+
+/**
+ * @brief 取得TLS模块的库路径编号
+ *
+ * 按加载时记录的模块编号查找，跨模块访问（变量定义在另一个库中）同样
+ * 归到定义变量的库；监控启动前加载的对象没有记录，返回0
+ */
+static __always_inline __u64 tls_module_path_id(struct tls_key *key)
+{
+    __u64 *path_id = bpf_map_lookup_elem(&tls_modules, key);
+    return path_id ? *path_id : 0;
+}
 
 /**
- * @brief 事件输出缓冲区
- * 用于将事件数据从内核空间传递到用户空间
+ * @brief 取得（进程, 模块）的TLS统计，不存在时创建
  */
-struct {
-    __uint(type, BPF_MAP_TYPE_PERF_EVENT_ARRAY);
-    __uint(key_size, sizeof(int));
-    __uint(value_size, sizeof(int));
-    __uint(max_entries, 1024);
-} events SEC(".maps");
+static __always_inline struct tls_value *lookup_tls_value(struct tls_key *key)
+{
+    struct tls_value *val = bpf_map_lookup_elem(&tls_stats, key);
+    if (val)
+        return val;
+
+    struct tls_value zero = {};
+    bpf_map_update_elem(&tls_stats, key, &zero, BPF_NOEXIST);
+    return bpf_map_lookup_elem(&tls_stats, key);
+}
 
 /**
- * @brief 临时路径存储
- * 用于在dlopen的enter和return之间传递库路径
+ * @brief 跟踪动态TLS访问
+ *
+ * 附加到ld.so的__tls_get_addr和_dl_tlsdesc_dynamic（cookie为enum tls_entry），
+ * 只有入口探针。两者都是热路径，按采样率计数，模块路径在统计项中
+ * 首次被采样时解析（统计项每个输出周期被清空，模块编号被复用时随之更新）。
+ * 采样在探针内进行，未被采样的访问仍要经过uprobe陷入，只省去后续的
+ * 读取和计数
  */
-struct {
-    __uint(type, BPF_MAP_TYPE_HASH);
-    __uint(max_entries, 1);
-    __type(key, __u32);
-    __type(value, char[64]);
-} temp_path SEC(".maps");
+SEC("uprobe")
+int BPF_KPROBE(trace_tls_get_addr)
+{
+    if (!is_target_process())
+        return 0;
+    if (tls_sample_rate > 1 && bpf_get_prandom_u32() % tls_sample_rate != 0)
+        return 0;
+
+    __u64 ti_addr = PT_REGS_PARM1(ctx);
+    if (bpf_get_attach_cookie(ctx) == TLS_DESC_DYNAMIC) {
+        // _dl_tlsdesc_dynamic不遵循普通调用约定，描述符地址在返回值寄存器中
+        struct user_tlsdesc desc = {};
+        if (bpf_probe_read_user(&desc, sizeof(desc), (void *)PT_REGS_RC(ctx)))
+            return 0;
+        ti_addr = desc.arg;
+    }
+
+    struct tls_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    if (!ti_addr || bpf_probe_read_user(&key.modid, sizeof(key.modid), (void *)ti_addr))
+        return 0;
+
+    struct tls_value *val = lookup_tls_value(&key);
+    if (!val)
+        return 0;
+    __sync_fetch_and_add(&val->calls, tls_sample_rate > 1 ? tls_sample_rate : 1);
+    if (!val->resolved) {
+        val->resolved = 1;
+        val->path_id = tls_module_path_id(&key);
+    }
+    return 0;
+}
+
+/**
+ * @brief 跟踪TLS慢路径
+ *
+ * 附加到tls_get_addr_tail（线程首次访问模块时分配TLS块），找不到时附加到
+ * __tls_get_addr_slow（x86-64，同时包含dtv的代际更新），参数都以tls_index开头
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_tls_slow, void *ti)
+{
+    if (!is_target_process())
+        return 0;
+
+    struct tls_slow_args args = {};
+    if (!ti || bpf_probe_read_user(&args.modid, sizeof(args.modid), ti))
+        return 0;
+    args.start_ts = bpf_ktime_get_ns();
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    bpf_map_update_elem(&tls_slow_args, &tid, &args, BPF_ANY);
+    return 0;
+}
+
+/**
+ * @brief 跟踪TLS慢路径返回，按模块和线程分别累计
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_tls_slow_ret)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u64 pid_tgid = bpf_get_current_pid_tgid();
+    __u32 tid = (__u32)pid_tgid;
+    struct tls_slow_args *args = bpf_map_lookup_elem(&tls_slow_args, &tid);
+    if (!args)
+        return 0;
+
+    __u64 delta_ns = bpf_ktime_get_ns() - args->start_ts;
+    struct tls_key key = {};
+    key.tgid = pid_tgid >> 32;
+    key.modid = args->modid;
+    bpf_map_delete_elem(&tls_slow_args, &tid);
+
+    struct tls_value *val = lookup_tls_value(&key);
+    if (val) {
+        if (!val->resolved) {
+            val->resolved = 1;
+            val->path_id = tls_module_path_id(&key);
+        }
+        __sync_fetch_and_add(&val->slow_calls, 1);
+        __sync_fetch_and_add(&val->slow_ns, delta_ns);
+    }
+
+    struct tls_thread_key thread = {};
+    thread.tgid = key.tgid;
+    thread.tid = tid;
+    struct tls_thread_value *stats = bpf_map_lookup_elem(&tls_threads, &thread);
+    if (!stats) {
+        struct tls_thread_value zero = {};
+        bpf_map_update_elem(&tls_threads, &thread, &zero, BPF_NOEXIST);
+        stats = bpf_map_lookup_elem(&tls_threads, &thread);
+        if (!stats)
+            return 0;
+    }
+    __sync_fetch_and_add(&stats->slow_calls, 1);
+    __sync_fetch_and_add(&stats->slow_ns, delta_ns);
+    return 0;
+}
+
+/**
+ * @brief 是否统计重定位和IFUNC解析耗时（--reloc-profile）
+ */
+const volatile bool reloc_profile = false;
+
+#define MAX_DYNAMIC_ENTRIES 96    ///< 读取动态段时最多检查的表项数
+
+#define DT_PLTRELSZ     2
+#define DT_RELASZ       8
+#define DT_RELAENT      9
+#define DT_RELSZ        18
+#define DT_RELENT       19
+#define DT_PLTREL       20
+#define DT_RELA         7
+#define DT_RELACOUNT    0x6ffffff9
+#define DT_RELCOUNT     0x6ffffffa
+
+/**
+ * @brief 进行中的重定位
+ */
+struct reloc_args {
+    __u64 start_ts;         ///< 进入_dl_relocate_object的时间戳（纳秒）
+    __u64 path_id;          ///< 被重定位对象的路径编号
+    __u64 ifunc_start;      ///< 当前IFUNC解析函数的开始时间戳，0表示不在解析函数中
+    __u64 ifunc_ns;         ///< 本次重定位中IFUNC解析函数的累计耗时
+    __u32 ifunc_calls;      ///< 本次重定位中IFUNC解析函数的调用次数
+    __u32 relocs;           ///< 动态段中的重定位项数
+    __u32 relative_relocs;  ///< 相对重定位数
+    __u32 plt_relocs;       ///< PLT重定位项数
+};
 
 /**
- * @brief 目标进程名存储
- * 存储要监控的目标进程名
+ * @brief 进行中的重定位，以线程ID为键
  */
 struct {
-    __uint(type, BPF_MAP_TYPE_ARRAY);
-    __uint(max_entries, 1);
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
     __type(key, __u32);
-    __type(value, char[16]);
-} target_process SEC(".maps");
+    __type(value, struct reloc_args);
+} reloc_args SEC(".maps");
 
 /**
- * @brief 监控程序名存储
- * 存储监控程序自己的名字，用于避免自我监控
+ * @brief 按库路径编号统计的重定位开销
  */
 struct {
-    __uint(type, BPF_MAP_TYPE_ARRAY);
-    __uint(max_entries, 1);
-    __type(key, __u32);
-    __type(value, char[16]);
-} monitor_process SEC(".maps");
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, __u64);
+    __type(value, struct reloc_value);
+} reloc_stats SEC(".maps");
 
 /**
- * @brief 检查当前进程是否是目标进程
- * 
- * 通过以下步骤确定是否需要监控当前进程：
- * 1. 获取当前进程名
- * 2. 检查是否是监控程序自己（如果是则不监控）
- * 3. 检查是否有指定的目标进程
- * 4. 如果有目标进程，则比较进程名
- * 
- * @return true 如果当前进程需要被监控
- * @return false 如果当前进程不需要被监控
+ * @brief 从对象的动态段读取重定位项数
+ *
+ * RELR压缩的相对重定位（DT_RELR）无法由大小直接换算为项数，不计入
  */
-static inline bool is_target_process(void)
+static __always_inline void read_reloc_counts(__u64 l_ld, struct reloc_args *args)
 {
-    char comm[16];
-    bpf_get_current_comm(&comm, sizeof(comm));
-    
-    // 首先检查是否是监控程序自己
-    __u32 key = 0;
-    char *monitor = bpf_map_lookup_elem(&monitor_process, &key);
-    if (monitor && monitor[0] != '\0') {
-        // 比较是否是监控程序
-        for (int i = 0; i < sizeof(comm); i++) {
-            if (monitor[i] != comm[i]) {
-                break;
-            }
-            if (monitor[i] == '\0') {
-                return false;  // 是监控程序自己，不监控
-            }
-        }
-    }
-    
-    // 获取目标进程名
-    char *target = bpf_map_lookup_elem(&target_process, &key);
-    
-    // 如果没有设置目标进程名，则监控所有进程
-    if (!target || target[0] == '\0') {
-        return true;
-    }
-    
-    // 比较进程名
-    for (int i = 0; i < sizeof(comm); i++) {
-        if (target[i] != comm[i]) {
-            return false;
-        }
-        if (target[i] == '\0') {
+    __u64 rela_sz = 0, rela_ent = 24, rel_sz = 0, rel_ent = 16, plt_sz = 0, plt_type = DT_RELA;
+
+    for (int i = 0; i < MAX_DYNAMIC_ENTRIES; i++) {
+        __u64 dyn[2] = {};
+        if (bpf_probe_read_user(dyn, sizeof(dyn), (void *)(l_ld + i * sizeof(dyn))) || dyn[0] == 0)
             break;
+        switch (dyn[0]) {
+            case DT_RELASZ: rela_sz = dyn[1]; break;
+            case DT_RELAENT: rela_ent = dyn[1]; break;
+            case DT_RELSZ: rel_sz = dyn[1]; break;
+            case DT_RELENT: rel_ent = dyn[1]; break;
+            case DT_PLTRELSZ: plt_sz = dyn[1]; break;
+            case DT_PLTREL: plt_type = dyn[1]; break;
+            case DT_RELACOUNT:
+            case DT_RELCOUNT: args->relative_relocs += dyn[1]; break;
         }
     }
-    return true;
+
+    if (rela_ent)
+        args->relocs += rela_sz / rela_ent;
+    if (rel_ent)
+        args->relocs += rel_sz / rel_ent;
+    __u64 plt_ent = plt_type == DT_RELA ? rela_ent : rel_ent;
+    if (plt_ent)
+        args->plt_relocs = plt_sz / plt_ent;
 }
 
 /**
- * @brief 跟踪dlopen函数调用
- * 
- * 当进程调用dlopen加载动态库时触发此探针
- * 记录库路径和加载标志，并发送事件
+ * @brief 跟踪ld.so对一个对象的重定位
+ *
+ * _dl_relocate_object是ld.so的内部函数，启动时和dlopen时对每个新对象调用一次，
+ * 记录对象和动态段中的重定位项数，IFUNC解析函数的耗时累加到本次重定位上
  */
-SEC("uprobe//usr/lib/libc.so.6:dlopen")
-int BPF_KPROBE(trace_dlopen, const char *filename, int flags)
+SEC("uprobe")
+int BPF_KPROBE(trace_relocate_object, void *link_map)
 {
     if (!is_target_process())
         return 0;
 
-    struct event e = {};
-    char path[64];
-    
-    // 填充事件基本信息
-    e.timestamp = bpf_ktime_get_ns();
-    e.pid = bpf_get_current_pid_tgid() >> 32;
-    e.uid = bpf_get_current_uid_gid() & 0xFFFFFFFF;
-    bpf_get_current_comm(&e.comm, sizeof(e.comm));
-    
-    // 读取并保存库路径
-    bpf_probe_read_user_str(path, sizeof(path), filename);
-    __u32 key = 0;
-    bpf_map_update_elem(&temp_path, &key, path, BPF_ANY);
-    
-    bpf_probe_read_user_str(e.lib_path, sizeof(e.lib_path), filename);
-    e.event_type = 1;  // 加载事件
-    e.flags = flags;
-    
-    // 发送事件到用户空间
-    bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, &e, sizeof(e));
+    struct reloc_args args = {};
+    struct user_link_map map = {};
+    if (!link_map || bpf_probe_read_user(&map, sizeof(map), link_map))
+        return 0;
+    args.path_id = object_path_id((__u64)link_map);
+    if (map.l_ld)
+        read_reloc_counts(map.l_ld, &args);
+    args.start_ts = bpf_ktime_get_ns();
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    bpf_map_update_elem(&reloc_args, &tid, &args, BPF_ANY);
     return 0;
 }
 
 /**
- * @brief 跟踪dlopen函数返回
- * 
- * 当dlopen返回时触发此探针
- * 记录加载的库句柄，并更新句柄到路径的映射
+ * @brief 跟踪重定位返回，按库累计
  */
-SEC("uretprobe//usr/lib/libc.so.6:dlopen")
-int BPF_KRETPROBE(trace_dlopen_ret, void *retval)
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_relocate_object_ret)
 {
     if (!is_target_process())
         return 0;
 
-    __u64 handle = (__u64)retval;
-    struct event e = {};
-    
-    // 填充事件基本信息
-    e.timestamp = bpf_ktime_get_ns();
-    e.pid = bpf_get_current_pid_tgid() >> 32;
-    e.uid = bpf_get_current_uid_gid() & 0xFFFFFFFF;
-    bpf_get_current_comm(&e.comm, sizeof(e.comm));
-    
-    e.lib_addr = handle;
-    e.event_type = 1;  // 加载事件
-
-    // 从临时map中获取路径并更新句柄映射
-    __u32 key = 0;
-    char *temp = bpf_map_lookup_elem(&temp_path, &key);
-    if (temp && handle != 0) {
-        char path[64];
-        bpf_probe_read_kernel_str(path, sizeof(path), temp);
-        bpf_map_update_elem(&handle_to_path, &handle, path, BPF_ANY);
-        __builtin_memcpy(e.lib_path, path, sizeof(path));
-        bpf_map_delete_elem(&temp_path, &key);
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct reloc_args *args = bpf_map_lookup_elem(&reloc_args, &tid);
+    if (!args)
+        return 0;
+
+    __u64 delta_ns = bpf_ktime_get_ns() - args->start_ts;
+    struct reloc_value *val = bpf_map_lookup_elem(&reloc_stats, &args->path_id);
+    if (!val) {
+        struct reloc_value zero = {};
+        bpf_map_update_elem(&reloc_stats, &args->path_id, &zero, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&reloc_stats, &args->path_id);
+    }
+    if (val) {
+        __sync_fetch_and_add(&val->loads, 1);
+        __sync_fetch_and_add(&val->total_ns, delta_ns);
+        __sync_fetch_and_add(&val->ifunc_calls, args->ifunc_calls);
+        __sync_fetch_and_add(&val->ifunc_ns, args->ifunc_ns);
+        atomic_max_u64(&val->max_ns, delta_ns);
+        // 重定位项数是库的静态属性，每次加载都相同，直接覆盖
+        val->relocs = args->relocs;
+        val->relative_relocs = args->relative_relocs;
+        val->plt_relocs = args->plt_relocs;
     }
-    
-    // 发送事件到用户空间
-    bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, &e, sizeof(e));
+
+    bpf_map_delete_elem(&reloc_args, &tid);
     return 0;
 }
 
 /**
- * @brief 跟踪dlclose函数调用
- * 
- * 当进程调用dlclose卸载动态库时触发此探针
- * 记录被卸载的库句柄和路径
+ * @brief 跟踪IFUNC解析函数
+ *
+ * 用户空间从C库等的符号表中找出STT_GNU_IFUNC符号，其符号值即解析函数，
+ * 按文件偏移附加。只统计重定位期间的调用，延迟绑定时的解析不计入
  */
-SEC("uprobe//usr/lib/libc.so.6:dlclose")
-int BPF_KPROBE(trace_dlclose, void *handle)
+SEC("uprobe")
+int BPF_KPROBE(trace_ifunc_resolver)
+{
+    if (!is_target_process())
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct reloc_args *args = bpf_map_lookup_elem(&reloc_args, &tid);
+    if (args)
+        args->ifunc_start = bpf_ktime_get_ns();
+    return 0;
+}
+
+/**
+ * @brief 跟踪IFUNC解析函数返回，耗时累加到当前重定位
+ */
+SEC("uretprobe")
+int BPF_KRETPROBE(trace_ifunc_resolver_ret)
 {
     if (!is_target_process())
         return 0;
 
-    struct event e = {};
-    
-    // 填充事件基本信息
-    e.timestamp = bpf_ktime_get_ns();
-    e.pid = bpf_get_current_pid_tgid() >> 32;
-    e.uid = bpf_get_current_uid_gid() & 0xFFFFFFFF;
-    bpf_get_current_comm(&e.comm, sizeof(e.comm));
-    
-    e.lib_addr = (__u64)handle;
-    e.event_type = 2;  // 卸载事件
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct reloc_args *args = bpf_map_lookup_elem(&reloc_args, &tid);
+    if (!args || !args->ifunc_start)
+        return 0;
+
+    args->ifunc_ns += bpf_ktime_get_ns() - args->ifunc_start;
+    args->ifunc_calls++;
+    args->ifunc_start = 0;
+    return 0;
+}
+
+/**
+ * @brief 系统调用号到分类的映射
+ */
+static __always_inline __u32 classify_syscall(long id)
+{
+    switch (id) {
+#if defined(__TARGET_ARCH_x86)
+        case 2:     // open
+        case 257:   // openat
+#elif defined(__TARGET_ARCH_arm64)
+        case 56:    // openat
+#endif
+        case 437:   // openat2
+            return SC_OPEN;
+#if defined(__TARGET_ARCH_x86)
+        case 0:     // read
+        case 17:    // pread64
+#elif defined(__TARGET_ARCH_arm64)
+        case 63:    // read
+        case 67:    // pread64
+#endif
+            return SC_READ;
+#if defined(__TARGET_ARCH_x86)
+        case 9:
+#elif defined(__TARGET_ARCH_arm64)
+        case 222:
+#endif
+            return SC_MMAP;
+#if defined(__TARGET_ARCH_x86)
+        case 10:
+#elif defined(__TARGET_ARCH_arm64)
+        case 226:
+#endif
+            return SC_MPROTECT;
+#if defined(__TARGET_ARCH_x86)
+        case 11:
+#elif defined(__TARGET_ARCH_arm64)
+        case 215:
+#endif
+            return SC_MUNMAP;
+#if defined(__TARGET_ARCH_x86)
+        case 5:     // fstat
+        case 262:   // newfstatat
+        case 332:   // statx
+#elif defined(__TARGET_ARCH_arm64)
+        case 79:    // newfstatat
+        case 80:    // fstat
+        case 291:   // statx
+#endif
+            return SC_STAT;
+#if defined(__TARGET_ARCH_x86)
+        case 3:
+#elif defined(__TARGET_ARCH_arm64)
+        case 57:
+#endif
+            return SC_CLOSE;
+        default:
+            return SC_OTHER;
+    }
+}
+
+/**
+ * @brief 处理库搜索中open/openat的返回
+ *
+ * 失败时记为一次探测（非聚合模式下输出探测事件）；成功时把此前累计的
+ * 探测记到打开的路径上，作为该库“命中前的探测次数”
+ */
+static __always_inline void finish_search_open(void *ctx, __u32 tid, long ret)
+{
+    struct search_state *search = bpf_map_lookup_elem(&search_threads, &tid);
+    if (!search || !search->open_start)
+        return;
+
+    __u64 start = search->open_start;
+    __u64 delta_ns = bpf_ktime_get_ns() - start;
+    __u64 path = search->open_path;
+    search->open_start = 0;
+
+    if (ret < 0) {
+        search->probes++;
+        search->total_probes++;
+        search->probe_ns += delta_ns;
+        if (aggregate_mode)
+            return;
+
+        struct event *e = init_var_event(EVENT_SEARCH_PROBE);
+        if (!e)
+            return;
+        e->timestamp = start;
+        e->duration_ns = delta_ns;
+        e->flags = search->context;
+        e->result = -ret;
+        append_path(e, (void *)path);
+        struct dlopen_args *args = current_dlopen(tid);
+        if (args && args->filename)
+            append_symbol(e, (void *)args->filename);
+        output_event(e);
+        return;
+    }
+
+    __u32 probes = search->probes;
+    __u64 probe_ns = search->probe_ns;
+    search->probes = 0;
+    search->probe_ns = 0;
+
+    __u64 path_id = intern_user_path((const void *)path);
+    if (!path_id)
+        return;
+    struct search_value *val = bpf_map_lookup_elem(&search_stats, &path_id);
+    if (!val) {
+        struct search_value zero = {};
+        bpf_map_update_elem(&search_stats, &path_id, &zero, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&search_stats, &path_id);
+        if (!val)
+            return;
+    }
+    __sync_fetch_and_add(&val->hits, 1);
+    __sync_fetch_and_add(&val->probes, probes);
+    __sync_fetch_and_add(&val->probe_ns, probe_ns);
+    atomic_max_u32(&val->max_probes, probes);
+}
+
+/**
+ * @brief glibc的struct dl_exception（见<dlfcn.h>内部定义），动态链接器的错误
+ */
+struct user_dl_exception {
+    __u64 objname;      ///< 出错的对象名
+    __u64 errstring;    ///< 错误信息
+};
+
+/**
+ * @brief 跟踪动态链接器抛出的错误
+ *
+ * _dl_signal_exception是ld.so导出的GLIBC_PRIVATE函数，dlopen失败时
+ * dlerror返回的信息即来自这里。只输出正在dlopen中的线程的错误，
+ * 用户空间把它并入随后的dlopen失败事件
+ */
+SEC("uprobe")
+int BPF_KPROBE(trace_dl_signal_exception, int errcode, void *exception)
+{
+    if (!is_target_process() || aggregate_mode)
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct user_dl_exception ex = {};
+    if (!bpf_map_lookup_elem(&dlopen_args, &tid) || !exception ||
+        bpf_probe_read_user(&ex, sizeof(ex), exception))
+        return 0;
+
+    struct event *e = init_var_event(EVENT_DLOPEN_ERROR);
+    if (!e)
+        return 0;
+    e->result = errcode;
+    if (ex.objname)
+        append_path(e, (void *)ex.objname);
+    if (ex.errstring)
+        append_symbol(e, (void *)ex.errstring);
+    output_event(e);
+    return 0;
+}
+
+/**
+ * @brief 跟踪系统调用进入
+ *
+ * 只处理dlopen_syscalls或search_threads中有表项（正在dlopen中）的线程，
+ * 记录开始时间、分类和mmap的长度，以及open/openat打开的路径；
+ * 测量锁争用时同时处理futex等待
+ */
+SEC("tp_btf/sys_enter")
+int BPF_PROG(trace_sys_enter, struct pt_regs *regs, long id)
+{
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    __u32 cls = classify_syscall(id);
+
+#if defined(__TARGET_ARCH_x86)
+    if (lock_contention && id == 202)
+        begin_lock_wait(regs);
+#elif defined(__TARGET_ARCH_arm64)
+    if (lock_contention && id == 98)
+        begin_lock_wait(regs);
+#endif
+
+    struct dlopen_syscall_state *state = syscall_profile ? bpf_map_lookup_elem(&dlopen_syscalls, &tid) : NULL;
+    if (state) {
+        state->sys_class = cls;
+        state->sys_arg = cls == SC_MMAP ? PT_REGS_PARM2(regs) : 0;
+        state->sys_start = bpf_ktime_get_ns();
+    }
 
-    // 查找并记录库路径
-    char *path = bpf_map_lookup_elem(&handle_to_path, &e.lib_addr);
-    if (path) {
-        __builtin_memcpy(e.lib_path, path, sizeof(e.lib_path));
-        // 清理句柄映射
-        bpf_map_delete_elem(&handle_to_path, &e.lib_addr);
+    struct search_state *search = search_probes && cls == SC_OPEN ? bpf_map_lookup_elem(&search_threads, &tid) : NULL;
+    if (search) {
+#if defined(__TARGET_ARCH_x86)
+        search->open_path = id == 2 ? PT_REGS_PARM1(regs) : PT_REGS_PARM2(regs);
+#else
+        search->open_path = PT_REGS_PARM2(regs);
+#endif
+        search->open_start = bpf_ktime_get_ns();
     }
-    
-    // 发送事件到用户空间
-    bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, &e, sizeof(e));
     return 0;
 }
 
 /**
- * @brief 跟踪dlclose函数返回
- * 
- * 为避免重复事件，这里不再发送事件
+ * @brief 跟踪系统调用返回，累计到线程的dlopen系统调用统计
  */
-SEC("uretprobe//usr/lib/libc.so.6:dlclose")
-int BPF_KRETPROBE(trace_dlclose_ret, int retval)
+SEC("tp_btf/sys_exit")
+int BPF_PROG(trace_sys_exit, struct pt_regs *regs, long ret)
 {
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    if (search_probes)
+        finish_search_open(ctx, tid, ret);
+    if (lock_contention && is_futex_syscall(syscall_nr(regs)))
+        end_lock_wait(tid);
+
+    struct dlopen_syscall_state *state = syscall_profile ? bpf_map_lookup_elem(&dlopen_syscalls, &tid) : NULL;
+    if (!state || !state->sys_start)
+        return 0;
+
+    __u64 delta_ns = bpf_ktime_get_ns() - state->sys_start;
+    __u32 cls = state->sys_class;
+    state->sys_start = 0;
+    if (cls >= SC_MAX)
+        return 0;
+
+    state->stats.count[cls]++;
+    state->stats.time_ns[cls] += delta_ns;
+    state->stats.total_ns += delta_ns;
+    if (cls == SC_READ && ret > 0)
+        state->stats.bytes_read += ret;
+    else if (cls == SC_MMAP && ret >= 0)
+        state->stats.bytes_mapped += state->sys_arg;
     return 0;
 }
 
 /**
- * @brief 跟踪dlsym函数调用
- * 
- * 当进程调用dlsym解析符号时触发此探针
- * 记录库句柄和符号名称
+ * @brief 缺页处理中的线程状态
  */
-SEC("uprobe//usr/lib/libc.so.6:dlsym")
-int BPF_KPROBE(trace_dlsym, void *handle, const char *symbol)
+struct fault_thread {
+    __u64 start_ts;     ///< 缺页处理开始的时间戳
+    __u64 path_id;      ///< 缺页所在的库
+    __u32 cache_pages;  ///< 处理期间加入页缓存的页数（页缓存未命中）
+    __u32 pad;
+};
+
+/**
+ * @brief 正在处理目标库缺页的线程，以线程ID为键
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct fault_thread);
+} fault_threads SEC(".maps");
+
+/**
+ * @brief 跟踪缺页处理开始
+ *
+ * 只处理落在已记录对象的映射文件中、且仍在加载后时间窗口内的缺页
+ */
+SEC("fentry/handle_mm_fault")
+int BPF_PROG(trace_fault_entry, struct vm_area_struct *vma, unsigned long address, unsigned int flags)
 {
     if (!is_target_process())
         return 0;
 
-    struct event e = {};
-    
-    // 填充事件基本信息
-    e.timestamp = bpf_ktime_get_ns();
-    e.pid = bpf_get_current_pid_tgid() >> 32;
-    e.uid = bpf_get_current_uid_gid() & 0xFFFFFFFF;
-    bpf_get_current_comm(&e.comm, sizeof(e.comm));
-    
-    e.lib_addr = (__u64)handle;
-    bpf_probe_read_user_str(e.symbol_name, sizeof(e.symbol_name), symbol);
-    e.event_type = 3;  // 符号解析事件
+    struct file *file = vma->vm_file;
+    if (!file)
+        return 0;
+
+    struct fault_object_key key = {};
+    key.tgid = bpf_get_current_pid_tgid() >> 32;
+    key.inode = (__u64)file->f_inode;
+    struct fault_object *obj = bpf_map_lookup_elem(&fault_objects, &key);
+    if (!obj)
+        return 0;
+
+    __u64 now = bpf_ktime_get_ns();
+    if (fault_window_ns && now - obj->load_ts > fault_window_ns)
+        return 0;
+
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct fault_thread state = {};
+    state.start_ts = now;
+    state.path_id = obj->path_id;
+    bpf_map_update_elem(&fault_threads, &tid, &state, BPF_ANY);
+    return 0;
+}
+
+/**
+ * @brief 跟踪缺页处理结束
+ *
+ * 与内核的mm_account_fault一致：返回VM_FAULT_RETRY的尝试不单独计数，
+ * 其耗时计入重试后的那次缺页；带VM_FAULT_MAJOR或FAULT_FLAG_TRIED的为主缺页
+ */
+SEC("fexit/handle_mm_fault")
+int BPF_PROG(trace_fault_exit, struct vm_area_struct *vma, unsigned long address, unsigned int flags,
+             struct pt_regs *regs, vm_fault_t ret)
+{
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct fault_thread *state = bpf_map_lookup_elem(&fault_threads, &tid);
+    if (!state)
+        return 0;
+
+    __u64 delta_ns = bpf_ktime_get_ns() - state->start_ts;
+    __u64 path_id = state->path_id;
+    __u32 cache_pages = state->cache_pages;
+    bpf_map_delete_elem(&fault_threads, &tid);
 
-    // 查找并记录库路径
-    char *path = bpf_map_lookup_elem(&handle_to_path, &e.lib_addr);
-    if (path) {
-        __builtin_memcpy(e.lib_path, path, sizeof(e.lib_path));
+    struct fault_value *val = lookup_fault_value(path_id);
+    if (!val)
+        return 0;
+    __sync_fetch_and_add(&val->cache_pages, cache_pages);
+    if (ret & VM_FAULT_RETRY) {
+        __sync_fetch_and_add(&val->retry_ns, delta_ns);
+        return 0;
+    }
+    if ((ret & VM_FAULT_MAJOR) || (flags & FAULT_FLAG_TRIED)) {
+        __sync_fetch_and_add(&val->major, 1);
+        __sync_fetch_and_add(&val->major_ns, delta_ns);
+    } else {
+        __sync_fetch_and_add(&val->minor, 1);
+        __sync_fetch_and_add(&val->minor_ns, delta_ns);
     }
-    
-    // 发送事件到用户空间
-    bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, &e, sizeof(e));
     return 0;
 }
 
 /**
- * @brief 跟踪dlsym函数返回
- * 
- * 当dlsym返回时触发此探针
- * 记录解析到的符号地址
+ * @brief 跟踪页加入页缓存
+ *
+ * 缺页处理期间加入页缓存的页（含预读的页）说明该库的文件页未命中缓存，
+ * 需要从磁盘读取
  */
-SEC("uretprobe//usr/lib/libc.so.6:dlsym")
-int BPF_KRETPROBE(trace_dlsym_ret, void *retval)
+SEC("tp_btf/mm_filemap_add_to_page_cache")
+int BPF_PROG(trace_page_cache_add, struct folio *folio)
 {
-    if (!is_target_process())
+    __u32 tid = (__u32)bpf_get_current_pid_tgid();
+    struct fault_thread *state = bpf_map_lookup_elem(&fault_threads, &tid);
+    if (state)
+        state->cache_pages++;
+    return 0;
+}
+
+/**
+ * @brief 被切出的线程的off-CPU状态
+ */
+struct offcpu_thread {
+    __u64 start_ts;         ///< 切出的时间戳
+    struct offcpu_key key;  ///< 统计键
+};
+
+/**
+ * @brief 在dl*调用中被切出、尚未切回的线程，以线程ID为键
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 10240);
+    __type(key, __u32);
+    __type(value, struct offcpu_thread);
+} offcpu_threads SEC(".maps");
+
+/**
+ * @brief 按（进程, 操作, 库, 原因, 栈）统计的off-CPU时间
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_HASH);
+    __uint(max_entries, 16384);
+    __type(key, struct offcpu_key);
+    __type(value, struct offcpu_value);
+} offcpu_stats SEC(".maps");
+
+/**
+ * @brief 5.14之前内核中task_struct的状态字段，当时名为state
+ */
+struct task_struct___old {
+    long state;
+} __attribute__((preserve_access_index));
+
+/**
+ * @brief 读取任务的调度状态，0表示可运行，按内核中实际存在的字段名读取
+ */
+static __always_inline long task_state(struct task_struct *task)
+{
+    if (bpf_core_field_exists(task->__state))
+        return BPF_CORE_READ(task, __state);
+    struct task_struct___old *old = (void *)task;
+    return BPF_CORE_READ(old, state);
+}
+
+/**
+ * @brief 判断线程被切出的原因
+ *
+ * 仍处于可运行状态的为抢占；io_schedule设置的in_iowait表示等待块设备I/O
+ * （如缺页读盘、页缓存上锁）；阻塞在futex系统调用中的多为等待
+ * dl_load_lock等用户态锁；其余（如管道、网络文件系统）归为其他
+ */
+static __always_inline __u32 offcpu_reason(struct task_struct *prev, bool preempt)
+{
+    if (preempt || task_state(prev) == 0)
+        return OFFCPU_PREEMPT;
+    if (BPF_CORE_READ_BITFIELD(prev, in_iowait))
+        return OFFCPU_IO;
+
+    struct pt_regs *regs = (struct pt_regs *)bpf_task_pt_regs(prev);
+    return is_futex_syscall(syscall_nr(regs)) ? OFFCPU_FUTEX : OFFCPU_OTHER;
+}
+
+/**
+ * @brief 跟踪上下文切换
+ *
+ * 切出时prev仍是当前任务：若它正处于dl*调用中（loader_ops有表项），
+ * 记录切出时间、原因和用户栈；切入时把next此前的离开时间累计到统计中
+ */
+SEC("tp_btf/sched_switch")
+int BPF_PROG(trace_sched_switch, bool preempt, struct task_struct *prev, struct task_struct *next)
+{
+    __u64 now = bpf_ktime_get_ns();
+
+    __u32 tid = prev->pid;
+    struct loader_op_state *op = bpf_map_lookup_elem(&loader_ops, &tid);
+    if (op) {
+        struct offcpu_thread state = {};
+        state.start_ts = now;
+        state.key.tgid = prev->tgid;
+        state.key.op = op->op;
+        state.key.path_id = op->path_id;
+        state.key.reason = offcpu_reason(prev, preempt);
+        state.key.stack_id = bpf_get_stackid(ctx, &user_stacks, BPF_F_USER_STACK | BPF_F_REUSE_STACKID);
+        bpf_map_update_elem(&offcpu_threads, &tid, &state, BPF_ANY);
+    }
+
+    tid = next->pid;
+    struct offcpu_thread *state = bpf_map_lookup_elem(&offcpu_threads, &tid);
+    if (!state)
         return 0;
 
-    struct event e = {};
-    
-    // 填充事件基本信息
-    e.timestamp = bpf_ktime_get_ns();
-    e.pid = bpf_get_current_pid_tgid() >> 32;
-    e.uid = bpf_get_current_uid_gid() & 0xFFFFFFFF;
-    bpf_get_current_comm(&e.comm, sizeof(e.comm));
-    
-    e.symbol_addr = (__u64)retval;
-    e.event_type = 3;  // 符号解析事件
-    
-    // 发送事件到用户空间
-    bpf_perf_event_output(ctx, &events, BPF_F_CURRENT_CPU, &e, sizeof(e));
-    return 0;
-}
\ No newline at end of file
+    __u64 delta_ns = now - state->start_ts;
+    struct offcpu_key key = state->key;
+    bpf_map_delete_elem(&offcpu_threads, &tid);
+
+    struct offcpu_value *val = bpf_map_lookup_elem(&offcpu_stats, &key);
+    if (!val) {
+        struct offcpu_value zero = {};
+        bpf_map_update_elem(&offcpu_stats, &key, &zero, BPF_NOEXIST);
+        val = bpf_map_lookup_elem(&offcpu_stats, &key);
+        if (!val)
+            return 0;
+    }
+    __sync_fetch_and_add(&val->count, 1);
+    __sync_fetch_and_add(&val->total_ns, delta_ns);
+    atomic_max_u64(&val->max_ns, delta_ns);
+    return 0;
+}
+
+/**
+ * @brief 释放退出线程遗留的入口状态
+ *
+ * 线程在dl*调用、构造函数或动态链接器阶段中途退出（pthread_exit、exit、被信号终止）时
+ * 返回探针不会触发，以线程ID为键的表项需要在这里删除，否则会一直占用表项直至表满，
+ * 线程ID复用后还会被新线程误认为嵌套调用
+ */
+static __always_inline void release_thread_state(__u32 tid, __u32 tgid)
+{
+    bpf_map_delete_elem(&dlopen_args, &tid);
+    bpf_map_delete_elem(&dlsym_args, &tid);
+    bpf_map_delete_elem(&dlclose_args, &tid);
+    bpf_map_delete_elem(&init_frames, &tid);
+    bpf_map_delete_elem(&api_frames, &tid);
+    for (__u32 phase = 0; phase < RTLD_PHASE_MAX; phase++) {
+        __u64 key = ((__u64)tid << 32) | phase;
+        bpf_map_delete_elem(&rtld_phase_start, &key);
+    }
+
+    if (syscall_profile)
+        bpf_map_delete_elem(&dlopen_syscalls, &tid);
+    if (search_probes)
+        bpf_map_delete_elem(&search_threads, &tid);
+    if (lookup_profile || lazy_binding)
+        bpf_map_delete_elem(&sym_lookup_args, &tid);
+    if (lazy_binding)
+        bpf_map_delete_elem(&fixup_args, &tid);
+    if (tls_profile)
+        bpf_map_delete_elem(&tls_slow_args, &tid);
+    if (reloc_profile)
+        bpf_map_delete_elem(&reloc_args, &tid);
+    if (fault_profile)
+        bpf_map_delete_elem(&fault_threads, &tid);
+    if (lock_contention)
+        bpf_map_delete_elem(&lock_waits, &tid);
+    if (offcpu_profile)
+        bpf_map_delete_elem(&offcpu_threads, &tid);
+
+    if (lock_contention || offcpu_profile) {
+        struct loader_op_state *state = bpf_map_lookup_elem(&loader_ops, &tid);
+        if (state && state->vtid) {
+            struct vtid_key key = { .tgid = tgid, .vtid = state->vtid };
+            bpf_map_delete_elem(&loader_op_vtids, &key);
+        }
+        bpf_map_delete_elem(&loader_ops, &tid);
+    }
+}
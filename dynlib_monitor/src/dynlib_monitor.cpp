@@ -10,27 +10,81 @@
 #include <iomanip>
 #include <sstream>
 #include <vector>
+#include <algorithm>
+#include <set>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <tuple>
+#include <fstream>
+#include <getopt.h>
+#include <dirent.h>
 #include <dlfcn.h>
-#include <link.h>
+#include <elf.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
 #include <sys/sysinfo.h>
+#include "dynlib_monitor.h"
 #include "dynlib_monitor.skel.h"
+#include "event_format.h"
 
 static volatile bool exiting = false;
+static __u64 received_events = 0;  // 用户空间已处理的事件数
 
-struct event {
-    __u64 timestamp;
-    __u32 pid;
-    __u32 uid;
-    char comm[16];
-    char lib_path[64];
-    __u64 lib_addr;
-    char symbol_name[32];
-    int event_type;
-    int flags;
-    __u64 symbol_addr;
-    int result;
+// 内核侧字符串表（库路径、符号名）在用户空间的缓存，按编号查询
+// 编号是字符串内容的64位FNV-1a哈希，假定不同字符串不会冲突（数万个字符串时冲突概率约1e-10）；
+// 冲突时内核和用户空间都保留先登记的字符串，这里只检测并计数
+struct string_table {
+    int fd = -1;                                    // 内核侧字符串表的map
+    size_t value_size = 0;                          // 字符串表中每项的大小
+    std::unordered_map<__u64, std::string> cache;   // 编号到字符串的缓存
+    __u64 collisions = 0;                           // 检测到的编号冲突次数
+
+    const std::string& resolve(__u64 id);
+    void record(__u64 id, const char *str);
+    void collect();
+};
+
+static string_table lib_paths;     // 库路径字符串表
+static string_table symbol_names;  // 符号名字符串表
+
+// 命令行选项
+struct monitor_options {
+    std::vector<__u32> target_pids;         // 指定监控的进程ID
+    std::vector<std::string> target_comms;  // 指定监控的进程名
+    bool aggregate = false;                 // 是否使用内核聚合模式
+    int interval = 10;                      // 聚合模式下的输出间隔（秒）
+    __u32 max_handles = 65536;              // 句柄映射表的容量
+    bool lookup_profile = false;            // 是否统计ld.so内部的符号查找开销
+    bool lazy_binding = false;              // 是否跟踪延迟绑定
+    __u32 lazy_sample = 1;                  // 延迟绑定事件的采样率（每N次输出一次）
+    bool lock_contention = false;           // 是否测量动态链接器全局锁的争用
+    bool unwind_profile = false;            // 是否统计dl_iterate_phdr/dladdr等遍历接口的开销
+    bool tls_profile = false;               // 是否统计动态TLS访问（__tls_get_addr）
+    __u32 tls_sample = 1;                   // TLS访问计数的采样率（每N次计一次）
+    bool reloc_profile = false;             // 是否统计重定位和IFUNC解析耗时
+    bool namespace_profile = false;         // 是否按dlmopen命名空间统计加载开销和内存
+    bool syscall_profile = false;           // 是否分解每次dlopen期间的系统调用
+    bool search_probes = false;             // 是否记录库搜索时失败的打开尝试
+    bool fault_profile = false;             // 是否按库统计加载后的缺页和页缓存未命中
+    int fault_window = 10;                  // 加载后统计缺页的时间窗口（秒），0表示不限
+    bool offcpu_profile = false;            // 是否统计dl*调用期间的off-CPU时间
+    bool stack_capture = false;             // 是否记录dlopen/dlsym调用点的用户栈
+    std::string folded_path;                // 调用点折叠栈的输出文件，空表示输出到标准输出
 };
 
+// 发现的C库（libc.so.6或旧版glibc的libdl.so.2），编号为下标+1，作为附加cookie
+struct libc_target {
+    std::string path;   // 附加时使用的路径，容器内的库使用/proc/<pid>/root前缀
+    dev_t dev;          // 所在设备
+    ino_t ino;          // inode，同一文件只附加一次
+};
+
+static std::vector<libc_target> libc_targets;
+static std::vector<libc_target> rtld_targets;   // 发现的动态链接器（ld.so）
+static std::vector<libc_target> unwind_targets; // 发现的libgcc_s（异常展开库）
+static std::vector<struct bpf_link*> uprobe_links;
+
 void sig_handler(int sig)
 {
     exiting = true;
@@ -79,180 +133,3064 @@ std::string get_formatted_timestamp(__u64 event_timestamp_ns)
     return ss.str();
 }
 
-std::string get_dlopen_flags(int flags)
+// 事件来自的C库路径，只发现一个C库时返回空串
+static std::string event_libc(const struct event *e)
 {
-    std::vector<std::string> flag_strings;
-    
-    if (flags & RTLD_LAZY) flag_strings.push_back("RTLD_LAZY");
-    if (flags & RTLD_NOW) flag_strings.push_back("RTLD_NOW");
-    if (flags & RTLD_GLOBAL) flag_strings.push_back("RTLD_GLOBAL");
-    if (flags & RTLD_LOCAL) flag_strings.push_back("RTLD_LOCAL");
-    
-    if (flag_strings.empty()) return "0";
-    
-    std::string result = flag_strings[0];
-    for (size_t i = 1; i < flag_strings.size(); i++) {
-        result += " | " + flag_strings[i];
+    __u32 libc_id = event_libc_id(e);
+    if (libc_targets.size() <= 1 || libc_id == 0 || libc_id > libc_targets.size()) {
+        return "";
     }
-    return result;
+    return libc_targets[libc_id - 1].path;
 }
 
-std::string get_lib_real_path(const std::string& lib_name)
+// ELF文件中的函数或数据符号
+struct elf_symbol {
+    Elf64_Addr addr;        // 符号值（虚拟地址）
+    Elf64_Xword size;       // 符号大小
+    unsigned char type;     // STT_FUNC、STT_GNU_IFUNC或STT_OBJECT
+    std::string name;       // 符号名
+};
+
+// ELF文件的程序头和符号（.symtab和.dynsym合并，函数按地址排序）
+struct elf_image {
+    std::vector<Elf64_Phdr> phdrs;
+    std::vector<elf_symbol> symbols;    // 函数符号
+    std::vector<elf_symbol> objects;    // 数据符号
+};
+
+// 读取64位ELF文件的程序头和符号，结果按路径缓存；无法读取时返回NULL
+static const elf_image *load_elf_image(const std::string& path)
 {
-    void* handle = dlopen(lib_name.c_str(), RTLD_LAZY);
-    if (!handle) {
-        return lib_name;
+    static std::map<std::string, std::unique_ptr<elf_image>> images;
+    auto cached = images.find(path);
+    if (cached != images.end()) {
+        return cached->second.get();
+    }
+    std::unique_ptr<elf_image>& image = images[path];
+
+    std::ifstream file(path, std::ios::binary);
+    Elf64_Ehdr ehdr;
+    if (!file.read(reinterpret_cast<char *>(&ehdr), sizeof(ehdr)) ||
+        memcmp(ehdr.e_ident, ELFMAG, SELFMAG) != 0 || ehdr.e_ident[EI_CLASS] != ELFCLASS64 ||
+        ehdr.e_shentsize != sizeof(Elf64_Shdr) || ehdr.e_phentsize != sizeof(Elf64_Phdr)) {
+        return NULL;
     }
 
-    link_map* map;
-    if (dlinfo(handle, RTLD_DI_LINKMAP, &map) == 0) {
-        std::string result = map->l_name;
-        dlclose(handle);
-        return result.empty() ? lib_name : result;
+    std::unique_ptr<elf_image> loaded(new elf_image);
+    std::vector<Elf64_Shdr> shdrs(ehdr.e_shnum);
+    loaded->phdrs.resize(ehdr.e_phnum);
+    file.seekg(ehdr.e_phoff);
+    file.read(reinterpret_cast<char *>(loaded->phdrs.data()), loaded->phdrs.size() * sizeof(Elf64_Phdr));
+    file.seekg(ehdr.e_shoff);
+    file.read(reinterpret_cast<char *>(shdrs.data()), shdrs.size() * sizeof(Elf64_Shdr));
+    if (!file) {
+        return NULL;
     }
 
-    dlclose(handle);
-    return lib_name;
+    for (const Elf64_Shdr& shdr : shdrs) {
+        if ((shdr.sh_type != SHT_DYNSYM && shdr.sh_type != SHT_SYMTAB) ||
+            shdr.sh_entsize != sizeof(Elf64_Sym) || shdr.sh_link >= shdrs.size()) {
+            continue;
+        }
+        const Elf64_Shdr& strtab = shdrs[shdr.sh_link];
+        std::vector<Elf64_Sym> syms(shdr.sh_size / sizeof(Elf64_Sym));
+        std::string strings(strtab.sh_size, '\0');
+        file.seekg(shdr.sh_offset);
+        file.read(reinterpret_cast<char *>(syms.data()), syms.size() * sizeof(Elf64_Sym));
+        file.seekg(strtab.sh_offset);
+        file.read(&strings[0], strings.size());
+        if (!file) {
+            return NULL;
+        }
+        for (const Elf64_Sym& sym : syms) {
+            unsigned char type = ELF64_ST_TYPE(sym.st_info);
+            if ((type != STT_FUNC && type != STT_GNU_IFUNC && type != STT_OBJECT) ||
+                sym.st_shndx == SHN_UNDEF || !sym.st_value || sym.st_name >= strings.size()) {
+                continue;
+            }
+            std::vector<elf_symbol>& list = type == STT_OBJECT ? loaded->objects : loaded->symbols;
+            list.push_back({sym.st_value, sym.st_size, type, strings.c_str() + sym.st_name});
+        }
+    }
+    std::sort(loaded->symbols.begin(), loaded->symbols.end(),
+              [](const elf_symbol& a, const elf_symbol& b) { return a.addr < b.addr; });
+
+    image = std::move(loaded);
+    return image.get();
 }
 
-static void handle_event(void *ctx, int cpu, void *data, __u32 data_size)
+// 读取ELF文件中数据符号的初始内容，符号不存在或不在文件中时返回false
+static bool read_elf_object(const std::string& path, const char *name, void *buf, size_t size)
 {
-    const struct event *e = static_cast<const struct event*>(data);
-    std::string timestamp = get_formatted_timestamp(e->timestamp);
+    const elf_image *image = load_elf_image(path);
+    if (!image) {
+        return false;
+    }
 
-    switch (e->event_type) {
-        case 1: // explicit load
-            if (e->lib_addr == 0) {
-                std::string real_path = get_lib_real_path(e->lib_path);
-                std::cout << "[" << timestamp << "] 事件：动态库加载事件\n"
-                         << "调用函数: dlopen\n"
-                         << "加载库路径: " << real_path << "\n"
-                         << "标志: " << get_dlopen_flags(e->flags) << "\n"
-                         << "进程名: " << e->comm << "\n"
-                         << "进程ID: " << e->pid << "\n" << std::flush;
-            } else {
-                std::cout << "加载基址: 0x" << std::hex << e->lib_addr << std::dec << "\n\n" << std::flush;
+    for (const elf_symbol& sym : image->objects) {
+        if (sym.name != name || sym.size < size) {
+            continue;
+        }
+        for (const Elf64_Phdr& phdr : image->phdrs) {
+            if (phdr.p_type != PT_LOAD || sym.addr < phdr.p_vaddr ||
+                sym.addr + size > phdr.p_vaddr + phdr.p_filesz) {
+                continue;
             }
-            break;
+            std::ifstream file(path, std::ios::binary);
+            file.seekg(sym.addr - phdr.p_vaddr + phdr.p_offset);
+            return static_cast<bool>(file.read(static_cast<char *>(buf), size));
+        }
+    }
+    return false;
+}
 
-        case 2: // unload
-            std::cout << "[" << timestamp << "] 事件：动态库卸载事件\n"
-                     << "调用函数: dlclose\n"
-                     << "目标句柄: 0x" << std::hex << e->lib_addr << std::dec << "\n"
-                     << "卸载库路径: " << (strlen(e->lib_path) > 0 ? e->lib_path : "未知") << "\n"
-                     << "卸载结果: 成功\n"
-                     << "进程名: " << e->comm << "\n"
-                     << "进程ID: " << e->pid << "\n\n" << std::flush;
-            break;
+// 把ELF文件中的文件偏移解析为“函数名+偏移”，找不到时返回空串
+static std::string symbolize_file_offset(const std::string& path, __u64 offset)
+{
+    const elf_image *image = load_elf_image(path);
+    if (!image) {
+        return "";
+    }
 
-        case 3: // symbol resolve
-            if (e->symbol_addr == 0) {
-                std::cout << "[" << timestamp << "] 事件：符号解析事件\n"
-                         << "查找库句柄: 0x" << std::hex << e->lib_addr << std::dec << "\n"
-                         << "请求符号: " << e->symbol_name << "\n";
-                if (strlen(e->lib_path) > 0) {
-                    std::cout << "所属库: " << e->lib_path << "\n";
-                }
-                std::cout << "进程名: " << e->comm << "\n"
-                         << "进程ID: " << e->pid << "\n" << std::flush;
-            } else {
-                // 这里是 dlsym 返回时的事件触发，打印解析地址
-                std::cout << "解析地址: 0x" << std::hex << e->symbol_addr << std::dec << "\n\n" << std::flush;
+    for (const Elf64_Phdr& phdr : image->phdrs) {
+        if (phdr.p_type != PT_LOAD || offset < phdr.p_offset || offset >= phdr.p_offset + phdr.p_filesz) {
+            continue;
+        }
+        Elf64_Addr addr = offset - phdr.p_offset + phdr.p_vaddr;
+        auto it = std::upper_bound(image->symbols.begin(), image->symbols.end(), addr,
+                                   [](Elf64_Addr a, const elf_symbol& sym) { return a < sym.addr; });
+        if (it == image->symbols.begin()) {
+            return "";
+        }
+        --it;
+        if (it->size && addr >= it->addr + it->size) {
+            return "";
+        }
+        std::ostringstream oss;
+        oss << it->name << "+0x" << std::hex << addr - it->addr;
+        return oss.str();
+    }
+    return "";
+}
+
+// 查找进程中地址所在的映射，得到映射的文件路径（匿名映射为空）和文件偏移，
+// 进程已退出或地址未映射时返回false
+static bool find_user_mapping(__u32 pid, __u64 addr, std::string& path, __u64& offset)
+{
+    std::ifstream maps("/proc/" + std::to_string(pid) + "/maps");
+    std::string line;
+    while (std::getline(maps, line)) {
+        unsigned long long start, end, file_offset;
+        int name_pos = 0;
+        if (sscanf(line.c_str(), "%llx-%llx %*s %llx %*s %*s %n", &start, &end, &file_offset, &name_pos) != 3) {
+            continue;
+        }
+        if (addr >= start && addr < end) {
+            offset = addr - start + file_offset;
+            path = name_pos ? line.substr(name_pos) : "";
+            return true;
+        }
+    }
+    return false;
+}
+
+// 把进程中的地址换算为所在映射的文件偏移，进程已退出或地址未映射时返回false
+static bool user_addr_to_offset(__u32 pid, __u64 addr, __u64& offset)
+{
+    std::string path;
+    return find_user_mapping(pid, addr, path, offset);
+}
+
+// 用户栈帧的符号化结果，键为（进程, 地址），同一进程中的相同地址只解析一次
+static std::map<std::pair<__u32, __u64>, std::string> frame_names;
+
+// 符号化进程中的一个地址：找到符号时为“函数 (库名)”，否则为“库名+0x文件偏移”
+static const std::string& symbolize_user_addr(__u32 pid, __u64 addr)
+{
+    auto it = frame_names.find({pid, addr});
+    if (it != frame_names.end()) {
+        return it->second;
+    }
+
+    std::ostringstream oss;
+    std::string path;
+    __u64 offset;
+    if (!find_user_mapping(pid, addr, path, offset) || path.empty() || path[0] != '/') {
+        oss << "0x" << std::hex << addr;
+    } else {
+        std::string name = path.substr(path.rfind('/') + 1);
+        std::string symbol = symbolize_file_offset(path, offset);
+        if (!symbol.empty()) {
+            oss << symbol.substr(0, symbol.rfind('+')) << " (" << name << ")";
+        } else {
+            oss << name << "+0x" << std::hex << offset;
+        }
+    }
+    return frame_names[{pid, addr}] = oss.str();
+}
+
+// 栈编号连续未被读取多少个输出周期后回收
+static constexpr unsigned STACK_IDLE_PERIODS = 3;
+
+// 本输出周期读取过的用户栈编号，以及user_stacks中各栈连续未被读取的周期数
+static std::set<__u32> stack_ids_current;
+static std::map<__u32, unsigned> stack_idle_periods;
+
+// 读取user_stacks中的用户栈并符号化，从最内层的帧开始；栈不存在时返回空
+static std::vector<std::string> read_user_stack(int fd, __u32 pid, __s32 stack_id)
+{
+    std::vector<std::string> frames;
+    __u64 ips[MAX_STACK_DEPTH] = {};
+    __u32 key = stack_id;
+    if (stack_id < 0 || bpf_map_lookup_elem(fd, &key, ips)) {
+        return frames;
+    }
+    stack_ids_current.insert(key);
+    for (int i = 0; i < MAX_STACK_DEPTH && ips[i]; i++) {
+        frames.push_back(symbolize_user_addr(pid, ips[i]));
+    }
+    return frames;
+}
+
+// 回收用户栈：栈表项不会自动删除，写满后新栈只能覆盖旧栈。遍历栈表中的全部
+// 编号而不只是读取过的编号，丢弃事件或未完成的off-CPU记录引用的栈同样会被回收；
+// 连续STACK_IDLE_PERIODS个周期未被读取的栈视为不再引用。引用跨越更多周期
+// （如长时间off-CPU的线程）时，输出的栈为未知
+static void reclaim_user_stacks(struct dynlib_monitor_bpf *skel)
+{
+    int fd = bpf_map__fd(skel->maps.user_stacks);
+    std::vector<__u32> ids;
+    __u32 key, *prev = NULL;
+    while (bpf_map_get_next_key(fd, prev, &key) == 0) {
+        ids.push_back(key);
+        prev = &ids.back();
+    }
+
+    std::map<__u32, unsigned> idle;
+    for (__u32 id : ids) {
+        auto it = stack_idle_periods.find(id);
+        unsigned periods = 0;
+        if (!stack_ids_current.count(id) && it != stack_idle_periods.end()) {
+            periods = it->second + 1;
+        }
+        if (periods >= STACK_IDLE_PERIODS) {
+            bpf_map_delete_elem(fd, &id);
+        } else {
+            idle[id] = periods;
+        }
+    }
+    stack_idle_periods.swap(idle);
+    stack_ids_current.clear();
+}
+
+// user_stacks的文件描述符，未开启调用栈记录时为-1
+static int user_stacks_fd = -1;
+
+// 输出事件调用点的用户栈，从最内层的帧开始，在一行内以“<-”连接
+static void print_event_stack(const struct event *e)
+{
+    if (user_stacks_fd < 0 || e->stack_id < 0) {
+        return;
+    }
+    std::vector<std::string> frames = read_user_stack(user_stacks_fd, e->pid, e->stack_id);
+    std::cout << "调用栈: ";
+    for (size_t i = 0; i < frames.size(); i++) {
+        std::cout << (i ? " <- " : "") << frames[i];
+    }
+    std::cout << (frames.empty() ? "未知\n" : "\n");
+}
+
+// 输出glibc内部调用的来源：推断的触发接口和调用位置，library为请求或所属的库
+static void print_internal_caller(const struct event *e, const std::string& library)
+{
+    __u32 libc_id = event_libc_id(e);
+    std::string caller;
+    __u64 offset;
+    if (e->caller_addr && libc_id && libc_id <= libc_targets.size() &&
+        user_addr_to_offset(e->pid, e->caller_addr, offset)) {
+        caller = symbolize_file_offset(libc_targets[libc_id - 1].path, offset);
+    }
+    std::cout << "调用来源: glibc内部\n";
+    std::string api = internal_dlopen_api(library, caller);
+    if (!api.empty()) {
+        std::cout << "触发接口: " << api << "\n";
+    } else if (e->caller_addr) {
+        std::cout << "触发接口: 未知\n";
+    }
+    if (!caller.empty()) {
+        std::cout << "调用位置: " << caller << "\n";
+    }
+}
+
+// 按（进程, 命名空间）统计的dlopen/dlmopen加载开销
+struct namespace_loads {
+    __u64 loads = 0;        // 加载次数
+    __u64 failures = 0;     // 失败次数
+    __u64 total_ns = 0;     // 累计耗时（纳秒）
+};
+
+static std::map<std::pair<__u32, __s64>, namespace_loads> namespace_load_stats;
+
+// 把一次加载事件计入所在命名空间
+static void record_namespace_load(const struct event *e)
+{
+    namespace_loads& stats = namespace_load_stats[{e->pid, e->lmid}];
+    stats.loads++;
+    stats.total_ns += e->duration_ns;
+    if (e->result != 0) {
+        stats.failures++;
+    }
+}
+
+// 根据编号获取字符串：先查本地缓存，未命中时查询内核侧字符串表
+const std::string& string_table::resolve(__u64 id)
+{
+    static const std::string unknown;
+    if (id == 0) {
+        return unknown;
+    }
+
+    auto it = cache.find(id);
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    std::vector<char> buf(value_size + 1, '\0');
+    if (fd < 0 || bpf_map_lookup_elem(fd, &id, buf.data())) {
+        return unknown;
+    }
+    return cache.emplace(id, buf.data()).first->second;
+}
+
+// 登记随事件携带或从内核读出的字符串；编号已对应不同的字符串时计为冲突
+void string_table::record(__u64 id, const char *str)
+{
+    auto inserted = cache.emplace(id, str);
+    if (!inserted.second && inserted.first->second != str) {
+        if (!collisions++) {
+            std::cerr << "警告: 字符串编号冲突 0x" << std::hex << id << std::dec << ": \""
+                      << inserted.first->second << "\" 与 \"" << str << "\"，后者按前者统计\n";
+        }
+    }
+}
+
+// 将内核字符串表中的条目全部转入用户空间缓存并删除，避免内核侧表满后无法再登记新字符串
+// 先读出内容再删除，之后到达的事件引用这些编号时直接命中缓存；内核侧再次登记同一字符串也无妨
+void string_table::collect()
+{
+    if (fd < 0) {
+        return;
+    }
+
+    // 先取出全部编号再逐个处理，边遍历边删除会使遍历从头开始
+    std::vector<__u64> keys;
+    __u64 key, *prev = NULL;
+    while (bpf_map_get_next_key(fd, prev, &key) == 0) {
+        keys.push_back(key);
+        prev = &keys.back();
+    }
+
+    // 已缓存的编号也读出比较，检测不同字符串的编号冲突
+    std::vector<char> buf(value_size + 1, '\0');
+    for (__u64 id : keys) {
+        if (bpf_map_lookup_elem(fd, &id, buf.data())) {
+            continue;
+        }
+        record(id, buf.data());
+        bpf_map_delete_elem(fd, &id);
+    }
+}
+
+// 输出各场景、各阶段的动态链接器耗时，全为0时不输出
+// 各阶段均为独占耗时（如初始化阶段不含构造函数中dlopen的映射和重定位），可以直接相加
+static void print_phase_totals(const __u64 (*phase_ns)[RTLD_PHASE_MAX])
+{
+    for (int context = 0; context < RTLD_CTX_MAX; context++) {
+        for (int phase = 0; phase < RTLD_PHASE_MAX; phase++) {
+            if (phase_ns[context][phase]) {
+                std::cout << rtld_context_name(context) << " " << rtld_phase_name(phase)
+                          << "阶段耗时: " << format_duration(phase_ns[context][phase]) << "\n";
             }
-            break;
+        }
     }
 }
 
-static void handle_lost_events(void *ctx, int cpu, __u64 lost_cnt)
+// 输出进程退出时的汇总记录；监控结束时仍在运行的进程也以同样格式输出
+static void print_proc_summary(const struct proc_summary_event *e, bool running = false)
 {
-    printf("丢失 %llu 个事件\n", lost_cnt);
+    std::cout << "[" << get_formatted_timestamp(e->timestamp) << "] 事件：进程动态链接汇总"
+              << (running ? "（仍在运行）" : "") << "\n"
+              << "进程名: " << e->comm << "\n"
+              << "进程ID: " << e->pid << "\n";
+    for (int type = EVENT_DLOPEN; type <= EVENT_DLSYM; type++) {
+        std::cout << event_type_name(type) << " 调用: " << e->stats.calls[type]
+                  << "（失败 " << e->stats.failures[type] << "）\n";
+    }
+    std::cout << "总耗时: " << format_duration(e->stats.total_ns) << "\n";
+    print_phase_totals(e->stats.phase_ns);
+    std::cout << "\n" << std::flush;
 }
 
-void print_usage(const char* program_name) {
-    std::cout << "用法: " << program_name << " [进程名]\n"
-              << "如果不指定进程名，将监控除本进程外其他所有进程的动态链接信息。\n"
-              << "如果指定进程名，则只监控该进程的动态链接信息。\n";
+// 输出一次dlopen的系统调用分解，区分I/O、映射和计算的耗时
+static void print_dlopen_syscalls(const struct dlopen_syscalls_event *e)
+{
+    const syscall_breakdown& stats = e->stats;
+    const std::string& path = lib_paths.resolve(e->path_id);
+    std::cout << "[" << get_formatted_timestamp(e->timestamp) << "] 事件：dlopen系统调用事件\n"
+              << "加载库路径: " << (path.empty() ? "未知" : path) << "\n"
+              << "进程名: " << e->comm << "\n"
+              << "进程ID: " << e->pid << "\n"
+              << "线程ID: " << e->tid << "\n";
+    for (int cls = 0; cls < SC_MAX; cls++) {
+        if (stats.count[cls]) {
+            std::cout << dl_syscall_name(cls) << ": " << stats.count[cls] << " 次，"
+                      << format_duration(stats.time_ns[cls]) << "\n";
+        }
+    }
+    std::cout << "读取字节: " << stats.bytes_read << "\n"
+              << "映射字节: " << stats.bytes_mapped << "\n"
+              << "系统调用总耗时: " << format_duration(stats.total_ns) << "\n";
+    if (e->duration_ns >= stats.total_ns) {
+        std::cout << "用户态及其他耗时: " << format_duration(e->duration_ns - stats.total_ns) << "\n";
+    }
+    std::cout << "dlopen耗时: " << format_duration(e->duration_ns) << "\n\n" << std::flush;
 }
 
-int main(int argc, char *argv[])
+// 各线程最近一次dlopen中动态链接器报告的错误，随后的dlopen失败事件取走输出
+static std::map<__u32, std::string> pending_dl_errors;
+
+// 延迟直方图：每个2的幂区间再均分为若干子桶，用于估算分位数
+struct latency_stats {
+    static const int SUB_BUCKETS = 16;
+
+    std::map<__u64, std::pair<__u64, __u64>> buckets;  // 子桶下界 -> (子桶宽度, 次数)
+    __u64 count = 0;
+    __u64 total_ns = 0;
+    __u64 max_ns = 0;
+
+    // 记录一次精确的耗时
+    void add(__u64 ns)
+    {
+        __u64 lower = 0, width = 1;
+        if (ns >= SUB_BUCKETS) {
+            int k = 63 - __builtin_clzll(ns);
+            width = (1ULL << k) / SUB_BUCKETS;
+            lower = ns / width * width;
+        } else {
+            lower = ns;
+        }
+        add_bucket(lower, width, 1, ns);
+        total_ns += ns;
+    }
+
+    // 合并内核侧的log2直方图，区间内的耗时只能按区间上界估计
+    void add_log2_slots(const __u32 *slots, __u64 slot_total_ns)
+    {
+        for (int slot = 0; slot < MAX_SLOTS; slot++) {
+            if (slots[slot]) {
+                add_bucket(1ULL << slot, 1ULL << slot, slots[slot], (2ULL << slot) - 1);
+            }
+        }
+        total_ns += slot_total_ns;
+    }
+
+    // 估算第p分位（0~1）的耗时，返回所在子桶的上界
+    __u64 percentile(double p) const
+    {
+        __u64 target = p * count;
+        if (target >= count) {
+            target = count ? count - 1 : 0;
+        }
+        __u64 seen = 0;
+        for (const auto& bucket : buckets) {
+            seen += bucket.second.second;
+            if (seen > target) {
+                return std::min(bucket.first + bucket.second.first - 1, max_ns);
+            }
+        }
+        return max_ns;
+    }
+
+private:
+    void add_bucket(__u64 lower, __u64 width, __u64 n, __u64 max_value)
+    {
+        auto& bucket = buckets[lower];
+        bucket.first = width;
+        bucket.second += n;
+        count += n;
+        max_ns = std::max(max_ns, max_value);
+    }
+};
+
+static std::map<std::string, latency_stats> library_latency;  // 按库统计的延迟（键为"操作 库路径"）
+static std::map<std::string, latency_stats> symbol_latency;   // 按符号统计的dlsym延迟（键为"库路径 : 符号"）
+
+// 将一次完成的调用计入按库和按符号的延迟统计
+static void record_latency(int event_type, const std::string& path,
+                           const std::string& symbol, __u64 duration_ns)
 {
-    // 设置标准输出为无缓冲模式
-    std::cout.setf(std::ios::unitbuf);
-    
-    struct dynlib_monitor_bpf *skel;
-    struct perf_buffer *pb = NULL;
-    int err = 0;
+    std::string library = std::string(event_type_name(event_type)) + " " +
+                          (path.empty() ? "未知库" : path);
+    library_latency[library].add(duration_ns);
+    if (event_type == EVENT_DLSYM) {
+        symbol_latency[(path.empty() ? "未知库" : path) + " : " + symbol].add(duration_ns);
+    }
+}
 
-    // 设置信号处理
-    signal(SIGINT, sig_handler);
-    signal(SIGTERM, sig_handler);
+// 输出一组延迟统计，按总耗时降序，最多输出limit项
+static void print_latency_table(const char *title, const std::map<std::string, latency_stats>& table,
+                                size_t limit)
+{
+    std::vector<const std::pair<const std::string, latency_stats>*> rows;
+    for (const auto& row : table) {
+        rows.push_back(&row);
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto *a, const auto *b) {
+        return a->second.total_ns > b->second.total_ns;
+    });
 
-    // 检查是否有帮助选项
-    if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)) {
-        print_usage(argv[0]);
-        return 0;
+    std::cout << title << "\n";
+    for (size_t i = 0; i < rows.size() && i < limit; i++) {
+        const latency_stats& stats = rows[i]->second;
+        std::cout << "  " << rows[i]->first << "\n"
+                  << "    调用: " << stats.count
+                  << "  总耗时: " << format_duration(stats.total_ns)
+                  << "  p50: " << format_duration(stats.percentile(0.50))
+                  << "  p99: " << format_duration(stats.percentile(0.99))
+                  << "  最大: " << format_duration(stats.max_ns) << "\n";
+    }
+    if (rows.size() > limit) {
+        std::cout << "  ……其余 " << rows.size() - limit << " 项略\n";
     }
+}
 
-    // 打开和加载 BPF 程序
-    skel = dynlib_monitor_bpf__open_and_load();
-    if (!skel) {
-        std::cerr << "无法打开和加载 BPF 程序" << std::endl;
-        return 1;
+// 输出按库和按符号的延迟报告
+static void print_latency_report()
+{
+    if (library_latency.empty()) {
+        return;
     }
+    std::cout << "\n";
+    print_latency_table("按库统计的调用延迟:", library_latency, 50);
+    if (!symbol_latency.empty()) {
+        print_latency_table("按符号统计的dlsym延迟:", symbol_latency, 20);
+    }
+}
 
-    // 获取当前程序的名字（去掉路径）
-    const char* prog_name = strrchr(argv[0], '/');
-    prog_name = prog_name ? prog_name + 1 : argv[0];
+// 单个进程的动态链接器阶段耗时
+struct process_phases {
+    std::string comm;
+    __u64 phase_ns[RTLD_CTX_MAX][RTLD_PHASE_MAX] = {};
+};
 
-    // 将监控程序自己的名字存储到map中
-    __u32 key = 0;
-    int monitor_map_fd = bpf_map__fd(skel->maps.monitor_process);
-    if (bpf_map_update_elem(monitor_map_fd, &key, prog_name, BPF_ANY)) {
-        std::cerr << "无法设置监控程序名" << std::endl;
-        goto cleanup;
+static std::map<__u32, process_phases> rtld_phases;  // 流式模式下按进程累计的加载阶段耗时
+
+// 输出按进程统计的动态链接器阶段耗时，按总耗时降序
+static void print_rtld_report()
+{
+    if (rtld_phases.empty()) {
+        return;
     }
 
-    // 如果指定了目标进程名，则设置到map中
-    if (argc > 1) {
-        int target_map_fd = bpf_map__fd(skel->maps.target_process);
-        if (bpf_map_update_elem(target_map_fd, &key, argv[1], BPF_ANY)) {
-            std::cerr << "无法设置目标进程名" << std::endl;
-            goto cleanup;
+    std::vector<std::pair<__u64, __u32>> order;
+    for (const auto& entry : rtld_phases) {
+        __u64 total = 0;
+        for (int context = 0; context < RTLD_CTX_MAX; context++) {
+            for (int phase = 0; phase < RTLD_PHASE_MAX; phase++) {
+                total += entry.second.phase_ns[context][phase];
+            }
         }
-        std::cout << "将只监控进程: " << argv[1] << std::endl;
-    } else {
-        std::cout << "将监控所有进程（除了自己）" << std::endl;
+        order.push_back({total, entry.first});
     }
+    std::sort(order.rbegin(), order.rend());
 
-    // 附加 BPF 程序
-    err = dynlib_monitor_bpf__attach(skel);
-    if (err) {
-        std::cerr << "无法附加 BPF 程序" << std::endl;
-        goto cleanup;
+    std::cout << "\n按进程统计的动态链接器阶段耗时:\n";
+    for (size_t i = 0; i < order.size() && i < 20; i++) {
+        const process_phases& phases = rtld_phases[order[i].second];
+        std::cout << "进程 " << order[i].second << "（" << phases.comm << "）"
+                  << " 合计: " << format_duration(order[i].first) << "\n";
+        print_phase_totals(phases.phase_ns);
+    }
+}
+
+static int handle_event(void *ctx, void *data, size_t data_size)
+{
+    // data直接指向环形缓冲区中的记录，原地读取，不做拷贝
+    if (data_size >= sizeof(struct proc_summary_event) &&
+        *static_cast<const int*>(data) == EVENT_PROC_SUMMARY) {
+        received_events++;
+        print_proc_summary(static_cast<const struct proc_summary_event*>(data));
+        return 0;
+    }
+    if (data_size >= sizeof(struct dlopen_syscalls_event) &&
+        *static_cast<const int*>(data) == EVENT_DLOPEN_SYSCALLS) {
+        received_events++;
+        print_dlopen_syscalls(static_cast<const struct dlopen_syscalls_event*>(data));
+        return 0;
     }
 
-    // 设置 perf buffer
-    pb = perf_buffer__new(bpf_map__fd(skel->maps.events), 64,
-                         handle_event, handle_lost_events, NULL, NULL);
-    if (!pb) {
-        err = -1;
-        std::cerr << "无法创建 perf buffer" << std::endl;
-        goto cleanup;
+    const struct event *e = static_cast<const struct event*>(data);
+    if (data_size < sizeof(*e) || data_size < sizeof(*e) + e->path_len + e->symbol_len) {
+        return 0;
     }
+    received_events++;
+    std::string timestamp = get_formatted_timestamp(e->timestamp);
+    std::string libc = event_libc(e);
+    bool internal = e->libc_id & LIBC_ID_INTERNAL;
+    bool variant = e->libc_id & LIBC_ID_VARIANT;
 
-    std::cout << "动态库监控程序已启动...\n" << std::endl;
+    switch (e->event_type) {
+        case EVENT_DLOPEN: {
+            // 首次出现的路径随事件携带，顺便写入缓存供后续事件使用
+            if (e->path_id && e->path_len) {
+                lib_paths.record(e->path_id, event_path(e));
+            }
+            // 请求的库名为空时（如dlopen(NULL)）以实际路径代替
+            const char *requested = e->symbol_len ? event_symbol(e) : event_path(e);
+            record_latency(EVENT_DLOPEN, lib_paths.resolve(e->path_id), "", e->duration_ns);
+            record_namespace_load(e);
+            std::cout << "[" << timestamp << "] 事件：动态库加载事件\n"
+                     << "调用函数: " << (internal ? "__libc_dlopen_mode" : variant ? "dlmopen" : "dlopen") << "\n"
+                     << "加载库路径: " << requested << "\n"
+                     << "标志: " << get_dlopen_flags(e->flags) << "\n";
+            if (variant || e->lmid != 0) {
+                std::cout << "命名空间: " << namespace_name(e->lmid) << "\n";
+            }
+            std::cout << "进程名: " << e->comm << "\n"
+                     << "进程ID: " << e->pid << "\n";
+            if (e->result == 0) {
+                std::cout << "实际路径: " << event_path(e) << "\n"
+                         << "库句柄: 0x" << std::hex << e->lib_addr << "\n"
+                         << "加载基址: 0x" << e->base_addr << std::dec << "\n";
+            } else {
+                std::cout << "加载结果: 失败\n";
+                auto error = pending_dl_errors.find(e->tid);
+                if (error != pending_dl_errors.end()) {
+                    std::cout << "错误信息: " << error->second << "\n";
+                }
+            }
+            pending_dl_errors.erase(e->tid);
+            if (e->search_probes) {
+                std::cout << "搜索探测: " << e->search_probes << " 次失败的打开尝试\n";
+            }
+            if (internal) {
+                print_internal_caller(e, requested);
+            }
+            print_event_stack(e);
+            if (!libc.empty()) {
+                std::cout << "所在C库: " << libc << "\n";
+            }
+            std::cout << "耗时: " << format_duration(e->duration_ns) << "\n\n" << std::flush;
+            break;
+        }
 
-    // 主循环
-    while (!exiting) {
-        err = perf_buffer__poll(pb, 100);
-        if (err < 0 && err != -EINTR) {
-            printf("错误: perf_buffer__poll 返回 %d\n", err);
+        case EVENT_DLCLOSE: {
+            const std::string& path = lib_paths.resolve(e->path_id);
+            record_latency(EVENT_DLCLOSE, path, "", e->duration_ns);
+            std::cout << "[" << timestamp << "] 事件：动态库卸载事件\n"
+                     << "调用函数: dlclose\n"
+                     << "目标句柄: 0x" << std::hex << e->lib_addr << std::dec << "\n"
+                     << "卸载库路径: " << (path.empty() ? "未知" : path) << "\n";
+            if (e->lmid != 0) {
+                std::cout << "命名空间: " << namespace_name(e->lmid) << "\n";
+            }
+            std::cout << "进程名: " << e->comm << "\n"
+                     << "进程ID: " << e->pid << "\n"
+                     << "卸载结果: " << (e->result == 0 ? "成功" : "失败") << "\n";
+            if (internal) {
+                print_internal_caller(e, path);
+            }
+            if (!libc.empty()) {
+                std::cout << "所在C库: " << libc << "\n";
+            }
+            std::cout << "耗时: " << format_duration(e->duration_ns) << "\n\n" << std::flush;
+            break;
+        }
+
+        case EVENT_DLSYM: {
+            const std::string& path = lib_paths.resolve(e->path_id);
+            record_latency(EVENT_DLSYM, path, event_symbol(e), e->duration_ns);
+            std::cout << "[" << timestamp << "] 事件：符号解析事件\n";
+            if (internal || variant) {
+                std::cout << "调用函数: " << (internal ? "__libc_dlsym" : "dlvsym") << "\n";
+            }
+            std::cout << "查找库句柄: 0x" << std::hex << e->lib_addr << std::dec << "\n"
+                     << "请求符号: " << event_symbol(e) << "\n";
+            if (variant && e->path_len) {
+                std::cout << "符号版本: " << event_path(e) << "\n";
+            }
+            if (!path.empty()) {
+                std::cout << "所属库: " << path << "\n";
+            }
+            if (e->lmid != 0) {
+                std::cout << "命名空间: " << namespace_name(e->lmid) << "\n";
+            }
+            std::cout << "进程名: " << e->comm << "\n"
+                     << "进程ID: " << e->pid << "\n";
+            if (e->result == 0) {
+                std::cout << "解析地址: 0x" << std::hex << e->symbol_addr << std::dec << "\n";
+            } else {
+                std::cout << "解析结果: 失败\n";
+            }
+            if (internal) {
+                print_internal_caller(e, path);
+            }
+            print_event_stack(e);
+            if (!libc.empty()) {
+                std::cout << "所在C库: " << libc << "\n";
+            }
+            std::cout << "耗时: " << format_duration(e->duration_ns) << "\n\n" << std::flush;
+            break;
+        }
+
+        case EVENT_CTOR:
+        case EVENT_DTOR: {
+            const std::string& path = lib_paths.resolve(e->path_id);
+            std::string library = !path.empty() ? path : (e->flags == SRC_DL_FINI ? "全部库" : "主程序");
+            record_latency(e->event_type, library, "", e->duration_ns);
+            std::cout << "[" << timestamp << "] 事件：构造析构事件\n"
+                     << "类型: " << event_type_name(e->event_type) << "\n"
+                     << "所属库: " << library << "\n"
+                     << "执行场景: " << init_context_name(e->result) << "\n"
+                     << "统计来源: " << init_fini_source_name(e->flags) << "\n"
+                     << "进程名: " << e->comm << "\n"
+                     << "进程ID: " << e->pid << "\n"
+                     << "耗时: " << format_duration(e->duration_ns) << "\n\n" << std::flush;
+            break;
+        }
+
+        case EVENT_LAZY_BIND: {
+            const std::string& caller = lib_paths.resolve(e->path_id);
+            const std::string& definer = lib_paths.resolve(e->def_path_id);
+            std::cout << "[" << timestamp << "] 事件：延迟绑定事件\n"
+                     << "调用方: " << (caller.empty() ? "主程序" : caller) << "\n"
+                     << "绑定符号: " << (e->symbol_len ? event_symbol(e) : "未知") << "\n"
+                     << "定义所在库: " << (definer.empty() ? "未知" : definer) << "\n"
+                     << "绑定地址: 0x" << std::hex << e->symbol_addr << std::dec << "\n"
+                     << "进程名: " << e->comm << "\n"
+                     << "进程ID: " << e->pid << "\n"
+                     << "耗时: " << format_duration(e->duration_ns) << "\n\n" << std::flush;
+            break;
+        }
+
+        case EVENT_RTLD_PHASE: {
+            if (e->flags < 0 || e->flags >= RTLD_PHASE_MAX || e->result < 0 || e->result >= RTLD_CTX_MAX) {
+                break;
+            }
+            if (e->path_id && e->path_len) {
+                lib_paths.record(e->path_id, event_path(e));
+            }
+            process_phases& phases = rtld_phases[e->pid];
+            phases.comm = e->comm;
+            phases.phase_ns[e->result][e->flags] += e->symbol_addr;
+
+            std::cout << "[" << timestamp << "] 事件：加载阶段事件\n"
+                     << "阶段: " << rtld_phase_name(e->flags) << "\n"
+                     << "触发场景: " << rtld_context_name(e->result) << "\n";
+            if (e->path_len) {
+                std::cout << "新加载对象: " << event_path(e) << "\n";
+            }
+            if (e->lmid != 0) {
+                std::cout << "命名空间: " << namespace_name(e->lmid) << "\n";
+            }
+            std::cout << "进程名: " << e->comm << "\n"
+                     << "进程ID: " << e->pid << "\n"
+                     << "耗时: " << format_duration(e->duration_ns) << "\n";
+            if (e->symbol_addr < e->duration_ns) {
+                std::cout << "独占耗时: " << format_duration(e->symbol_addr) << "\n";
+            }
+            std::cout << "\n" << std::flush;
+            break;
+        }
+
+        case EVENT_SEARCH_PROBE: {
+            std::cout << "[" << timestamp << "] 事件：库搜索探测事件\n"
+                     << "探测路径: " << (e->path_len ? event_path(e) : "未知") << "\n"
+                     << "失败原因: " << strerror(e->result) << "\n"
+                     << "场景: " << search_context_name(e->flags) << "\n";
+            if (e->symbol_len) {
+                std::cout << "请求的库: " << event_symbol(e) << "\n";
+            }
+            std::cout << "进程名: " << e->comm << "\n"
+                     << "进程ID: " << e->pid << "\n"
+                     << "耗时: " << format_duration(e->duration_ns) << "\n\n" << std::flush;
+            break;
+        }
+
+        case EVENT_DLOPEN_ERROR: {
+            // 与dlerror的格式一致：“对象名: 错误信息[: errno描述]”
+            std::string message;
+            if (e->path_len > 1) {
+                message = std::string(event_path(e)) + ": ";
+            }
+            message += e->symbol_len ? event_symbol(e) : "未知错误";
+            if (e->result > 0) {
+                message += std::string(": ") + strerror(e->result);
+            }
+            pending_dl_errors[e->tid] = message;
             break;
         }
     }
+    return 0;
+}
 
-cleanup:
-    perf_buffer__free(pb);
+// 汇总各CPU上因环形缓冲区已满而丢弃的事件数
+static __u64 get_dropped_events(struct dynlib_monitor_bpf *skel)
+{
+    int ncpus = libbpf_num_possible_cpus();
+    if (ncpus <= 0) {
+        return 0;
+    }
+
+    std::vector<__u64> values(ncpus);
+    __u32 key = 0;
+    if (bpf_map_lookup_elem(bpf_map__fd(skel->maps.dropped_events), &key, values.data())) {
+        return 0;
+    }
+
+    __u64 total = 0;
+    for (__u64 v : values) {
+        total += v;
+    }
+    return total;
+}
+
+// 与perf buffer的丢失回调一致，运行中出现新的丢弃时立即提示
+static void report_lost_events(struct dynlib_monitor_bpf *skel, __u64& reported)
+{
+    __u64 dropped = get_dropped_events(skel);
+    if (dropped > reported) {
+        printf("丢失 %llu 个事件\n", (unsigned long long)(dropped - reported));
+        reported = dropped;
+    }
+}
+
+// 打印本次运行的吞吐量与丢失统计，便于对比不同传输方式的效果
+static void print_statistics(struct dynlib_monitor_bpf *skel, __u64 start_ns)
+{
+    double elapsed = (get_monotonic_ns() - start_ns) / 1e9;
+    __u64 dropped = get_dropped_events(skel);
+    __u64 total = received_events + dropped;
+
+    std::cout << "\n统计信息:\n"
+              << "运行时间: " << std::fixed << std::setprecision(2) << elapsed << " 秒\n"
+              << "接收事件: " << received_events << "\n"
+              << "丢弃事件: " << dropped << "\n"
+              << "吞吐量: " << (elapsed > 0 ? received_events / elapsed : 0) << " 事件/秒\n"
+              << "丢失率: " << (total ? 100.0 * dropped / total : 0) << "%\n"
+              << std::defaultfloat;
+    if (lib_paths.collisions || symbol_names.collisions) {
+        std::cout << "字符串编号冲突: " << lib_paths.collisions + symbol_names.collisions << "\n";
+    }
+}
+
+// 输出log2直方图中非空的桶
+static void print_log2_slots(const __u32 *slots)
+{
+    for (int slot = 0; slot < MAX_SLOTS; slot++) {
+        if (slots[slot]) {
+            std::cout << " [" << format_duration(1ULL << slot) << ","
+                      << format_duration(2ULL << slot) << "):" << slots[slot];
+        }
+    }
+}
+
+// 输出一批聚合统计，按进程分组
+static void print_aggregates(const std::vector<agg_key>& keys, const std::vector<agg_value>& values)
+{
+    std::map<__u32, std::vector<size_t>> by_tgid;
+    for (size_t i = 0; i < keys.size(); i++) {
+        by_tgid[keys[i].tgid].push_back(i);
+    }
+
+    std::cout << "[" << get_formatted_timestamp(get_monotonic_ns()) << "] 聚合统计\n";
+    for (const auto& entry : by_tgid) {
+        std::cout << "进程ID: " << entry.first << "\n";
+        for (size_t i : entry.second) {
+            const agg_key& k = keys[i];
+            const agg_value& v = values[i];
+            const std::string& path = lib_paths.resolve(k.path_id);
+
+            const std::string& symbol = symbol_names.resolve(k.symbol_id);
+
+            // 同时并入全程的按库/按符号延迟统计
+            std::string library = std::string(event_type_name(k.event_type)) + " " +
+                                  (path.empty() ? "未知库" : path);
+            library_latency[library].add_log2_slots(v.slots, v.total_ns);
+            if (k.event_type == EVENT_DLSYM) {
+                symbol_latency[(path.empty() ? "未知库" : path) + " : " +
+                               (symbol.empty() ? "未知符号" : symbol)].add_log2_slots(v.slots, v.total_ns);
+            }
+
+            latency_stats interval_stats;
+            interval_stats.add_log2_slots(v.slots, v.total_ns);
+
+            std::cout << "  " << event_type_name(k.event_type) << " "
+                      << (path.empty() ? "未知库" : path);
+            if (k.event_type == EVENT_DLSYM) {
+                std::cout << " : " << (symbol.empty() ? "未知符号" : symbol);
+            }
+            std::cout << "\n    调用: " << v.calls << "  失败: " << v.failures
+                      << "  平均耗时: " << format_duration(v.calls ? v.total_ns / v.calls : 0)
+                      << "  p50: " << format_duration(interval_stats.percentile(0.50))
+                      << "  p99: " << format_duration(interval_stats.percentile(0.99))
+                      << "\n    耗时分布:";
+            print_log2_slots(v.slots);
+            std::cout << "\n";
+        }
+    }
+    std::cout << std::endl;
+}
+
+// 批量读取并清空内核统计表，内核不支持批量操作时逐项读取
+template <typename K, typename V>
+static void drain_map(struct bpf_map *map, std::vector<K>& keys, std::vector<V>& values)
+{
+    int fd = bpf_map__fd(map);
+    __u32 capacity = bpf_map__max_entries(map);
+    keys.resize(capacity);
+    values.resize(capacity);
+    K batch_token;
+    size_t total = 0;
+    bool first = true;
+
+    while (total < capacity) {
+        __u32 count = capacity - total;
+        int ret = bpf_map_lookup_and_delete_batch(fd, first ? NULL : &batch_token, &batch_token,
+                                                  keys.data() + total, values.data() + total,
+                                                  &count, NULL);
+        first = false;
+        total += count;
+        if (ret == -ENOENT) {
+            break;
+        }
+        if (ret < 0) {
+            // 内核不支持批量操作时逐项读取并删除
+            if (total == 0 && (ret == -EINVAL || ret == -ENOTSUP || ret == -EOPNOTSUPP)) {
+                K key, next;
+                K *prev = NULL;
+                while (total < capacity && bpf_map_get_next_key(fd, prev, &next) == 0) {
+                    if (bpf_map_lookup_and_delete_elem(fd, &next, &values[total]) == 0) {
+                        keys[total++] = next;
+                        prev = NULL;  // 当前项已删除，从头继续遍历
+                    } else {
+                        key = next;
+                        prev = &key;
+                    }
+                }
+            } else {
+                std::cerr << "读取内核统计失败: " << ret << std::endl;
+            }
+            break;
+        }
+    }
+
+    keys.resize(total);
+    values.resize(total);
+}
+
+// 批量读取并清空内核中的聚合统计后输出
+static void flush_aggregates(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<agg_key> keys;
+    std::vector<agg_value> values;
+    drain_map(skel->maps.agg_stats, keys, values);
+    if (!keys.empty()) {
+        print_aggregates(keys, values);
+    }
+}
+
+// 监控结束时输出仍在运行的进程的汇总，这些进程不会再触发退出事件
+static void flush_live_proc_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<__u32> keys;
+    std::vector<proc_stats> values;
+    drain_map(skel->maps.proc_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        struct proc_summary_event e = {};
+        e.event_type = EVENT_PROC_SUMMARY;
+        e.pid = keys[i];
+        e.timestamp = get_monotonic_ns();
+        e.stats = values[i];
+
+        std::ifstream comm_file("/proc/" + std::to_string(keys[i]) + "/comm");
+        std::string comm;
+        if (std::getline(comm_file, comm)) {
+            strncpy(e.comm, comm.c_str(), sizeof(e.comm) - 1);
+        }
+        print_proc_summary(&e, true);
+    }
+}
+
+// 用户空间累计的符号查找开销
+struct lookup_totals {
+    __u64 calls = 0;
+    __u64 failures = 0;
+    __u64 total_ns = 0;
+    __u64 scope_entries = 0;
+    __u32 max_entries = 0;
+};
+
+// 按（进程, 发起对象, 符号）累计的符号查找开销
+static std::map<std::tuple<__u32, __u64, __u64>, lookup_totals> symbol_lookups;
+
+// 读取并清空内核中的符号查找统计，累计到用户空间
+static void flush_lookup_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<lookup_key> keys;
+    std::vector<lookup_value> values;
+    drain_map(skel->maps.lookup_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        lookup_totals& totals = symbol_lookups[std::make_tuple(keys[i].tgid, keys[i].object_id,
+                                                               keys[i].symbol_id)];
+        totals.calls += values[i].calls;
+        totals.failures += values[i].failures;
+        totals.total_ns += values[i].total_ns;
+        totals.scope_entries += values[i].scope_entries;
+        totals.max_entries = std::max(totals.max_entries, values[i].max_entries);
+    }
+}
+
+// 输出符号查找热点，按累计耗时降序
+static void print_lookup_report()
+{
+    if (symbol_lookups.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<__u64, const decltype(symbol_lookups)::value_type*>> order;
+    __u64 calls = 0, total_ns = 0;
+    for (const auto& entry : symbol_lookups) {
+        order.push_back({entry.second.total_ns, &entry});
+        calls += entry.second.calls;
+        total_ns += entry.second.total_ns;
+    }
+    std::sort(order.begin(), order.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    std::cout << "\n符号查找热点（_dl_lookup_symbol_x，共 " << calls << " 次，"
+              << format_duration(total_ns) << "）:\n";
+    for (size_t i = 0; i < order.size() && i < 30; i++) {
+        const auto& key = order[i].second->first;
+        const lookup_totals& totals = order[i].second->second;
+        const std::string& object = lib_paths.resolve(std::get<1>(key));
+        const std::string& symbol = symbol_names.resolve(std::get<2>(key));
+        std::cout << "  进程 " << std::get<0>(key) << "  "
+                  << (object.empty() ? "主程序" : object) << " -> "
+                  << (symbol.empty() ? "未知符号" : symbol) << "\n"
+                  << "    查找: " << totals.calls << "  未找到: " << totals.failures
+                  << "  总耗时: " << format_duration(totals.total_ns)
+                  << "  平均搜索对象数: " << std::fixed << std::setprecision(1)
+                  << (double)totals.scope_entries / totals.calls
+                  << "  最多: " << totals.max_entries << "\n";
+    }
+}
+
+void print_usage(const char* program_name) {
+    std::cout << "用法: " << program_name << " [选项] [进程名]\n"
+              << "如果不指定进程，将监控除本进程外其他所有进程的动态链接信息。\n"
+              << "如果指定进程，则只监控这些进程及其子进程的动态链接信息。\n\n"
+              << "选项:\n"
+              << "  -p, --pid PID      监控指定进程ID，可重复指定\n"
+              << "  -c, --comm NAME    监控指定进程名，可重复指定\n"
+              << "  -m, --mode MODE    输出模式：stream（逐次输出事件，默认）或\n"
+              << "                     aggregate（内核聚合，周期性输出统计）\n"
+              << "  -i, --interval SEC 聚合模式下的输出间隔（也是读取内核统计的间隔），默认10秒\n"
+              << "  -H, --max-handles N\n"
+              << "                     已加载库句柄映射表的容量，默认65536，\n"
+              << "                     表满时淘汰最久未使用的句柄\n"
+              << "  -L, --lookup-profile\n"
+              << "                     统计ld.so内部_dl_lookup_symbol_x的符号查找开销，\n"
+              << "                     需要ld.so保留符号表\n"
+              << "  -z, --lazy-binding 跟踪RTLD_LAZY库首次调用时的延迟绑定（_dl_fixup），\n"
+              << "                     需要ld.so保留符号表\n"
+              << "  -S, --lazy-sample N\n"
+              << "                     每N次延迟绑定输出一条事件，默认1，按库统计不受影响\n"
+              << "  -x, --lock-contention\n"
+              << "                     测量线程等待dl_load_lock/dl_load_write_lock的时间，\n"
+              << "                     并按持有方当时的操作归因；只跟踪futex等待，\n"
+              << "                     锁在首次发生争用时识别\n"
+              << "  -u, --unwind-profile\n"
+              << "                     统计dl_iterate_phdr、dladdr、dladdr1和_Unwind_Find_FDE\n"
+              << "                     的调用频率、耗时、调用方模块和已加载对象数\n"
+              << "  -t, --tls-profile  按模块统计__tls_get_addr/_dl_tlsdesc_dynamic的访问次数，\n"
+              << "                     以及各线程首次访问时分配TLS块的慢路径；探针开销较大\n"
+              << "                     模块在加载时解析到库，监控启动前已加载的显示为未知\n"
+              << "  -T, --tls-sample N 每N次TLS访问计数一次并按N放大，默认1，慢路径不受影响；\n"
+              << "                     采样在探针中进行，每次访问仍有uprobe陷入的开销\n"
+              << "  -r, --reloc-profile\n"
+              << "                     按库统计_dl_relocate_object的重定位耗时和其中C库IFUNC\n"
+              << "                     解析函数的耗时，需要ld.so保留符号表\n"
+              << "  -N, --namespaces   按链接映射命名空间（dlmopen）统计加载次数、耗时、\n"
+              << "                     对象数和内存，加载开销只在stream模式下统计\n"
+              << "  -s, --syscalls     分解每次dlopen期间调用线程的系统调用（次数、耗时、\n"
+              << "                     读取和映射的字节数），仅stream模式；嵌套的dlopen\n"
+              << "                     （如构造函数中）计入最外层\n"
+              << "  -P, --search-probes\n"
+              << "                     记录dlopen和启动加载依赖时搜索路径上失败的打开尝试，\n"
+              << "                     附带dlopen失败的错误信息，并按库统计命中前的探测次数\n"
+              << "  -F, --fault-profile\n"
+              << "                     按库统计加载后的主/次缺页次数、耗时和页缓存未命中，\n"
+              << "                     并标出适合预取的库；需要rtld SDT探针记录加载的对象\n"
+              << "  -W, --fault-window SEC\n"
+              << "                     只统计加载后SEC秒内的缺页，默认10，0表示不限\n"
+              << "  -o, --offcpu       统计线程在dlopen/dlsym/dlclose中被切出的时间，按原因\n"
+              << "                     （I/O、futex、抢占、其他）和用户栈归到各次加载的库\n"
+              << "  -k, --stacks       记录dlopen/dlsym调用点的用户栈，事件中输出调用栈，\n"
+              << "                     退出时按调用点输出折叠栈（可用flamegraph.pl生成火焰图）；\n"
+              << "                     栈表最多保存16384个不同的栈，连续3个输出周期未引用的栈被回收\n"
+              << "  -K, --folded FILE  把调用点折叠栈写入FILE，隐含--stacks\n"
+              << "  -h, --help         显示本帮助信息\n";
+}
+
+// 解析命令行参数，返回false表示应退出程序
+static bool parse_args(int argc, char *argv[], monitor_options& opts, int& exit_code)
+{
+    static const struct option long_options[] = {
+        {"pid",  required_argument, NULL, 'p'},
+        {"comm", required_argument, NULL, 'c'},
+        {"mode", required_argument, NULL, 'm'},
+        {"interval", required_argument, NULL, 'i'},
+        {"max-handles", required_argument, NULL, 'H'},
+        {"lookup-profile", no_argument, NULL, 'L'},
+        {"lazy-binding", no_argument, NULL, 'z'},
+        {"lazy-sample", required_argument, NULL, 'S'},
+        {"lock-contention", no_argument, NULL, 'x'},
+        {"unwind-profile", no_argument, NULL, 'u'},
+        {"tls-profile", no_argument, NULL, 't'},
+        {"tls-sample", required_argument, NULL, 'T'},
+        {"reloc-profile", no_argument, NULL, 'r'},
+        {"namespaces", no_argument, NULL, 'N'},
+        {"syscalls", no_argument, NULL, 's'},
+        {"search-probes", no_argument, NULL, 'P'},
+        {"fault-profile", no_argument, NULL, 'F'},
+        {"fault-window", required_argument, NULL, 'W'},
+        {"offcpu", no_argument, NULL, 'o'},
+        {"stacks", no_argument, NULL, 'k'},
+        {"folded", required_argument, NULL, 'K'},
+        {"help", no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    int opt;
+    exit_code = 0;
+    while ((opt = getopt_long(argc, argv, "p:c:m:i:H:LzS:xutT:rNsPFW:okK:h", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'p': {
+                char *end;
+                long pid = strtol(optarg, &end, 10);
+                if (*end != '\0' || pid <= 0) {
+                    std::cerr << "无效的进程ID: " << optarg << std::endl;
+                    exit_code = 1;
+                    return false;
+                }
+                opts.target_pids.push_back(pid);
+                break;
+            }
+            case 'c':
+                opts.target_comms.push_back(optarg);
+                break;
+            case 'm':
+                if (strcmp(optarg, "stream") == 0) {
+                    opts.aggregate = false;
+                } else if (strcmp(optarg, "aggregate") == 0) {
+                    opts.aggregate = true;
+                } else {
+                    std::cerr << "无效的模式: " << optarg << std::endl;
+                    exit_code = 1;
+                    return false;
+                }
+                break;
+            case 'i':
+                opts.interval = atoi(optarg);
+                if (opts.interval <= 0) {
+                    std::cerr << "无效的输出间隔: " << optarg << std::endl;
+                    exit_code = 1;
+                    return false;
+                }
+                break;
+            case 'H': {
+                char *end;
+                long n = strtol(optarg, &end, 10);
+                if (*end != '\0' || n <= 0 || n > UINT32_MAX) {
+                    std::cerr << "无效的句柄映射表容量: " << optarg << std::endl;
+                    exit_code = 1;
+                    return false;
+                }
+                opts.max_handles = n;
+                break;
+            }
+            case 'L':
+                opts.lookup_profile = true;
+                break;
+            case 'z':
+                opts.lazy_binding = true;
+                break;
+            case 'x':
+                opts.lock_contention = true;
+                break;
+            case 'u':
+                opts.unwind_profile = true;
+                break;
+            case 't':
+                opts.tls_profile = true;
+                break;
+            case 'r':
+                opts.reloc_profile = true;
+                break;
+            case 'N':
+                opts.namespace_profile = true;
+                break;
+            case 's':
+                opts.syscall_profile = true;
+                break;
+            case 'P':
+                opts.search_probes = true;
+                break;
+            case 'F':
+                opts.fault_profile = true;
+                break;
+            case 'o':
+                opts.offcpu_profile = true;
+                break;
+            case 'k':
+                opts.stack_capture = true;
+                break;
+            case 'K':
+                opts.stack_capture = true;
+                opts.folded_path = optarg;
+                break;
+            case 'W': {
+                char *end;
+                long n = strtol(optarg, &end, 10);
+                if (*end != '\0' || n < 0 || n > INT32_MAX) {
+                    std::cerr << "无效的缺页统计窗口: " << optarg << std::endl;
+                    exit_code = 1;
+                    return false;
+                }
+                opts.fault_window = n;
+                break;
+            }
+            case 'S': {
+                char *end;
+                long n = strtol(optarg, &end, 10);
+                if (*end != '\0' || n <= 0 || n > UINT32_MAX) {
+                    std::cerr << "无效的采样率: " << optarg << std::endl;
+                    exit_code = 1;
+                    return false;
+                }
+                opts.lazy_sample = n;
+                break;
+            }
+            case 'T': {
+                char *end;
+                long n = strtol(optarg, &end, 10);
+                if (*end != '\0' || n <= 0 || n > UINT32_MAX) {
+                    std::cerr << "无效的采样率: " << optarg << std::endl;
+                    exit_code = 1;
+                    return false;
+                }
+                opts.tls_sample = n;
+                break;
+            }
+            case 'h':
+                print_usage(argv[0]);
+                return false;
+            default:
+                print_usage(argv[0]);
+                exit_code = 1;
+                return false;
+        }
+    }
+
+    // 兼容旧用法：位置参数作为进程名
+    for (int i = optind; i < argc; i++) {
+        opts.target_comms.push_back(argv[i]);
+    }
+    return true;
+}
+
+// 初始PID命名空间的inode号（PROC_PID_INIT_INO）
+static const __u64 init_pidns_ino = 0xEFFFFFFCULL;
+
+// 监控程序位于容器等非初始PID命名空间时，记录该命名空间供内核侧换算进程ID
+static void setup_pid_namespace(struct dynlib_monitor_bpf *skel)
+{
+    struct stat st;
+    if (stat("/proc/self/ns/pid", &st) == 0 && st.st_ino != init_pidns_ino) {
+        skel->rodata->pidns_dev = st.st_dev;
+        skel->rodata->pidns_ino = st.st_ino;
+    }
+}
+
+// 将进程名和进程ID写入内核侧的目标集合
+// 在非初始命名空间中，/proc和命令行给出的进程ID只在本命名空间内有效，写入按命名空间编号的集合
+static int setup_targets(struct dynlib_monitor_bpf *skel, const monitor_options& opts)
+{
+    int tgids_fd = bpf_map__fd(skel->rodata->pidns_ino ? skel->maps.target_ns_tgids
+                                                         : skel->maps.target_tgids);
+    int comms_fd = bpf_map__fd(skel->maps.target_comms);
+    __u8 one = 1;
+
+    std::set<std::string> comms;
+    for (const std::string& name : opts.target_comms) {
+        char comm[16] = {};
+        strncpy(comm, name.c_str(), sizeof(comm) - 1);
+        if (bpf_map_update_elem(comms_fd, comm, &one, BPF_ANY)) {
+            return -1;
+        }
+        comms.insert(comm);
+    }
+
+    // 扫描已在运行的进程：记录父子关系，找出进程名匹配的进程
+    std::map<__u32, std::vector<__u32>> children;
+    std::vector<__u32> seeds(opts.target_pids.begin(), opts.target_pids.end());
+    DIR *proc = opendir("/proc");
+    if (proc) {
+        struct dirent *ent;
+        while ((ent = readdir(proc)) != NULL) {
+            char *end;
+            long pid = strtol(ent->d_name, &end, 10);
+            if (*end != '\0' || pid <= 0) {
+                continue;
+            }
+
+            std::ifstream stat_file(std::string("/proc/") + ent->d_name + "/stat");
+            std::string line;
+            if (!std::getline(stat_file, line)) {
+                continue;
+            }
+
+            // 格式: pid (comm) state ppid ...，comm中可能含有空格和括号
+            size_t open_paren = line.find('(');
+            size_t close_paren = line.rfind(')');
+            if (open_paren == std::string::npos || close_paren == std::string::npos) {
+                continue;
+            }
+            std::string comm = line.substr(open_paren + 1, close_paren - open_paren - 1);
+            std::istringstream rest(line.substr(close_paren + 1));
+            std::string state;
+            __u32 ppid = 0;
+            rest >> state >> ppid;
+
+            children[ppid].push_back(pid);
+            if (comms.count(comm)) {
+                seeds.push_back(pid);
+            }
+        }
+        closedir(proc);
+    }
+
+    // 目标进程及其已有的所有子孙进程都加入目标集合
+    std::set<__u32> visited;
+    while (!seeds.empty()) {
+        __u32 pid = seeds.back();
+        seeds.pop_back();
+        if (!visited.insert(pid).second) {
+            continue;
+        }
+        if (bpf_map_update_elem(tgids_fd, &pid, &one, BPF_ANY)) {
+            return -1;
+        }
+        auto it = children.find(pid);
+        if (it != children.end()) {
+            seeds.insert(seeds.end(), it->second.begin(), it->second.end());
+        }
+    }
+    return 0;
+}
+
+// 判断路径是否为需要附加的C库：libc.so.6，以及dlopen等函数所在的旧版libdl.so.2
+static bool is_libc_path(const std::string& name)
+{
+    return name == "libc.so.6" || name == "libdl.so.2";
+}
+
+// 判断路径是否为动态链接器，如ld-linux-x86-64.so.2、旧版glibc的ld-2.31.so
+static bool is_rtld_path(const std::string& name)
+{
+    return name.compare(0, 3, "ld-") == 0 && name.find(".so") != std::string::npos;
+}
+
+// 扫描各进程的内存映射，发现所有正在使用的不同C库、动态链接器和libgcc_s（按设备和inode去重）
+// 容器中的库通过/proc/<pid>/root访问，宿主机上存在同一文件时优先使用宿主机路径
+static void discover_dl_libraries()
+{
+    std::set<std::pair<dev_t, ino_t>> seen;
+    DIR *proc = opendir("/proc");
+    if (!proc) {
+        return;
+    }
+
+    struct dirent *ent;
+    while ((ent = readdir(proc)) != NULL) {
+        char *end;
+        long pid = strtol(ent->d_name, &end, 10);
+        if (*end != '\0' || pid <= 0) {
+            continue;
+        }
+
+        // 格式: 起止地址 权限 偏移 主设备号:次设备号 inode 路径
+        std::ifstream maps_file(std::string("/proc/") + ent->d_name + "/maps");
+        std::string line;
+        while (std::getline(maps_file, line)) {
+            std::istringstream fields(line);
+            std::string range, perms, offset, dev, path;
+            unsigned long inode = 0;
+            if (!(fields >> range >> perms >> offset >> dev >> inode >> path) || inode == 0) {
+                continue;
+            }
+            // 跳过已被替换删除的文件（路径后带" (deleted)"）
+            std::string rest;
+            if (fields >> rest) {
+                continue;
+            }
+            size_t slash = path.rfind('/');
+            std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+            std::vector<libc_target> *targets = NULL;
+            if (is_libc_path(name)) {
+                targets = &libc_targets;
+            } else if (is_rtld_path(name)) {
+                targets = &rtld_targets;
+            } else if (name == "libgcc_s.so.1") {
+                targets = &unwind_targets;
+            } else {
+                continue;
+            }
+
+            unsigned int major_no = 0, minor_no = 0;
+            if (sscanf(dev.c_str(), "%x:%x", &major_no, &minor_no) != 2) {
+                continue;
+            }
+            dev_t devno = makedev(major_no, minor_no);
+            if (!seen.insert({devno, inode}).second) {
+                continue;
+            }
+
+            struct stat st;
+            std::string attach_path = path;
+            if (stat(path.c_str(), &st) || st.st_dev != devno || st.st_ino != inode) {
+                attach_path = std::string("/proc/") + ent->d_name + "/root" + path;
+            }
+            targets->push_back({attach_path, devno, (ino_t)inode});
+        }
+    }
+    closedir(proc);
+}
+
+// 内核是否支持uprobe-multi链接（Linux 6.6引入，也可能被移植到更早的发行版内核）
+// 与libbpf的特性探测相同：加载一个空的uprobe-multi程序，对路径“/”创建链接，
+// 支持该链接类型的内核在打开目标文件时才失败并返回EBADF
+static bool kernel_has_uprobe_multi()
+{
+#if LIBBPF_MAJOR_VERSION > 1 || (LIBBPF_MAJOR_VERSION == 1 && LIBBPF_MINOR_VERSION >= 3)
+    struct bpf_insn insns[2] = {};
+    insns[0].code = BPF_ALU64 | BPF_MOV | BPF_K;  // r0 = 0
+    insns[0].dst_reg = BPF_REG_0;
+    insns[1].code = BPF_JMP | BPF_EXIT;
+
+    LIBBPF_OPTS(bpf_prog_load_opts, load_opts, .expected_attach_type = BPF_TRACE_UPROBE_MULTI);
+    int prog_fd = bpf_prog_load(BPF_PROG_TYPE_KPROBE, NULL, "GPL", insns, 2, &load_opts);
+    if (prog_fd < 0) {
+        return false;
+    }
+
+    unsigned long offset = 0;
+    LIBBPF_OPTS(bpf_link_create_opts, link_opts);
+    link_opts.uprobe_multi.path = "/";
+    link_opts.uprobe_multi.offsets = &offset;
+    link_opts.uprobe_multi.cnt = 1;
+    int link_fd = bpf_link_create(prog_fd, -1, BPF_TRACE_UPROBE_MULTI, &link_opts);
+    int link_err = errno;
+    if (link_fd >= 0) {
+        close(link_fd);
+    }
+    close(prog_fd);
+    return link_fd < 0 && link_err == EBADF;
+#else
+    return false;
+#endif
+}
+
+// 需要附加的dl*探针
+struct dl_probe {
+    struct bpf_program *prog;
+    const char *func;
+    bool retprobe;
+    __u32 flags;        // cookie中的标志位：LIBC_ID_INTERNAL（glibc内部接口）或LIBC_ID_VARIANT（dlmopen/dlvsym）
+};
+
+// 附加到C库中dl*函数的探针，包括glibc加载NSS、gconv模块等使用的内部接口
+static std::vector<dl_probe> dl_probes(struct dynlib_monitor_bpf *skel)
+{
+    return {
+        {skel->progs.trace_dlopen, "dlopen", false},
+        {skel->progs.trace_dlopen_ret, "dlopen", true},
+        {skel->progs.trace_dlclose, "dlclose", false},
+        {skel->progs.trace_dlclose_ret, "dlclose", true},
+        {skel->progs.trace_dlsym, "dlsym", false},
+        {skel->progs.trace_dlsym_ret, "dlsym", true},
+        {skel->progs.trace_dlmopen, "dlmopen", false, LIBC_ID_VARIANT},
+        {skel->progs.trace_dlopen_ret, "dlmopen", true, LIBC_ID_VARIANT},
+        {skel->progs.trace_dlvsym, "dlvsym", false, LIBC_ID_VARIANT},
+        {skel->progs.trace_dlsym_ret, "dlvsym", true, LIBC_ID_VARIANT},
+        {skel->progs.trace_dlopen, "__libc_dlopen_mode", false, LIBC_ID_INTERNAL},
+        {skel->progs.trace_dlopen_ret, "__libc_dlopen_mode", true, LIBC_ID_INTERNAL},
+        {skel->progs.trace_dlclose, "__libc_dlclose", false, LIBC_ID_INTERNAL},
+        {skel->progs.trace_dlclose_ret, "__libc_dlclose", true, LIBC_ID_INTERNAL},
+        {skel->progs.trace_dlsym, "__libc_dlsym", false, LIBC_ID_INTERNAL},
+        {skel->progs.trace_dlsym_ret, "__libc_dlsym", true, LIBC_ID_INTERNAL},
+    };
+}
+
+// ELF文件中是否定义了指定的函数
+static bool elf_has_function(const elf_image *image, const char *name)
+{
+    return std::any_of(image->symbols.begin(), image->symbols.end(),
+                       [name](const elf_symbol& sym) { return sym.name == name; });
+}
+
+// 按函数名把单个dl*探针附加到C库
+static bool attach_dl_probe(const dl_probe& probe, const std::string& path, __u64 cookie, bool use_multi)
+{
+    struct bpf_link *link = NULL;
+#if LIBBPF_MAJOR_VERSION > 1 || (LIBBPF_MAJOR_VERSION == 1 && LIBBPF_MINOR_VERSION >= 3)
+    if (use_multi) {
+        const char *syms[] = {probe.func};
+        LIBBPF_OPTS(bpf_uprobe_multi_opts, multi_opts,
+            .syms = syms,
+            .cookies = &cookie,
+            .cnt = 1,
+            .retprobe = probe.retprobe,
+        );
+        link = bpf_program__attach_uprobe_multi(probe.prog, -1, path.c_str(), NULL, &multi_opts);
+    } else
+#endif
+    {
+        LIBBPF_OPTS(bpf_uprobe_opts, uprobe_opts,
+            .bpf_cookie = cookie,
+            .retprobe = probe.retprobe,
+            .func_name = probe.func,
+        );
+        link = bpf_program__attach_uprobe_opts(probe.prog, -1, path.c_str(), 0, &uprobe_opts);
+    }
+    if (!link) {
+        return false;
+    }
+    uprobe_links.push_back(link);
+    return true;
+}
+
+// 用uprobe-multi把同一程序在一个C库中的全部探针合并为一个链接，返回已附加的探针数并标记在done中
+// 只合并库中确实存在的函数，否则libbpf解析符号失败会使整个链接失败
+static size_t attach_dl_probes_multi(const std::vector<dl_probe>& probes, const std::string& path,
+                                     __u64 libc_id, std::vector<bool>& done)
+{
+    size_t attached = 0;
+#if LIBBPF_MAJOR_VERSION > 1 || (LIBBPF_MAJOR_VERSION == 1 && LIBBPF_MINOR_VERSION >= 3)
+    const elf_image *image = load_elf_image(path);
+    for (size_t first = 0; first < probes.size(); first++) {
+        if (done[first]) {
+            continue;
+        }
+
+        std::vector<size_t> members;
+        std::vector<const char *> syms;
+        std::vector<__u64> cookies;
+        for (size_t j = first; j < probes.size(); j++) {
+            if (probes[j].prog != probes[first].prog || done[j] ||
+                (image && !elf_has_function(image, probes[j].func))) {
+                continue;
+            }
+            members.push_back(j);
+            syms.push_back(probes[j].func);
+            cookies.push_back(libc_id | probes[j].flags);
+        }
+        if (members.empty()) {
+            continue;
+        }
+
+        LIBBPF_OPTS(bpf_uprobe_multi_opts, multi_opts,
+            .syms = syms.data(),
+            .cookies = cookies.data(),
+            .cnt = syms.size(),
+            .retprobe = probes[first].retprobe,
+        );
+        struct bpf_link *link = bpf_program__attach_uprobe_multi(probes[first].prog, -1, path.c_str(),
+                                                                 NULL, &multi_opts);
+        if (!link) {
+            continue;
+        }
+        uprobe_links.push_back(link);
+        for (size_t j : members) {
+            done[j] = true;
+        }
+        attached += members.size();
+    }
+#endif
+    return attached;
+}
+
+// 按函数名把dl*探针附加到发现的每个C库，cookie为C库编号
+// 支持uprobe-multi时每个程序在每个库中只需一个链接，合并失败的探针再逐个附加；
+// 函数不存在于某个库中（如新版glibc的libdl.so.2只是空壳）时跳过该探针
+static int attach_dl_probes(struct dynlib_monitor_bpf *skel, bool use_multi)
+{
+    const std::vector<dl_probe> probes = dl_probes(skel);
+
+    size_t attached_libcs = 0;
+    for (size_t i = 0; i < libc_targets.size(); i++) {
+        const std::string& path = libc_targets[i].path;
+        std::vector<bool> done(probes.size(), false);
+        size_t attached = use_multi ? attach_dl_probes_multi(probes, path, i + 1, done) : 0;
+
+        for (size_t j = 0; j < probes.size(); j++) {
+            if (!done[j] && attach_dl_probe(probes[j], path, (i + 1) | probes[j].flags, use_multi)) {
+                attached++;
+            }
+        }
+
+        if (attached) {
+            attached_libcs++;
+            std::cout << "已附加到C库: " << path << std::endl;
+        }
+    }
+    return attached_libcs ? 0 : -1;
+}
+
+// 把动态链接器的SDT探针附加到发现的每个ld.so，USDT cookie为阶段编号
+// glibc未启用SDT（--enable-systemtap）时没有这些探针，只输出提示
+static void attach_rtld_probes(struct dynlib_monitor_bpf *skel)
+{
+    static const struct {
+        const char *start;
+        const char *complete;
+    } phases[RTLD_PHASE_MAX] = {
+        {"init_start", "init_complete"},
+        {"map_start", "map_complete"},
+        {"reloc_start", "reloc_complete"},
+        {"unmap_start", "unmap_complete"},
+    };
+
+    for (const libc_target& rtld : rtld_targets) {
+        size_t attached = 0;
+        for (int phase = 0; phase < RTLD_PHASE_MAX; phase++) {
+            LIBBPF_OPTS(bpf_usdt_opts, usdt_opts, .usdt_cookie = (__u64)phase);
+            struct bpf_link *start = bpf_program__attach_usdt(skel->progs.trace_rtld_start, -1,
+                                                              rtld.path.c_str(), "rtld",
+                                                              phases[phase].start, &usdt_opts);
+            struct bpf_link *complete = bpf_program__attach_usdt(skel->progs.trace_rtld_complete, -1,
+                                                                 rtld.path.c_str(), "rtld",
+                                                                 phases[phase].complete, &usdt_opts);
+            if (start && complete) {
+                uprobe_links.push_back(start);
+                uprobe_links.push_back(complete);
+                attached++;
+            } else {
+                bpf_link__destroy(start);
+                bpf_link__destroy(complete);
+            }
+        }
+
+        if (attached) {
+            std::cout << "已附加到动态链接器: " << rtld.path << std::endl;
+        } else {
+            std::cout << "动态链接器 " << rtld.path << " 未提供rtld SDT探针，不统计加载阶段" << std::endl;
+        }
+    }
+}
+
+// 用户空间累计的延迟绑定统计，键为（进程, 调用方对象路径编号）
+static std::map<std::pair<__u32, __u64>, lazy_value> lazy_bindings;
+
+// 读取并清空内核中的延迟绑定统计，累计到用户空间
+static void flush_lazy_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<lazy_key> keys;
+    std::vector<lazy_value> values;
+    drain_map(skel->maps.lazy_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        auto it = lazy_bindings.find({keys[i].tgid, keys[i].path_id});
+        if (it == lazy_bindings.end()) {
+            lazy_bindings[{keys[i].tgid, keys[i].path_id}] = values[i];
+            continue;
+        }
+        it->second.bindings += values[i].bindings;
+        it->second.total_ns += values[i].total_ns;
+        it->second.first_ts = std::min(it->second.first_ts, values[i].first_ts);
+        it->second.last_ts = std::max(it->second.last_ts, values[i].last_ts);
+    }
+}
+
+// 按库输出延迟绑定的次数、耗时和发生的时间范围，按总耗时降序
+static void print_lazy_report()
+{
+    if (lazy_bindings.empty()) {
+        return;
+    }
+
+    struct library_lazy {
+        lazy_value totals = {};
+        std::set<__u32> processes;
+    };
+    std::map<std::string, library_lazy> libraries;
+    for (const auto& entry : lazy_bindings) {
+        const std::string& path = lib_paths.resolve(entry.first.second);
+        library_lazy& lib = libraries[path.empty() ? "主程序" : path];
+        if (lib.processes.empty() || entry.second.first_ts < lib.totals.first_ts) {
+            lib.totals.first_ts = entry.second.first_ts;
+        }
+        lib.totals.last_ts = std::max(lib.totals.last_ts, entry.second.last_ts);
+        lib.totals.bindings += entry.second.bindings;
+        lib.totals.total_ns += entry.second.total_ns;
+        lib.processes.insert(entry.first.first);
+    }
+
+    std::vector<const std::pair<const std::string, library_lazy>*> order;
+    for (const auto& lib : libraries) {
+        order.push_back(&lib);
+    }
+    std::sort(order.begin(), order.end(), [](const auto *a, const auto *b) {
+        return a->second.totals.total_ns > b->second.totals.total_ns;
+    });
+
+    std::cout << "\n按库统计的延迟绑定:\n";
+    for (const auto *lib : order) {
+        const lazy_value& totals = lib->second.totals;
+        std::cout << "  " << lib->first << "（" << lib->second.processes.size() << " 个进程）\n"
+                  << "    绑定: " << totals.bindings
+                  << "  总耗时: " << format_duration(totals.total_ns)
+                  << "  平均: " << format_duration(totals.total_ns / totals.bindings) << "\n"
+                  << "    首次: " << get_formatted_timestamp(totals.first_ts)
+                  << "  最近: " << get_formatted_timestamp(totals.last_ts)
+                  << "  跨度: " << format_duration(totals.last_ts - totals.first_ts) << "\n";
+    }
+}
+
+// 用户空间累计的遍历接口统计，键为（进程, 接口, 调用方模块）
+static std::map<std::tuple<__u32, __u32, __u64>, api_value> api_calls;
+
+// 读取并清空内核中的遍历接口统计，累计到用户空间
+static void flush_api_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<api_key> keys;
+    std::vector<api_value> values;
+    drain_map(skel->maps.api_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        api_value& totals = api_calls[std::make_tuple(keys[i].tgid, keys[i].api, keys[i].caller_id)];
+        totals.calls += values[i].calls;
+        totals.total_ns += values[i].total_ns;
+        totals.objects += values[i].objects;
+        totals.object_samples += values[i].object_samples;
+        for (int slot = 0; slot < MAX_SLOTS; slot++) {
+            totals.slots[slot] += values[i].slots[slot];
+        }
+    }
+}
+
+// 按进程输出各遍历接口的调用频率和耗时，以及按调用方模块的分布
+static void print_api_report(double elapsed_s)
+{
+    if (api_calls.empty()) {
+        return;
+    }
+
+    std::cout << "\n遍历已加载对象的接口调用（统计时长 " << std::fixed << std::setprecision(1)
+              << elapsed_s << " 秒）:\n";
+    __u32 current_tgid = 0;
+    auto it = api_calls.begin();
+    while (it != api_calls.end()) {
+        __u32 tgid = std::get<0>(it->first);
+        __u32 api = std::get<1>(it->first);
+        if (tgid != current_tgid) {
+            std::cout << "进程ID: " << tgid << "\n";
+            current_tgid = tgid;
+        }
+
+        // 同一进程同一接口的各调用方合并统计
+        api_value total = {};
+        auto end = it;
+        for (; end != api_calls.end() && std::get<0>(end->first) == tgid && std::get<1>(end->first) == api; ++end) {
+            total.calls += end->second.calls;
+            total.total_ns += end->second.total_ns;
+            total.objects += end->second.objects;
+            total.object_samples += end->second.object_samples;
+            for (int slot = 0; slot < MAX_SLOTS; slot++) {
+                total.slots[slot] += end->second.slots[slot];
+            }
+        }
+
+        latency_stats stats;
+        stats.add_log2_slots(total.slots, total.total_ns);
+        std::cout << "  " << dl_api_name(api)
+                  << "  调用: " << total.calls
+                  << "  频率: " << std::setprecision(1) << (elapsed_s > 0 ? total.calls / elapsed_s : 0) << " 次/秒"
+                  << "  总耗时: " << format_duration(total.total_ns)
+                  << "  p50: " << format_duration(stats.percentile(0.50))
+                  << "  p99: " << format_duration(stats.percentile(0.99));
+        if (total.object_samples) {
+            std::cout << "  平均已加载对象: " << std::setprecision(0) << (double)total.objects / total.object_samples;
+        }
+        std::cout << "\n";
+
+        for (; it != end; ++it) {
+            const std::string& caller = lib_paths.resolve(std::get<2>(it->first));
+            std::cout << "    调用方 " << (caller.empty() ? "未知" : caller)
+                      << "  调用: " << it->second.calls
+                      << "  总耗时: " << format_duration(it->second.total_ns) << "\n";
+        }
+    }
+}
+
+// 用户空间累计的TLS访问统计，键为（进程, 模块编号）
+static std::map<std::pair<__u32, __u64>, tls_value> tls_modules;
+// 用户空间累计的TLS慢路径，键为（进程, 线程）
+static std::map<std::pair<__u32, __u32>, tls_thread_value> tls_threads;
+
+// 读取并清空内核中的TLS统计，累计到用户空间
+static void flush_tls_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<tls_key> keys;
+    std::vector<tls_value> values;
+    drain_map(skel->maps.tls_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        tls_value& totals = tls_modules[{keys[i].tgid, keys[i].modid}];
+        totals.calls += values[i].calls;
+        totals.slow_calls += values[i].slow_calls;
+        totals.slow_ns += values[i].slow_ns;
+        // 模块编号在dlclose后可能被复用，以最近一次解析到的路径为准
+        if (values[i].path_id) {
+            totals.path_id = values[i].path_id;
+        }
+    }
+
+    std::vector<tls_thread_key> thread_keys;
+    std::vector<tls_thread_value> thread_values;
+    drain_map(skel->maps.tls_threads, thread_keys, thread_values);
+
+    for (size_t i = 0; i < thread_keys.size(); i++) {
+        tls_thread_value& totals = tls_threads[{thread_keys[i].tgid, thread_keys[i].tid}];
+        totals.slow_calls += thread_values[i].slow_calls;
+        totals.slow_ns += thread_values[i].slow_ns;
+    }
+}
+
+// 按进程输出各TLS模块的访问频率和慢路径，以及慢路径最多的线程
+static void print_tls_report(double elapsed_s)
+{
+    if (tls_modules.empty()) {
+        return;
+    }
+
+    std::cout << "\n动态TLS访问（统计时长 " << std::fixed << std::setprecision(1) << elapsed_s << " 秒）:\n";
+    __u32 current_tgid = 0;
+    for (const auto& entry : tls_modules) {
+        __u32 tgid = entry.first.first;
+        if (tgid != current_tgid) {
+            std::cout << "进程ID: " << tgid << "\n";
+            current_tgid = tgid;
+        }
+
+        const tls_value& stats = entry.second;
+        const std::string& path = lib_paths.resolve(stats.path_id);
+        std::cout << "  模块 " << entry.first.second << " " << (path.empty() ? "未知" : path)
+                  << "\n    访问: " << stats.calls
+                  << "  频率: " << std::setprecision(1) << (elapsed_s > 0 ? stats.calls / elapsed_s : 0) << " 次/秒"
+                  << "  慢路径: " << stats.slow_calls;
+        if (stats.slow_calls) {
+            std::cout << "  总耗时: " << format_duration(stats.slow_ns)
+                      << "  平均: " << format_duration(stats.slow_ns / stats.slow_calls);
+        }
+        std::cout << "\n";
+    }
+
+    if (tls_threads.empty()) {
+        return;
+    }
+    std::vector<const std::pair<const std::pair<__u32, __u32>, tls_thread_value>*> order;
+    for (const auto& thread : tls_threads) {
+        order.push_back(&thread);
+    }
+    std::sort(order.begin(), order.end(), [](const auto *a, const auto *b) {
+        return a->second.slow_calls > b->second.slow_calls;
+    });
+
+    std::cout << "慢路径最多的线程:\n";
+    for (size_t i = 0; i < order.size() && i < 10; i++) {
+        std::cout << "  进程ID: " << order[i]->first.first << "  线程ID: " << order[i]->first.second
+                  << "  慢路径: " << order[i]->second.slow_calls
+                  << "  总耗时: " << format_duration(order[i]->second.slow_ns) << "\n";
+    }
+}
+
+// 用户空间累计的重定位统计，键为库路径编号
+static std::map<__u64, reloc_value> relocations;
+
+// 读取并清空内核中的重定位统计，累计到用户空间
+static void flush_reloc_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<__u64> keys;
+    std::vector<reloc_value> values;
+    drain_map(skel->maps.reloc_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        reloc_value& totals = relocations[keys[i]];
+        totals.loads += values[i].loads;
+        totals.total_ns += values[i].total_ns;
+        totals.max_ns = std::max(totals.max_ns, values[i].max_ns);
+        totals.ifunc_calls += values[i].ifunc_calls;
+        totals.ifunc_ns += values[i].ifunc_ns;
+        totals.relocs = values[i].relocs;
+        totals.relative_relocs = values[i].relative_relocs;
+        totals.plt_relocs = values[i].plt_relocs;
+    }
+}
+
+// 按库输出重定位耗时，按每次加载的平均重定位耗时降序
+static void print_reloc_report()
+{
+    if (relocations.empty()) {
+        return;
+    }
+
+    std::vector<const std::pair<const __u64, reloc_value>*> order;
+    for (const auto& entry : relocations) {
+        order.push_back(&entry);
+    }
+    std::sort(order.begin(), order.end(), [](const auto *a, const auto *b) {
+        return a->second.total_ns / a->second.loads > b->second.total_ns / b->second.loads;
+    });
+
+    std::cout << "\n按库统计的重定位耗时（按每次加载的平均耗时排序）:\n";
+    for (const auto *entry : order) {
+        const reloc_value& stats = entry->second;
+        const std::string& path = lib_paths.resolve(entry->first);
+        std::cout << "  " << (path.empty() ? "主程序" : path) << "\n"
+                  << "    加载: " << stats.loads
+                  << "  平均: " << format_duration(stats.total_ns / stats.loads)
+                  << "  最长: " << format_duration(stats.max_ns)
+                  << "  总耗时: " << format_duration(stats.total_ns) << "\n"
+                  << "    其中IFUNC解析: " << format_duration(stats.ifunc_ns / stats.loads) << "/次加载"
+                  << "（" << stats.ifunc_calls / stats.loads << " 次调用）\n"
+                  << "    重定位项: " << stats.relocs
+                  << "（相对 " << stats.relative_relocs << "）"
+                  << "  PLT: " << stats.plt_relocs;
+        __u64 total_relocs = (__u64)stats.relocs + stats.plt_relocs;
+        if (total_relocs) {
+            std::cout << "  平均每项: " << format_duration(stats.total_ns / stats.loads / total_relocs);
+        }
+        std::cout << "\n";
+    }
+}
+
+// 用户空间累计的库搜索统计，键为最终打开的路径编号
+static std::map<__u64, search_value> search_hits;
+
+// 读取并清空内核中的库搜索统计，累计到用户空间
+static void flush_search_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<__u64> keys;
+    std::vector<search_value> values;
+    drain_map(skel->maps.search_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        search_value& totals = search_hits[keys[i]];
+        totals.hits += values[i].hits;
+        totals.probes += values[i].probes;
+        totals.probe_ns += values[i].probe_ns;
+        totals.max_probes = std::max(totals.max_probes, values[i].max_probes);
+    }
+}
+
+// 按库输出命中前的探测次数，按失败尝试的累计耗时降序，只列出有失败尝试的库
+static void print_search_report()
+{
+    std::vector<const std::pair<const __u64, search_value>*> order;
+    for (const auto& entry : search_hits) {
+        if (entry.second.probes) {
+            order.push_back(&entry);
+        }
+    }
+    if (order.empty()) {
+        return;
+    }
+    std::sort(order.begin(), order.end(), [](const auto *a, const auto *b) {
+        return a->second.probe_ns > b->second.probe_ns;
+    });
+
+    std::cout << "\n按库统计的搜索路径探测（命中前失败的打开尝试）:\n";
+    for (size_t i = 0; i < order.size() && i < 20; i++) {
+        const search_value& stats = order[i]->second;
+        const std::string& path = lib_paths.resolve(order[i]->first);
+        std::cout << "  " << (path.empty() ? "未知" : path) << "\n"
+                  << "    命中: " << stats.hits
+                  << "  平均探测: " << std::fixed << std::setprecision(1)
+                  << (double)stats.probes / stats.hits << std::defaultfloat
+                  << "  最多: " << stats.max_probes
+                  << "  探测总耗时: " << format_duration(stats.probe_ns) << "\n";
+    }
+}
+
+// 用户空间累计的缺页统计，键为库路径编号
+static std::map<__u64, fault_value> faults;
+
+// 每次加载的主缺页数或主缺页耗时超过该值时建议预取
+static const __u64 PREFETCH_MAJOR_FAULTS = 16;
+static const __u64 PREFETCH_MAJOR_NS = 1000000;
+
+// 读取并清空内核中的缺页统计，累计到用户空间
+static void flush_fault_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<__u64> keys;
+    std::vector<fault_value> values;
+    drain_map(skel->maps.fault_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        fault_value& totals = faults[keys[i]];
+        totals.loads += values[i].loads;
+        totals.minor += values[i].minor;
+        totals.major += values[i].major;
+        totals.minor_ns += values[i].minor_ns;
+        totals.major_ns += values[i].major_ns;
+        totals.retry_ns += values[i].retry_ns;
+        totals.cache_pages += values[i].cache_pages;
+    }
+}
+
+// 按库输出加载后的缺页，按主缺页耗时（含等待I/O后重试的尝试）降序
+static void print_fault_report(int window)
+{
+    std::vector<const std::pair<const __u64, fault_value>*> order;
+    for (const auto& entry : faults) {
+        if (entry.second.minor || entry.second.major) {
+            order.push_back(&entry);
+        }
+    }
+    if (order.empty()) {
+        return;
+    }
+    std::sort(order.begin(), order.end(), [](const auto *a, const auto *b) {
+        return a->second.major_ns + a->second.retry_ns > b->second.major_ns + b->second.retry_ns;
+    });
+
+    std::cout << "\n按库统计的加载后缺页（";
+    if (window > 0) {
+        std::cout << "加载后" << window << "秒内";
+    } else {
+        std::cout << "不限时间";
+    }
+    std::cout << "，按主缺页耗时排序）:\n";
+    for (size_t i = 0; i < order.size() && i < 20; i++) {
+        const fault_value& stats = order[i]->second;
+        const std::string& path = lib_paths.resolve(order[i]->first);
+        __u64 loads = stats.loads ? stats.loads : 1;
+        __u64 major_ns = stats.major_ns + stats.retry_ns;
+        std::cout << "  " << (path.empty() ? "未知" : path) << "\n"
+                  << "    加载: " << stats.loads
+                  << "  主缺页: " << stats.major << "（" << format_duration(major_ns) << "）"
+                  << "  次缺页: " << stats.minor << "（" << format_duration(stats.minor_ns) << "）\n"
+                  << "    页缓存未命中: " << stats.cache_pages << " 页";
+        if (stats.major / loads >= PREFETCH_MAJOR_FAULTS || major_ns / loads >= PREFETCH_MAJOR_NS) {
+            std::cout << "  [建议预取：部署后用vmtouch/readahead预热页缓存]";
+        }
+        std::cout << "\n";
+    }
+}
+
+// 一个已加载对象占用的内存（KB）
+struct object_memory {
+    __u64 size_kb = 0;      // 映射大小
+    __u64 rss_kb = 0;       // 常驻内存
+};
+
+// 读取/proc/<pid>/smaps，统计从各基址开始的对象占用的内存
+// 对象的映射从加载基址开始，连续属于同一文件，末尾可能紧跟一段匿名的.bss
+static std::map<__u64, object_memory> read_object_memory(__u32 pid, const std::map<__u64, __s64>& bases)
+{
+    std::map<__u64, object_memory> objects;
+    std::ifstream smaps("/proc/" + std::to_string(pid) + "/smaps");
+    std::string line;
+    object_memory *current = NULL;
+    unsigned long long current_inode = 0, prev_end = 0;
+    bool anon_taken = false;
+
+    while (std::getline(smaps, line)) {
+        unsigned long long start, end, inode;
+        if (sscanf(line.c_str(), "%llx-%llx %*s %*s %*s %llu", &start, &end, &inode) == 3) {
+            if (bases.count(start)) {
+                current = &objects[start];
+                current_inode = inode;
+                anon_taken = false;
+            } else if (current && inode == current_inode && inode != 0) {
+                // 同一对象的后续段
+            } else if (current && inode == 0 && start == prev_end && !anon_taken) {
+                anon_taken = true;
+            } else {
+                current = NULL;
+            }
+            prev_end = end;
+            continue;
+        }
+
+        unsigned long long kb;
+        if (current && sscanf(line.c_str(), "Size: %llu kB", &kb) == 1) {
+            current->size_kb += kb;
+        } else if (current && sscanf(line.c_str(), "Rss: %llu kB", &kb) == 1) {
+            current->rss_kb += kb;
+        }
+    }
+    return objects;
+}
+
+// 按（进程, 命名空间）统计的已加载对象和内存
+struct namespace_memory {
+    size_t objects = 0;     // 对象数
+    __u64 size_kb = 0;      // 映射大小
+    __u64 rss_kb = 0;       // 常驻内存
+};
+
+// 各命名空间内存的峰值，进程退出后仍保留
+static std::map<std::pair<__u32, __s64>, namespace_memory> namespace_peaks;
+
+// 读取句柄映射和对象缓存中各进程已加载的对象（不清空），按命名空间统计当前内存并更新峰值
+static void snapshot_namespace_memory(struct dynlib_monitor_bpf *skel)
+{
+    std::map<__u32, std::map<__u64, __s64>> bases;
+    auto collect = [&bases](int fd, auto value) {
+        handle_key key, next;
+        handle_key *prev = NULL;
+        while (bpf_map_get_next_key(fd, prev, &next) == 0) {
+            if (bpf_map_lookup_elem(fd, &next, &value) == 0 && value.base_addr) {
+                bases[next.tgid][value.base_addr] = value.lmid;
+            }
+            key = next;
+            prev = &key;
+        }
+    };
+    collect(bpf_map__fd(skel->maps.object_paths), object_info{});
+    collect(bpf_map__fd(skel->maps.handle_to_path), handle_info{});
+
+    for (const auto& process : bases) {
+        std::map<__s64, namespace_memory> current;
+        for (const auto& object : read_object_memory(process.first, process.second)) {
+            namespace_memory& ns = current[process.second.at(object.first)];
+            ns.objects++;
+            ns.size_kb += object.second.size_kb;
+            ns.rss_kb += object.second.rss_kb;
+        }
+        for (const auto& ns : current) {
+            namespace_memory& peak = namespace_peaks[{process.first, ns.first}];
+            peak.objects = std::max(peak.objects, ns.second.objects);
+            peak.size_kb = std::max(peak.size_kb, ns.second.size_kb);
+            peak.rss_kb = std::max(peak.rss_kb, ns.second.rss_kb);
+        }
+    }
+}
+
+// 按进程输出各命名空间的加载开销和内存峰值
+static void print_namespace_report()
+{
+    std::set<std::pair<__u32, __s64>> namespaces;
+    for (const auto& entry : namespace_load_stats) {
+        namespaces.insert(entry.first);
+    }
+    for (const auto& entry : namespace_peaks) {
+        namespaces.insert(entry.first);
+    }
+    if (namespaces.empty()) {
+        return;
+    }
+
+    std::cout << "\n按命名空间统计:\n";
+    __u32 current_pid = 0;
+    for (const auto& ns : namespaces) {
+        if (ns.first != current_pid) {
+            std::cout << "进程ID: " << ns.first << "\n";
+            current_pid = ns.first;
+        }
+        std::cout << "  命名空间: " << namespace_name(ns.second) << "\n";
+        auto loads = namespace_load_stats.find(ns);
+        if (loads != namespace_load_stats.end()) {
+            std::cout << "    加载: " << loads->second.loads << "（失败 " << loads->second.failures << "）"
+                      << "  总耗时: " << format_duration(loads->second.total_ns)
+                      << "  平均: " << format_duration(loads->second.total_ns / loads->second.loads) << "\n";
+        }
+        auto peak = namespace_peaks.find(ns);
+        if (peak != namespace_peaks.end()) {
+            std::cout << "    对象峰值: " << peak->second.objects
+                      << "  映射峰值: " << peak->second.size_kb << " KB"
+                      << "  常驻峰值: " << peak->second.rss_kb << " KB\n";
+        }
+    }
+}
+
+// 把一对入口/返回探针按函数名附加到指定的库，成功时保存链接
+static bool attach_uprobe_pair(struct bpf_program *entry_prog, struct bpf_program *return_prog,
+                             const std::string& path, const char *func, __u64 cookie)
+{
+    LIBBPF_OPTS(bpf_uprobe_opts, entry_opts, .bpf_cookie = cookie, .func_name = func);
+    LIBBPF_OPTS(bpf_uprobe_opts, return_opts, .bpf_cookie = cookie, .retprobe = true, .func_name = func);
+    struct bpf_link *entry = bpf_program__attach_uprobe_opts(entry_prog, -1, path.c_str(), 0, &entry_opts);
+    struct bpf_link *ret = bpf_program__attach_uprobe_opts(return_prog, -1, path.c_str(), 0, &return_opts);
+    if (!entry || !ret) {
+        bpf_link__destroy(entry);
+        bpf_link__destroy(ret);
+        return false;
+    }
+    uprobe_links.push_back(entry);
+    uprobe_links.push_back(ret);
+    return true;
+}
+
+// 用户空间累计的锁等待统计，键为（进程, 锁, 等待方操作, 持有方操作, 持有方库）
+static std::map<std::tuple<__u32, __u32, __u32, __u32, __u64>, agg_value> lock_waits;
+
+// 读取并清空内核中的锁等待统计，累计到用户空间
+static void flush_lock_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<lock_key> keys;
+    std::vector<agg_value> values;
+    drain_map(skel->maps.lock_stats, keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        const lock_key& k = keys[i];
+        agg_value& totals = lock_waits[std::make_tuple(k.tgid, k.lock, k.waiter_op, k.holder_op, k.holder_path)];
+        totals.calls += values[i].calls;
+        totals.total_ns += values[i].total_ns;
+        for (int slot = 0; slot < MAX_SLOTS; slot++) {
+            totals.slots[slot] += values[i].slots[slot];
+        }
+    }
+}
+
+// 按进程输出锁等待时间分布，以及按持有方操作的归因
+static void print_lock_report()
+{
+    if (lock_waits.empty()) {
+        return;
+    }
+
+    std::cout << "\n动态链接器全局锁争用:\n";
+    auto it = lock_waits.begin();
+    while (it != lock_waits.end()) {
+        __u32 tgid = std::get<0>(it->first);
+        agg_value process = {};
+        auto end = it;
+        for (; end != lock_waits.end() && std::get<0>(end->first) == tgid; ++end) {
+            process.calls += end->second.calls;
+            process.total_ns += end->second.total_ns;
+            for (int slot = 0; slot < MAX_SLOTS; slot++) {
+                process.slots[slot] += end->second.slots[slot];
+            }
+        }
+
+        latency_stats stats;
+        stats.add_log2_slots(process.slots, process.total_ns);
+        std::cout << "进程ID: " << tgid << "\n"
+                  << "  等待次数: " << process.calls
+                  << "  总等待: " << format_duration(process.total_ns)
+                  << "  p50: " << format_duration(stats.percentile(0.50))
+                  << "  p99: " << format_duration(stats.percentile(0.99)) << "\n"
+                  << "  等待分布:";
+        print_log2_slots(process.slots);
+        std::cout << "\n";
+
+        for (; it != end; ++it) {
+            const std::string& path = lib_paths.resolve(std::get<4>(it->first));
+            std::cout << "  " << (std::get<1>(it->first) == LOCK_LOAD ? "dl_load_lock" : "dl_load_write_lock")
+                      << "  等待方: " << loader_op_name(std::get<2>(it->first))
+                      << "  持有方: " << loader_op_name(std::get<3>(it->first));
+            if (!path.empty()) {
+                std::cout << " " << path;
+            }
+            std::cout << "\n    次数: " << it->second.calls
+                      << "  总等待: " << format_duration(it->second.total_ns)
+                      << "  平均: " << format_duration(it->second.total_ns / it->second.calls) << "\n";
+        }
+    }
+}
+
+// 一次库加载（操作, 库）的off-CPU画像
+struct offcpu_library {
+    offcpu_value totals = {};
+    __u64 reason_ns[OFFCPU_MAX] = {};
+    std::map<std::pair<__u32, std::vector<std::string>>, offcpu_value> stacks;  // （原因, 栈） -> 统计
+};
+
+// 用户空间累计的off-CPU画像，键为（操作, 库路径编号）
+static std::map<std::pair<__u32, __u64>, offcpu_library> offcpu_profiles;
+
+// 读取并清空内核中的off-CPU统计；栈在此时符号化，避免进程退出后无法读取映射
+static void flush_offcpu_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<offcpu_key> keys;
+    std::vector<offcpu_value> values;
+    drain_map(skel->maps.offcpu_stats, keys, values);
+
+    int stacks_fd = bpf_map__fd(skel->maps.user_stacks);
+    for (size_t i = 0; i < keys.size(); i++) {
+        const offcpu_key& k = keys[i];
+        if (k.reason >= OFFCPU_MAX) {
+            continue;
+        }
+        offcpu_library& profile = offcpu_profiles[{k.op, k.path_id}];
+        profile.totals.count += values[i].count;
+        profile.totals.total_ns += values[i].total_ns;
+        profile.totals.max_ns = std::max(profile.totals.max_ns, values[i].max_ns);
+        profile.reason_ns[k.reason] += values[i].total_ns;
+
+        offcpu_value& stack = profile.stacks[{k.reason, read_user_stack(stacks_fd, k.tgid, k.stack_id)}];
+        stack.count += values[i].count;
+        stack.total_ns += values[i].total_ns;
+        stack.max_ns = std::max(stack.max_ns, values[i].max_ns);
+    }
+}
+
+// 按库输出dl*调用期间的off-CPU时间：原因分布和阻塞最久的用户栈
+static void print_offcpu_report()
+{
+    if (offcpu_profiles.empty()) {
+        return;
+    }
+
+    std::vector<const std::pair<const std::pair<__u32, __u64>, offcpu_library>*> order;
+    for (const auto& entry : offcpu_profiles) {
+        order.push_back(&entry);
+    }
+    std::sort(order.begin(), order.end(), [](const auto *a, const auto *b) {
+        return a->second.totals.total_ns > b->second.totals.total_ns;
+    });
+
+    std::cout << "\n按库统计的dl*调用期间off-CPU时间:\n";
+    for (size_t i = 0; i < order.size() && i < 20; i++) {
+        const offcpu_library& profile = order[i]->second;
+        const std::string& path = lib_paths.resolve(order[i]->first.second);
+        std::cout << "  " << loader_op_name(order[i]->first.first) << " " << (path.empty() ? "未知" : path) << "\n"
+                  << "    切出: " << profile.totals.count
+                  << "  总计: " << format_duration(profile.totals.total_ns)
+                  << "  最长: " << format_duration(profile.totals.max_ns) << "\n    ";
+        for (int reason = 0; reason < OFFCPU_MAX; reason++) {
+            std::cout << (reason ? "  " : "") << offcpu_reason_name(reason) << ": "
+                      << format_duration(profile.reason_ns[reason]);
+        }
+        std::cout << "\n";
+
+        std::vector<const std::pair<const std::pair<__u32, std::vector<std::string>>, offcpu_value>*> stacks;
+        for (const auto& stack : profile.stacks) {
+            stacks.push_back(&stack);
+        }
+        std::sort(stacks.begin(), stacks.end(), [](const auto *a, const auto *b) {
+            return a->second.total_ns > b->second.total_ns;
+        });
+        for (size_t j = 0; j < stacks.size() && j < 5; j++) {
+            std::cout << "    [" << offcpu_reason_name(stacks[j]->first.first) << "] "
+                      << format_duration(stacks[j]->second.total_ns)
+                      << "（" << stacks[j]->second.count << " 次）\n";
+            const std::vector<std::string>& frames = stacks[j]->first.second;
+            if (frames.empty()) {
+                std::cout << "      （未取到用户栈）\n";
+            }
+            for (const std::string& frame : frames) {
+                std::cout << "      " << frame << "\n";
+            }
+        }
+    }
+}
+
+// 按折叠栈累计的dl*调用点，键为“进程名;外层帧;...;内层帧;操作”
+static std::map<std::string, callsite_value> folded_callsites;
+
+// 读取进程名，进程已退出时返回进程ID
+static std::string read_process_comm(__u32 pid)
+{
+    std::ifstream file("/proc/" + std::to_string(pid) + "/comm");
+    std::string comm;
+    if (!std::getline(file, comm) || comm.empty()) {
+        return std::to_string(pid);
+    }
+    return comm;
+}
+
+// 读取并清空内核中的调用点统计，把栈符号化后折叠累计
+static void flush_callsite_stats(struct dynlib_monitor_bpf *skel)
+{
+    std::vector<callsite_key> keys;
+    std::vector<callsite_value> values;
+    drain_map(skel->maps.callsite_stats, keys, values);
+
+    std::map<__u32, std::string> comms;
+    for (size_t i = 0; i < keys.size(); i++) {
+        const callsite_key& k = keys[i];
+        auto comm = comms.find(k.tgid);
+        if (comm == comms.end()) {
+            comm = comms.emplace(k.tgid, read_process_comm(k.tgid)).first;
+        }
+
+        std::string folded = comm->second;
+        std::vector<std::string> frames = read_user_stack(user_stacks_fd, k.tgid, k.stack_id);
+        if (frames.empty()) {
+            folded += ";[未知]";
+        }
+        for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+            folded += ";" + *it;
+        }
+        folded += std::string(";") + loader_op_name(k.op);
+
+        callsite_value& totals = folded_callsites[folded];
+        totals.calls += values[i].calls;
+        totals.total_ns += values[i].total_ns;
+    }
+}
+
+// 输出调用点折叠栈，每行“栈 调用次数”；指定文件时写入文件，否则输出调用次数最多的调用点
+static void print_callsite_report(const std::string& path)
+{
+    if (!path.empty()) {
+        std::ofstream out(path);
+        for (const auto& entry : folded_callsites) {
+            out << entry.first << " " << entry.second.calls << "\n";
+        }
+        if (out) {
+            std::cout << "\n已写入 " << folded_callsites.size() << " 个调用点的折叠栈: " << path << "\n";
+        } else {
+            std::cerr << "无法写入折叠栈文件: " << path << std::endl;
+        }
+        return;
+    }
+    if (folded_callsites.empty()) {
+        return;
+    }
+
+    std::vector<const std::pair<const std::string, callsite_value>*> order;
+    for (const auto& entry : folded_callsites) {
+        order.push_back(&entry);
+    }
+    std::sort(order.begin(), order.end(), [](const auto *a, const auto *b) {
+        return a->second.calls > b->second.calls;
+    });
+
+    std::cout << "\ndl*调用点折叠栈（按调用次数，可直接输入flamegraph.pl）:\n";
+    for (size_t i = 0; i < order.size() && i < 50; i++) {
+        std::cout << order[i]->first << " " << order[i]->second.calls << "\n";
+    }
+    std::cout << "\n按调用点统计的dl*耗时（前10）:\n";
+    std::sort(order.begin(), order.end(), [](const auto *a, const auto *b) {
+        return a->second.total_ns > b->second.total_ns;
+    });
+    for (size_t i = 0; i < order.size() && i < 10; i++) {
+        const std::string& folded = order[i]->first;
+        std::cout << "  " << format_duration(order[i]->second.total_ns)
+                  << "（" << order[i]->second.calls << " 次）  "
+                  << folded.substr(folded.find(';') + 1) << "\n";
+    }
+}
+
+// 附加遍历已加载对象接口的探针，cookie为接口编号；测量锁争用时
+// 也需要dl_iterate_phdr的探针来识别dl_load_write_lock
+static void attach_dl_api_probes(struct dynlib_monitor_bpf *skel, bool unwind_profile)
+{
+    struct bpf_program *entry = skel->progs.trace_dl_api;
+    struct bpf_program *ret = skel->progs.trace_dl_api_ret;
+
+    for (const libc_target& libc : libc_targets) {
+        bool iterate = attach_uprobe_pair(entry, ret, libc.path, "dl_iterate_phdr", API_DL_ITERATE_PHDR);
+        if (unwind_profile) {
+            attach_uprobe_pair(entry, ret, libc.path, "dladdr", API_DLADDR);
+            attach_uprobe_pair(entry, ret, libc.path, "dladdr1", API_DLADDR1);
+        }
+        if (iterate) {
+            std::cout << "已附加遍历接口探针: " << libc.path << std::endl;
+        }
+    }
+
+    if (!unwind_profile) {
+        return;
+    }
+    for (const libc_target& libgcc : unwind_targets) {
+        if (attach_uprobe_pair(entry, ret, libgcc.path, "_Unwind_Find_FDE", API_UNWIND_FIND_FDE)) {
+            std::cout << "已附加异常展开探针: " << libgcc.path << std::endl;
+        }
+    }
+}
+
+// 取得struct link_map中l_tls_modid的偏移。ld.so为libthread_db导出字段描述符
+// _thread_db_link_map_l_tls_modid（{位宽, 个数, 偏移}），只在符号表中，
+// 剥离后读不到；只读配置只有一个值，各ld.so不一致时同样返回0
+static __u32 find_tls_modid_offset()
+{
+    __u32 offset = 0;
+    for (const libc_target& rtld : rtld_targets) {
+        __u32 desc[3] = {};
+        if (!read_elf_object(rtld.path, "_thread_db_link_map_l_tls_modid", desc, sizeof(desc)) ||
+            desc[0] != 64 || desc[1] != 1 || !desc[2] || (offset && offset != desc[2])) {
+            return 0;
+        }
+        offset = desc[2];
+    }
+    return offset;
+}
+
+// 附加动态TLS探针：访问计数只需入口探针；慢路径优先使用分配TLS块的
+// tls_get_addr_tail，被内联时退而使用x86-64的__tls_get_addr_slow
+static void attach_tls_probes(struct dynlib_monitor_bpf *skel)
+{
+    for (const libc_target& rtld : rtld_targets) {
+        int entries = 0;
+        for (__u64 entry : {TLS_GET_ADDR, TLS_DESC_DYNAMIC}) {
+            const char *func = entry == TLS_GET_ADDR ? "__tls_get_addr" : "_dl_tlsdesc_dynamic";
+            LIBBPF_OPTS(bpf_uprobe_opts, opts, .bpf_cookie = entry, .func_name = func);
+            struct bpf_link *link = bpf_program__attach_uprobe_opts(skel->progs.trace_tls_get_addr, -1,
+                                                                    rtld.path.c_str(), 0, &opts);
+            if (link) {
+                uprobe_links.push_back(link);
+                entries++;
+            }
+        }
+
+        const char *slow = NULL;
+        if (attach_uprobe_pair(skel->progs.trace_tls_slow, skel->progs.trace_tls_slow_ret,
+                               rtld.path, "tls_get_addr_tail", 0)) {
+            slow = "tls_get_addr_tail";
+        } else if (attach_uprobe_pair(skel->progs.trace_tls_slow, skel->progs.trace_tls_slow_ret,
+                                      rtld.path, "__tls_get_addr_slow", 0)) {
+            slow = "__tls_get_addr_slow";
+        }
+
+        if (entries || slow) {
+            std::cout << "已附加TLS探针: " << rtld.path << "（"
+                      << entries << " 个访问入口，" << (slow ? slow : "无慢路径") << "）" << std::endl;
+        } else {
+            std::cout << "动态链接器 " << rtld.path << " 中未找到__tls_get_addr，不统计TLS访问" << std::endl;
+        }
+    }
+}
+
+// 读取ELF文件中全部IFUNC符号的解析函数，返回其文件偏移（按地址去重）
+static std::vector<size_t> find_ifunc_resolvers(const std::string& path)
+{
+    std::vector<size_t> offsets;
+    const elf_image *image = load_elf_image(path);
+    if (!image) {
+        return offsets;
+    }
+
+    std::set<Elf64_Addr> resolvers;
+    for (const elf_symbol& sym : image->symbols) {
+        if (sym.type == STT_GNU_IFUNC) {
+            resolvers.insert(sym.addr);
+        }
+    }
+    // 符号值是虚拟地址，按所在的可执行PT_LOAD段换算为文件偏移
+    for (Elf64_Addr addr : resolvers) {
+        for (const Elf64_Phdr& phdr : image->phdrs) {
+            if (phdr.p_type == PT_LOAD && (phdr.p_flags & PF_X) &&
+                addr >= phdr.p_vaddr && addr < phdr.p_vaddr + phdr.p_filesz) {
+                offsets.push_back(addr - phdr.p_vaddr + phdr.p_offset);
+                break;
+            }
+        }
+    }
+    return offsets;
+}
+
+// 把IFUNC解析函数探针附加到每个C库；其他库引用memcpy等C库函数时，
+// 重定位中调用的就是这些解析函数
+static void attach_ifunc_probes(struct dynlib_monitor_bpf *skel)
+{
+    for (const libc_target& libc : libc_targets) {
+        LIBBPF_OPTS(bpf_uprobe_opts, entry_opts);
+        LIBBPF_OPTS(bpf_uprobe_opts, return_opts, .retprobe = true);
+        size_t attached = 0;
+        for (size_t offset : find_ifunc_resolvers(libc.path)) {
+            struct bpf_link *entry = bpf_program__attach_uprobe_opts(skel->progs.trace_ifunc_resolver, -1,
+                                                                     libc.path.c_str(), offset, &entry_opts);
+            struct bpf_link *ret = bpf_program__attach_uprobe_opts(skel->progs.trace_ifunc_resolver_ret, -1,
+                                                                   libc.path.c_str(), offset, &return_opts);
+            if (!entry || !ret) {
+                bpf_link__destroy(entry);
+                bpf_link__destroy(ret);
+                continue;
+            }
+            uprobe_links.push_back(entry);
+            uprobe_links.push_back(ret);
+            attached++;
+        }
+        std::cout << "已附加 " << attached << " 个IFUNC解析函数探针: " << libc.path << std::endl;
+    }
+}
+
+// 把一对入口/返回探针按函数名附加到每个ld.so；这些都是ld.so的内部函数，
+// 已剥离符号表的ld.so中找不到，只输出提示
+static void attach_rtld_function(struct bpf_program *entry_prog, struct bpf_program *return_prog,
+                                 const char *func, const char *purpose)
+{
+    for (const libc_target& rtld : rtld_targets) {
+        if (attach_uprobe_pair(entry_prog, return_prog, rtld.path, func, 0)) {
+            std::cout << "已附加" << func << "探针: " << rtld.path << std::endl;
+        } else {
+            std::cout << "动态链接器 " << rtld.path << " 中未找到" << func
+                      << "（可能已剥离符号表），不" << purpose << std::endl;
+        }
+    }
+}
+
+// 附加ld.so中_dl_signal_exception的探针，捕获dlopen失败时dlerror返回的错误信息；
+// 该函数是GLIBC_PRIVATE导出符号，剥离符号表的ld.so中也能找到
+static void attach_dl_error_probes(struct dynlib_monitor_bpf *skel)
+{
+    for (const libc_target& rtld : rtld_targets) {
+        LIBBPF_OPTS(bpf_uprobe_opts, opts, .func_name = "_dl_signal_exception");
+        struct bpf_link *link = bpf_program__attach_uprobe_opts(skel->progs.trace_dl_signal_exception, -1,
+                                                                rtld.path.c_str(), 0, &opts);
+        if (link) {
+            uprobe_links.push_back(link);
+            std::cout << "已附加_dl_signal_exception探针: " << rtld.path << std::endl;
+        } else {
+            std::cout << "动态链接器 " << rtld.path << " 中未找到_dl_signal_exception，不记录dlopen错误信息" << std::endl;
+        }
+    }
+}
+
+// 附加构造/析构函数探针：优先使用逐库的call_init和_dl_call_fini，
+// 找不到（被内联或旧版glibc）时退而统计_dl_init、_dl_close_worker和_dl_fini
+static void attach_init_fini_probes(struct dynlib_monitor_bpf *skel)
+{
+    struct bpf_program *entry = skel->progs.trace_init_fini;
+    struct bpf_program *ret = skel->progs.trace_init_fini_ret;
+
+    for (const libc_target& rtld : rtld_targets) {
+        const char *ctor = NULL;
+        if (attach_uprobe_pair(entry, ret, rtld.path, "call_init", SRC_CALL_INIT)) {
+            ctor = "call_init";
+        } else if (attach_uprobe_pair(entry, ret, rtld.path, "_dl_init", SRC_DL_INIT)) {
+            ctor = "_dl_init";
+        }
+
+        const char *dtor = NULL;
+        if (attach_uprobe_pair(entry, ret, rtld.path, "_dl_call_fini", SRC_CALL_FINI)) {
+            dtor = "_dl_call_fini";
+        } else {
+            bool close_worker = attach_uprobe_pair(entry, ret, rtld.path, "_dl_close_worker", SRC_CLOSE_WORKER);
+            bool dl_fini = attach_uprobe_pair(entry, ret, rtld.path, "_dl_fini", SRC_DL_FINI);
+            if (close_worker || dl_fini) {
+                dtor = "_dl_close_worker/_dl_fini";
+            }
+        }
+
+        if (ctor || dtor) {
+            std::cout << "已附加构造/析构探针: " << rtld.path << "（"
+                      << (ctor ? ctor : "无构造") << "，" << (dtor ? dtor : "无析构") << "）" << std::endl;
+        } else {
+            std::cout << "动态链接器 " << rtld.path
+                      << " 中未找到构造/析构相关函数（可能已剥离符号表），不统计构造/析构耗时" << std::endl;
+        }
+    }
+}
+
+// 可选的统计功能：关闭时不加载的程序、附加、周期性读取内核统计和退出时的报告。
+// 同一程序可由多项功能共用（如_dl_lookup_symbol_x同时用于符号查找和延迟绑定），
+// 只有所有使用它的功能都关闭时才不加载；不需要的步骤为NULL
+struct monitor_feature {
+    bool (*enabled)(const monitor_options& opts);
+    std::vector<struct bpf_program *> (*programs)(struct dynlib_monitor_bpf *skel);
+    void (*attach)(struct dynlib_monitor_bpf *skel, const monitor_options& opts);
+    void (*flush)(struct dynlib_monitor_bpf *skel);
+    void (*report)(const monitor_options& opts, double elapsed_s);
+};
+
+// 各项功能，按报告的输出顺序排列
+static const std::vector<monitor_feature>& monitor_features()
+{
+    static const std::vector<monitor_feature> features = {
+        // 符号查找探针，符号查找统计和延迟绑定共用
+        {
+            [](const monitor_options& o) { return o.lookup_profile || o.lazy_binding; },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_lookup_symbol,
+                                                         skel->progs.trace_lookup_symbol_ret};
+            },
+            [](struct dynlib_monitor_bpf *skel, const monitor_options& o) {
+                attach_rtld_function(skel->progs.trace_lookup_symbol, skel->progs.trace_lookup_symbol_ret,
+                                     "_dl_lookup_symbol_x", "统计符号查找");
+            },
+            NULL, NULL,
+        },
+        // 系统调用跟踪点，系统调用分解、库搜索和锁争用共用
+        {
+            [](const monitor_options& o) {
+                return (o.syscall_profile && !o.aggregate) || o.search_probes || o.lock_contention;
+            },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_sys_enter, skel->progs.trace_sys_exit};
+            },
+            NULL, NULL, NULL,
+        },
+        // dl*接口探针，锁争用和遍历接口统计共用
+        {
+            [](const monitor_options& o) { return o.lock_contention || o.unwind_profile; },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_dl_api, skel->progs.trace_dl_api_ret};
+            },
+            [](struct dynlib_monitor_bpf *skel, const monitor_options& o) {
+                attach_dl_api_probes(skel, o.unwind_profile);
+            },
+            NULL, NULL,
+        },
+        // 重定位和IFUNC解析
+        {
+            [](const monitor_options& o) { return o.reloc_profile; },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_relocate_object,
+                                                         skel->progs.trace_relocate_object_ret,
+                                                         skel->progs.trace_ifunc_resolver,
+                                                         skel->progs.trace_ifunc_resolver_ret};
+            },
+            [](struct dynlib_monitor_bpf *skel, const monitor_options& o) {
+                attach_rtld_function(skel->progs.trace_relocate_object, skel->progs.trace_relocate_object_ret,
+                                     "_dl_relocate_object", "统计重定位耗时");
+                attach_ifunc_probes(skel);
+            },
+            flush_reloc_stats,
+            [](const monitor_options& o, double elapsed_s) { print_reloc_report(); },
+        },
+        // 库搜索的失败打开尝试
+        {
+            [](const monitor_options& o) { return o.search_probes; },
+            NULL, NULL,
+            flush_search_stats,
+            [](const monitor_options& o, double elapsed_s) { print_search_report(); },
+        },
+        // dlopen失败的错误信息，随搜索探测事件输出，仅stream模式
+        {
+            [](const monitor_options& o) { return o.search_probes && !o.aggregate; },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_dl_signal_exception};
+            },
+            [](struct dynlib_monitor_bpf *skel, const monitor_options& o) { attach_dl_error_probes(skel); },
+            NULL, NULL,
+        },
+        // 加载后的缺页
+        {
+            [](const monitor_options& o) { return o.fault_profile; },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_fault_entry,
+                                                         skel->progs.trace_fault_exit,
+                                                         skel->progs.trace_page_cache_add};
+            },
+            NULL,
+            flush_fault_stats,
+            [](const monitor_options& o, double elapsed_s) { print_fault_report(o.fault_window); },
+        },
+        // dlmopen命名空间
+        {
+            [](const monitor_options& o) { return o.namespace_profile; },
+            NULL, NULL,
+            snapshot_namespace_memory,
+            [](const monitor_options& o, double elapsed_s) { print_namespace_report(); },
+        },
+        // 符号查找开销
+        {
+            [](const monitor_options& o) { return o.lookup_profile; },
+            NULL, NULL,
+            flush_lookup_stats,
+            [](const monitor_options& o, double elapsed_s) { print_lookup_report(); },
+        },
+        // 延迟绑定
+        {
+            [](const monitor_options& o) { return o.lazy_binding; },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_dl_fixup, skel->progs.trace_dl_fixup_ret};
+            },
+            [](struct dynlib_monitor_bpf *skel, const monitor_options& o) {
+                attach_rtld_function(skel->progs.trace_dl_fixup, skel->progs.trace_dl_fixup_ret,
+                                     "_dl_fixup", "跟踪延迟绑定");
+            },
+            flush_lazy_stats,
+            [](const monitor_options& o, double elapsed_s) { print_lazy_report(); },
+        },
+        // 动态链接器锁争用
+        {
+            [](const monitor_options& o) { return o.lock_contention; },
+            NULL, NULL,
+            flush_lock_stats,
+            [](const monitor_options& o, double elapsed_s) { print_lock_report(); },
+        },
+        // dl*调用期间的off-CPU时间
+        {
+            [](const monitor_options& o) { return o.offcpu_profile; },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_sched_switch};
+            },
+            NULL,
+            flush_offcpu_stats,
+            [](const monitor_options& o, double elapsed_s) { print_offcpu_report(); },
+        },
+        // 调用点的用户栈
+        {
+            [](const monitor_options& o) { return o.stack_capture; },
+            NULL, NULL,
+            flush_callsite_stats,
+            [](const monitor_options& o, double elapsed_s) { print_callsite_report(o.folded_path); },
+        },
+        // 遍历接口（dl_iterate_phdr、dladdr等）
+        {
+            [](const monitor_options& o) { return o.unwind_profile; },
+            NULL, NULL,
+            flush_api_stats,
+            [](const monitor_options& o, double elapsed_s) { print_api_report(elapsed_s); },
+        },
+        // 动态TLS访问
+        {
+            [](const monitor_options& o) { return o.tls_profile; },
+            [](struct dynlib_monitor_bpf *skel) {
+                return std::vector<struct bpf_program *>{skel->progs.trace_tls_get_addr,
+                                                         skel->progs.trace_tls_slow,
+                                                         skel->progs.trace_tls_slow_ret};
+            },
+            [](struct dynlib_monitor_bpf *skel, const monitor_options& o) { attach_tls_probes(skel); },
+            flush_tls_stats,
+            [](const monitor_options& o, double elapsed_s) { print_tls_report(elapsed_s); },
+        },
+    };
+    return features;
+}
+
+// 加载前关闭未开启功能的程序，被已开启功能共用的程序保留
+static void disable_unused_programs(struct dynlib_monitor_bpf *skel, const monitor_options& opts)
+{
+    std::set<struct bpf_program *> optional, used;
+    for (const monitor_feature& feature : monitor_features()) {
+        if (!feature.programs) {
+            continue;
+        }
+        for (struct bpf_program *prog : feature.programs(skel)) {
+            optional.insert(prog);
+            if (feature.enabled(opts)) {
+                used.insert(prog);
+            }
+        }
+    }
+    for (struct bpf_program *prog : optional) {
+        if (!used.count(prog)) {
+            bpf_program__set_autoload(prog, false);
+        }
+    }
+}
+
+// 附加已开启功能的探针
+static void attach_features(struct dynlib_monitor_bpf *skel, const monitor_options& opts)
+{
+    for (const monitor_feature& feature : monitor_features()) {
+        if (feature.attach && feature.enabled(opts)) {
+            feature.attach(skel, opts);
+        }
+    }
+}
+
+// 读取并清空已开启功能的内核统计，累计到用户空间
+static void flush_features(struct dynlib_monitor_bpf *skel, const monitor_options& opts)
+{
+    for (const monitor_feature& feature : monitor_features()) {
+        if (feature.flush && feature.enabled(opts)) {
+            feature.flush(skel);
+        }
+    }
+    if (opts.stack_capture || opts.offcpu_profile) {
+        reclaim_user_stacks(skel);
+    }
+}
+
+// 输出已开启功能的报告
+static void report_features(const monitor_options& opts, double elapsed_s)
+{
+    for (const monitor_feature& feature : monitor_features()) {
+        if (feature.report && feature.enabled(opts)) {
+            feature.report(opts, elapsed_s);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // 设置标准输出为无缓冲模式
+    std::cout.setf(std::ios::unitbuf);
+    
+    struct dynlib_monitor_bpf *skel;
+    struct ring_buffer *rb = NULL;
+    __u64 start_ns = 0;
+    __u64 last_flush_ns = 0;
+    __u64 reported_drops = 0;
+    int err = 0;
+    bool use_multi = false;
+
+    // 设置信号处理
+    signal(SIGINT, sig_handler);
+    signal(SIGTERM, sig_handler);
+
+    monitor_options opts;
+    if (!parse_args(argc, argv, opts, err)) {
+        return err;
+    }
+    bool filter = !opts.target_pids.empty() || !opts.target_comms.empty();
+
+    // 发现系统和容器中使用的C库和动态链接器，其中的结构偏移要在加载前写入只读配置
+    discover_dl_libraries();
+
+    // 打开 BPF 程序，加载前设置只读配置
+    skel = dynlib_monitor_bpf__open();
+    if (!skel) {
+        std::cerr << "无法打开 BPF 程序" << std::endl;
+        return 1;
+    }
+    skel->rodata->filter_targets = filter;
+    skel->rodata->monitor_tgid = getpid();
+    setup_pid_namespace(skel);
+    skel->rodata->aggregate_mode = opts.aggregate;
+    bpf_map__set_max_entries(skel->maps.handle_to_path, opts.max_handles);
+    bpf_map__set_max_entries(skel->maps.handle_counts, opts.max_handles);
+    skel->rodata->lookup_profile = opts.lookup_profile;
+    skel->rodata->lazy_binding = opts.lazy_binding;
+    skel->rodata->lazy_sample_rate = opts.lazy_sample;
+    skel->rodata->lock_contention = opts.lock_contention;
+    skel->rodata->unwind_profile = opts.unwind_profile;
+    skel->rodata->tls_profile = opts.tls_profile;
+    skel->rodata->tls_sample_rate = opts.tls_sample;
+    if (opts.tls_profile) {
+        skel->rodata->tls_modid_offset = find_tls_modid_offset();
+        if (!skel->rodata->tls_modid_offset) {
+            std::cout << "未能从动态链接器读取l_tls_modid的偏移（可能已剥离符号表），TLS模块只显示编号"
+                      << std::endl;
+        }
+    }
+    skel->rodata->reloc_profile = opts.reloc_profile;
+    skel->rodata->namespace_profile = opts.namespace_profile;
+    skel->rodata->syscall_profile = opts.syscall_profile && !opts.aggregate;
+    skel->rodata->search_probes = opts.search_probes;
+    skel->rodata->fault_profile = opts.fault_profile;
+    skel->rodata->fault_window_ns = opts.fault_window * 1000000000ULL;
+    skel->rodata->offcpu_profile = opts.offcpu_profile;
+    skel->rodata->stack_capture = opts.stack_capture;
+    disable_unused_programs(skel, opts);
+
+    // uprobe-multi程序需在加载前设置附加类型，一个链接即可覆盖一个库中的探针
+    use_multi = kernel_has_uprobe_multi();
+#if LIBBPF_MAJOR_VERSION > 1 || (LIBBPF_MAJOR_VERSION == 1 && LIBBPF_MINOR_VERSION >= 3)
+    if (use_multi) {
+        for (const dl_probe& probe : dl_probes(skel)) {
+            bpf_program__set_expected_attach_type(probe.prog, BPF_TRACE_UPROBE_MULTI);
+        }
+    }
+#endif
+
+    // 加载 BPF 程序
+    err = dynlib_monitor_bpf__load(skel);
+    if (err) {
+        std::cerr << "无法加载 BPF 程序" << std::endl;
+        goto cleanup;
+    }
+
+    // 附加进程生命周期跟踪点，dl*探针没有指定库路径，不会被自动附加
+    err = dynlib_monitor_bpf__attach(skel);
+    if (err) {
+        std::cerr << "无法附加 BPF 程序" << std::endl;
+        goto cleanup;
+    }
+
+    // 按函数名附加dl*探针
+    err = attach_dl_probes(skel, use_multi);
+    if (err) {
+        std::cerr << "未能在任何C库中附加dlopen等探针" << std::endl;
+        goto cleanup;
+    }
+    attach_rtld_probes(skel);
+    attach_init_fini_probes(skel);
+    attach_features(skel, opts);
+
+    // 设置目标进程集合；在附加之后扫描已有进程，避免遗漏期间fork的子进程
+    if (filter) {
+        err = setup_targets(skel, opts);
+        if (err) {
+            std::cerr << "无法设置目标进程" << std::endl;
+            goto cleanup;
+        }
+        for (const std::string& comm : opts.target_comms) {
+            std::cout << "将只监控进程: " << comm << std::endl;
+        }
+        for (__u32 pid : opts.target_pids) {
+            std::cout << "将只监控进程ID: " << pid << std::endl;
+        }
+    } else {
+        std::cout << "将监控所有进程（除了自己）" << std::endl;
+    }
+
+    if (opts.stack_capture) {
+        user_stacks_fd = bpf_map__fd(skel->maps.user_stacks);
+    }
+    lib_paths.fd = bpf_map__fd(skel->maps.lib_paths);
+    lib_paths.value_size = MAX_PATH_LEN;
+    symbol_names.fd = bpf_map__fd(skel->maps.symbol_names);
+    symbol_names.value_size = MAX_SYMBOL_LEN;
+
+    // 设置环形缓冲区
+    rb = ring_buffer__new(bpf_map__fd(skel->maps.events), handle_event, NULL, NULL);
+    if (!rb) {
+        err = -1;
+        std::cerr << "无法创建环形缓冲区" << std::endl;
+        goto cleanup;
+    }
+
+    std::cout << "动态库监控程序已启动..." << (opts.aggregate ? "（聚合模式）" : "") << "\n" << std::endl;
+    start_ns = get_monotonic_ns();
+    last_flush_ns = start_ns;
+
+    // 主循环
+    while (!exiting) {
+        err = ring_buffer__poll(rb, 100);
+        if (err == -EINTR) {
+            err = 0;
+            continue;
+        }
+        if (err < 0) {
+            printf("错误: ring_buffer__poll 返回 %d\n", err);
+            break;
+        }
+        report_lost_events(skel, reported_drops);
+
+        // 周期性地读取并清空内核统计，聚合模式下同时输出
+        if (get_monotonic_ns() - last_flush_ns >= opts.interval * 1000000000ULL) {
+            if (opts.aggregate) {
+                flush_aggregates(skel);
+            }
+            flush_features(skel, opts);
+            lib_paths.collect();
+            symbol_names.collect();
+            last_flush_ns = get_monotonic_ns();
+        }
+    }
+
+    if (opts.aggregate) {
+        // 先处理缓冲区中剩余的事件，已退出进程的汇总不会被重复输出
+        ring_buffer__consume(rb);
+        flush_aggregates(skel);
+        flush_live_proc_stats(skel);
+    }
+    flush_features(skel, opts);
+    print_latency_report();
+    print_rtld_report();
+    report_features(opts, (get_monotonic_ns() - start_ns) / 1e9);
+    print_statistics(skel, start_ns);
+
+cleanup:
+    ring_buffer__free(rb);
+    for (struct bpf_link *link : uprobe_links) {
+        bpf_link__destroy(link);
+    }
     dynlib_monitor_bpf__destroy(skel);
     return err < 0 ? -err : 0;
 }
\ No newline at end of file
@@ -0,0 +1,497 @@
+#ifndef DYNLIB_MONITOR_H
+#define DYNLIB_MONITOR_H
+
+/*
+ * 内核BPF程序与用户空间监控程序共享的定义
+ * 使用前需先引入__u64等类型的定义（vmlinux.h或linux/types.h）
+ */
+
+#define TASK_COMM_LEN   16
+#define MAX_PATH_LEN    4096    ///< 库路径最大长度（PATH_MAX，含结尾'\0'）
+#define MAX_SYMBOL_LEN  1024    ///< 符号名最大长度（含结尾'\0'）
+#define MAX_SLOTS       32      ///< log2延迟直方图的桶数（单位纳秒）
+
+/**
+ * @brief C库编号（附加cookie）中表示glibc内部接口的标志位
+ * 附加到__libc_dlopen_mode/__libc_dlsym/__libc_dlclose时置位，
+ * 这些是glibc加载NSS、gconv模块和libgcc_s时使用的内部接口，不经过dlopen
+ */
+#define LIBC_ID_INTERNAL 0x80000000u
+
+/**
+ * @brief C库编号（附加cookie）中表示扩展接口的标志位
+ * 附加到dlmopen/dlvsym时置位，与dlopen/dlsym共用返回探针
+ */
+#define LIBC_ID_VARIANT 0x40000000u
+
+#define LM_ID_NEWLM_UNKNOWN (-1)    ///< dlmopen(LM_ID_NEWLM)且未能取得新命名空间的编号
+
+/**
+ * @brief 事件类型
+ */
+enum event_type {
+    EVENT_DLOPEN = 1,   ///< 动态库加载
+    EVENT_DLCLOSE = 2,  ///< 动态库卸载
+    EVENT_DLSYM = 3,    ///< 符号解析
+    EVENT_PROC_SUMMARY = 4, ///< 聚合模式下进程退出时的汇总
+    EVENT_RTLD_PHASE = 5,   ///< 动态链接器（ld.so）的一个处理阶段完成
+    EVENT_LAZY_BIND = 6,    ///< 首次调用PLT函数时的延迟绑定（_dl_fixup）
+    EVENT_CTOR = 7,         ///< 库的构造函数（DT_INIT/DT_INIT_ARRAY）执行完成
+    EVENT_DTOR = 8,         ///< 库的析构函数（DT_FINI/DT_FINI_ARRAY）执行完成
+    EVENT_DLOPEN_SYSCALLS = 9,  ///< 一次dlopen期间调用线程的系统调用分解
+    EVENT_SEARCH_PROBE = 10,    ///< 搜索库文件时一次失败的打开尝试
+    EVENT_DLOPEN_ERROR = 11,    ///< dlopen期间动态链接器报告的错误（dlerror的内容）
+};
+
+/**
+ * @brief 库搜索探测发生的场景
+ */
+enum search_context {
+    SEARCH_CTX_DLOPEN = 0,  ///< dlopen/dlmopen调用期间
+    SEARCH_CTX_STARTUP = 1, ///< 进程启动时加载DT_NEEDED依赖（需要rtld SDT探针）
+};
+
+/**
+ * @brief 动态链接器的处理阶段，对应glibc rtld的SDT探针
+ */
+enum rtld_phase {
+    RTLD_PHASE_INIT = 0,    ///< 启动时加载DT_NEEDED依赖（init_start/init_complete）
+    RTLD_PHASE_MAP = 1,     ///< dlopen映射新对象（map_start/map_complete）
+    RTLD_PHASE_RELOC = 2,   ///< 重定位新加载的对象（reloc_start/reloc_complete）
+    RTLD_PHASE_UNMAP = 3,   ///< 卸载对象（unmap_start/unmap_complete）
+    RTLD_PHASE_MAX = 4,
+};
+
+/**
+ * @brief 构造/析构耗时的来源探针，同时作为附加cookie
+ *
+ * 优先使用逐库调用的call_init和_dl_call_fini（glibc 2.37+）；找不到时
+ * 退而使用_dl_init、_dl_close_worker和_dl_fini，耗时记在被加载/卸载的
+ * 库（或整个进程）上，包含其依赖库
+ */
+enum init_fini_source {
+    SRC_CALL_INIT = 0,      ///< call_init：单个库的构造函数
+    SRC_DL_INIT = 1,        ///< _dl_init：一次加载的全部构造函数
+    SRC_CALL_FINI = 2,      ///< _dl_call_fini：单个库的析构函数
+    SRC_CLOSE_WORKER = 3,   ///< _dl_close_worker：一次dlclose的全部卸载工作
+    SRC_DL_FINI = 4,        ///< _dl_fini：进程退出时的全部析构函数
+};
+
+/**
+ * @brief 构造/析构函数的执行场景
+ */
+enum init_context {
+    INIT_CTX_STARTUP = 0,   ///< 进程启动
+    INIT_CTX_DLOPEN = 1,    ///< dlopen
+    INIT_CTX_DLCLOSE = 2,   ///< dlclose
+    INIT_CTX_EXIT = 3,      ///< 进程退出
+};
+
+/**
+ * @brief 动态链接器的全局锁
+ */
+enum loader_lock {
+    LOCK_LOAD = 0,          ///< dl_load_lock：dlopen/dlclose/dlsym
+    LOCK_LOAD_WRITE = 1,    ///< dl_load_write_lock：dl_iterate_phdr等遍历已加载对象的操作
+    LOCK_MAX = 2,
+};
+
+/**
+ * @brief 线程当前进行的动态链接操作，用于归因锁等待
+ */
+enum loader_op {
+    OP_NONE = 0,            ///< 不在已跟踪的操作中
+    OP_DLOPEN = 1,
+    OP_DLCLOSE = 2,
+    OP_DLSYM = 3,
+    OP_ITERATE_PHDR = 4,    ///< dl_iterate_phdr（如C++异常展开器查找FDE）
+};
+
+/**
+ * @brief 锁等待统计的键
+ * 按（进程, 锁, 等待方操作, 持有方操作, 持有方操作的库）统计
+ */
+struct lock_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 lock;         ///< 锁（enum loader_lock）
+    __u32 waiter_op;    ///< 等待方正在进行的操作（enum loader_op）
+    __u32 holder_op;    ///< 持有方正在进行的操作（enum loader_op）
+    __u64 holder_path;  ///< 持有方操作的库路径编号（如dlopen的请求库名），0表示未知
+};
+
+/**
+ * @brief 遍历已加载对象的接口，同时作为附加cookie
+ */
+enum dl_api {
+    API_DL_ITERATE_PHDR = 0,    ///< dl_iterate_phdr
+    API_DLADDR = 1,             ///< dladdr
+    API_DLADDR1 = 2,            ///< dladdr1
+    API_UNWIND_FIND_FDE = 3,    ///< libgcc_s的_Unwind_Find_FDE（异常展开）
+    API_MAX = 4,
+};
+
+/**
+ * @brief 遍历接口统计的键
+ */
+struct api_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 api;          ///< 接口（enum dl_api）
+    __u64 caller_id;    ///< 调用方模块文件名的编号（在lib_paths中），0表示未知
+};
+
+/**
+ * @brief 遍历接口统计的值
+ */
+struct api_value {
+    __u64 calls;              ///< 调用次数
+    __u64 total_ns;           ///< 累计耗时（纳秒）
+    __u64 objects;            ///< 每次调用时已加载对象数的累加，除以object_samples为平均值
+    __u64 object_samples;     ///< 取得了已加载对象数的调用次数（进程的对象数尚未统计时不计入）
+    __u32 slots[MAX_SLOTS];   ///< 耗时的log2直方图
+};
+
+/**
+ * @brief 动态TLS访问的入口，同时作为附加cookie
+ */
+enum tls_entry {
+    TLS_GET_ADDR = 0,       ///< __tls_get_addr（general/local-dynamic模型）
+    TLS_DESC_DYNAMIC = 1,   ///< _dl_tlsdesc_dynamic（TLS描述符模型）
+};
+
+/**
+ * @brief TLS访问统计的键
+ */
+struct tls_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 pad;          ///< 对齐填充，需置0
+    __u64 modid;        ///< TLS模块编号（tls_index.ti_module）
+};
+
+/**
+ * @brief TLS访问统计的值
+ */
+struct tls_value {
+    __u64 calls;        ///< 访问次数（按采样率放大的估计值）
+    __u64 slow_calls;   ///< 进入慢路径（首次访问时分配TLS块）的次数
+    __u64 slow_ns;      ///< 慢路径累计耗时（纳秒）
+    __u64 path_id;      ///< 模块的库路径编号，0表示未能解析
+    __u32 resolved;     ///< 是否已尝试解析模块路径
+    __u32 pad;          ///< 对齐填充
+};
+
+/**
+ * @brief 按线程统计TLS慢路径的键
+ */
+struct tls_thread_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 tid;          ///< 线程ID
+};
+
+/**
+ * @brief 按线程统计TLS慢路径的值
+ */
+struct tls_thread_value {
+    __u64 slow_calls;   ///< 进入慢路径的次数
+    __u64 slow_ns;      ///< 慢路径累计耗时（纳秒）
+};
+
+/**
+ * @brief 重定位统计的值，按库路径编号统计
+ */
+struct reloc_value {
+    __u64 loads;            ///< 重定位次数（每次加载一次）
+    __u64 total_ns;         ///< _dl_relocate_object累计耗时（纳秒），包含IFUNC解析函数
+    __u64 max_ns;           ///< 单次重定位的最长耗时（纳秒）
+    __u64 ifunc_calls;      ///< 重定位期间调用IFUNC解析函数的次数
+    __u64 ifunc_ns;         ///< IFUNC解析函数累计耗时（纳秒）
+    __u32 relocs;           ///< 动态段中的重定位项数（DT_RELA/DT_REL，不含PLT）
+    __u32 relative_relocs;  ///< 其中的相对重定位数（DT_RELACOUNT/DT_RELCOUNT）
+    __u32 plt_relocs;       ///< PLT重定位项数（DT_PLTRELSZ），延迟绑定时不在加载时处理
+    __u32 pad;              ///< 对齐填充
+};
+
+/**
+ * @brief 加载阶段的触发场景
+ */
+enum rtld_context {
+    RTLD_CTX_STARTUP = 0,   ///< 进程启动
+    RTLD_CTX_DLOPEN = 1,    ///< dlopen/dlclose调用期间
+    RTLD_CTX_MAX = 2,
+};
+
+/**
+ * @brief 事件记录
+ *
+ * 每次完成的dlopen/dlsym/dlclose调用对应一条记录，在函数返回时一次性输出，
+ * 同时包含调用参数、结果和耗时。
+ * 记录由定长头部和变长字符串区组成，字符串按实际长度拷贝，
+ * 记录总长度为 sizeof(struct event) + path_len + symbol_len
+ */
+struct event {
+    int event_type;         ///< 事件类型（enum event_type）
+    int flags;              ///< dlopen的标志；加载阶段事件中为阶段（enum rtld_phase），
+                            ///< 构造/析构事件中为来源探针（enum init_fini_source），
+                            ///< 搜索探测事件中为场景（enum search_context）
+    __u64 timestamp;        ///< 调用开始的时间戳（纳秒）
+    __u32 pid;              ///< 进程ID
+    __u32 tid;              ///< 线程ID
+    __u32 uid;              ///< 用户ID
+    int result;             ///< 调用结果：dlclose的返回值，dlopen/dlsym返回NULL时为-1，成功为0；
+                            ///< 加载阶段事件中为触发场景（enum rtld_context），
+                            ///< 构造/析构事件中为执行场景（enum init_context），
+                            ///< 搜索探测和错误事件中为errno
+    char comm[TASK_COMM_LEN]; ///< 进程名
+    __u64 lib_addr;         ///< 动态库句柄；加载阶段事件中为新加载对象的link_map
+    __u64 base_addr;        ///< 动态库实际加载基址（link_map->l_addr）
+    __u64 path_id;          ///< 库路径在lib_paths中的编号，0表示未知；延迟绑定事件中为调用方对象
+    __u64 def_path_id;      ///< 延迟绑定事件中符号定义所在对象的路径编号
+    __u64 symbol_addr;      ///< 符号地址（延迟绑定事件中为绑定到的函数地址）；
+                            ///< 加载阶段事件中为扣除嵌套阶段后的独占耗时（纳秒）
+    __u64 duration_ns;      ///< 本次调用的耗时（纳秒）
+    __u64 caller_addr;      ///< glibc内部dlopen/dlsym的调用方返回地址，用于推断触发的C库接口
+    __s64 lmid;             ///< 链接映射命名空间（Lmid_t），0为默认命名空间
+    __u32 libc_id;          ///< 触发探针的C库编号（附加时的cookie），0表示未知；
+                            ///< 带LIBC_ID_INTERNAL标志时为glibc内部调用
+    __u32 search_probes;    ///< dlopen期间失败的打开尝试次数（--search-probes）
+    int stack_id;           ///< dlopen/dlsym调用点在user_stacks中的用户栈编号（--stacks），
+                            ///< 负数表示未取到
+    __u16 path_len;         ///< data中库路径的长度（含结尾'\0'），0表示不携带路径
+    __u16 symbol_len;       ///< data中符号名的长度（含结尾'\0'），dlopen记录中为请求加载的库名
+    char data[];            ///< 变长字符串区：库路径之后紧跟符号名（或请求的库名）；
+                            ///< dlvsym记录的库路径区为请求的符号版本；
+                            ///< 搜索探测事件为探测的路径和请求的库名；错误事件为对象名和错误信息
+};
+
+/**
+ * @brief 已加载库的信息
+ */
+struct handle_info {
+    __u64 path_id;     ///< 库路径在lib_paths中的编号
+    __u64 base_addr;   ///< 库的加载基址
+    __s64 lmid;        ///< 所在的链接映射命名空间
+};
+
+/**
+ * @brief 句柄映射的键
+ * 句柄只在所属进程内有意义，以（进程ID, 句柄）区分不同进程中相同的句柄值
+ */
+struct handle_key {
+    __u32 tgid;     ///< 进程ID
+    __u32 pad;      ///< 对齐填充，需置0
+    __u64 handle;   ///< dlopen返回的库句柄
+};
+
+/**
+ * @brief 对象缓存中的对象信息
+ * 符号查找、延迟绑定等按link_map取得对象路径，结果缓存在独立的表中，
+ * 不混入dlopen句柄映射，不影响句柄计数和泄漏统计
+ */
+struct object_info {
+    __u64 path_id;      ///< 库路径编号，主程序为0
+    __u64 base_addr;    ///< 加载基址（l_addr）
+    __u64 name_addr;    ///< l_name指针，与基址一起确认缓存项仍对应同一对象
+    __s64 lmid;         ///< 所在的链接映射命名空间
+};
+
+/**
+ * @brief 聚合统计的键
+ * 按（进程, 操作, 库, 符号）聚合，库和符号都以字符串表中的编号表示
+ */
+struct agg_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 event_type;   ///< 操作类型（enum event_type）
+    __u64 path_id;      ///< 库路径编号，0表示未知
+    __u64 symbol_id;    ///< 符号名编号，非dlsym操作为0
+};
+
+/**
+ * @brief 聚合统计的值
+ */
+struct agg_value {
+    __u64 calls;              ///< 调用次数
+    __u64 failures;           ///< 失败次数
+    __u64 total_ns;           ///< 累计耗时（纳秒）
+    __u32 slots[MAX_SLOTS];   ///< 耗时的log2直方图，第i个桶统计[2^i, 2^(i+1))纳秒
+};
+
+/**
+ * @brief 符号查找统计的键
+ * 按（进程, 发起查找的对象, 符号）统计_dl_lookup_symbol_x的开销
+ */
+struct lookup_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 pad;          ///< 对齐填充，需置0
+    __u64 object_id;    ///< 发起查找的对象（undef_map）的路径编号，0表示主程序
+    __u64 symbol_id;    ///< 符号名编号
+};
+
+/**
+ * @brief 符号查找统计的值
+ */
+struct lookup_value {
+    __u64 calls;          ///< 查找次数
+    __u64 failures;       ///< 未找到定义的次数
+    __u64 total_ns;       ///< 累计耗时（纳秒）
+    __u64 scope_entries;  ///< 命中前累计搜索的作用域对象数
+    __u32 max_entries;    ///< 单次查找搜索的最多对象数
+    __u32 pad;            ///< 对齐填充
+};
+
+/**
+ * @brief 延迟绑定统计的键
+ */
+struct lazy_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 pad;          ///< 对齐填充，需置0
+    __u64 path_id;      ///< 发生绑定的调用方对象的路径编号，0表示主程序
+};
+
+/**
+ * @brief 延迟绑定统计的值（不受采样影响，统计全部绑定）
+ */
+struct lazy_value {
+    __u64 bindings;     ///< 绑定次数
+    __u64 total_ns;     ///< 累计绑定耗时（纳秒）
+    __u64 first_ts;     ///< 首次绑定的时间戳（纳秒）
+    __u64 last_ts;      ///< 最近一次绑定的时间戳（纳秒）
+};
+
+/**
+ * @brief 单个进程的动态链接操作汇总
+ */
+struct proc_stats {
+    __u64 calls[EVENT_DLSYM + 1];     ///< 按操作类型统计的调用次数
+    __u64 failures[EVENT_DLSYM + 1];  ///< 按操作类型统计的失败次数
+    __u64 total_ns;                   ///< 动态链接操作累计耗时（纳秒）
+    __u64 phase_ns[RTLD_CTX_MAX][RTLD_PHASE_MAX];  ///< 按场景和阶段统计的动态链接器独占耗时（纳秒），
+                                                   ///< 不含嵌套在其中的其他阶段
+};
+
+/**
+ * @brief dlopen期间系统调用的分类
+ */
+enum dl_syscall {
+    SC_OPEN = 0,        ///< open/openat/openat2
+    SC_READ = 1,        ///< read/pread64
+    SC_MMAP = 2,        ///< mmap
+    SC_MPROTECT = 3,    ///< mprotect
+    SC_MUNMAP = 4,      ///< munmap
+    SC_STAT = 5,        ///< fstat/newfstatat/statx
+    SC_CLOSE = 6,       ///< close
+    SC_OTHER = 7,       ///< 其他系统调用
+    SC_MAX = 8,
+};
+
+/**
+ * @brief 一次dlopen期间调用线程的系统调用统计
+ */
+struct syscall_breakdown {
+    __u32 count[SC_MAX];      ///< 按分类统计的调用次数
+    __u64 time_ns[SC_MAX];    ///< 按分类统计的耗时（纳秒）
+    __u64 bytes_read;         ///< read/pread64读取的字节数
+    __u64 bytes_mapped;       ///< mmap成功映射的字节数
+    __u64 total_ns;           ///< 系统调用总耗时（纳秒）
+};
+
+/**
+ * @brief dlopen系统调用分解记录（EVENT_DLOPEN_SYSCALLS），紧跟在对应的dlopen事件之后输出
+ */
+struct dlopen_syscalls_event {
+    int event_type;             ///< 固定为EVENT_DLOPEN_SYSCALLS，与struct event首字段对齐
+    __u32 pid;                  ///< 进程ID
+    __u64 timestamp;            ///< dlopen开始的时间戳（纳秒）
+    __u32 tid;                  ///< 线程ID
+    __u32 pad;                  ///< 对齐填充
+    __u64 path_id;              ///< 加载的库路径编号
+    __u64 duration_ns;          ///< dlopen的总耗时（纳秒）
+    char comm[TASK_COMM_LEN];   ///< 进程名
+    struct syscall_breakdown stats; ///< 系统调用统计
+};
+
+/**
+ * @brief 库搜索统计的值，按最终打开成功的路径统计
+ */
+struct search_value {
+    __u64 hits;         ///< 打开成功的次数
+    __u64 probes;       ///< 打开成功前失败的尝试总数
+    __u64 probe_ns;     ///< 失败尝试的累计耗时（纳秒）
+    __u32 max_probes;   ///< 单次打开前最多的失败尝试数
+    __u32 pad;
+};
+
+/**
+ * @brief 按库统计的加载后缺页（--fault-profile）
+ */
+struct fault_value {
+    __u64 loads;        ///< 记录的加载次数
+    __u64 minor;        ///< 次缺页数
+    __u64 major;        ///< 主缺页数（需要读盘）
+    __u64 minor_ns;     ///< 次缺页的处理耗时（纳秒）
+    __u64 major_ns;     ///< 主缺页的处理耗时（纳秒）
+    __u64 retry_ns;     ///< 释放mmap锁等待I/O后重试的尝试耗时（纳秒）
+    __u64 cache_pages;  ///< 缺页期间加入页缓存的页数（页缓存未命中）
+};
+
+#define MAX_STACK_DEPTH 32   ///< 用户栈最多记录的帧数
+
+/**
+ * @brief 线程在dl*调用中被切出的原因
+ */
+enum offcpu_reason {
+    OFFCPU_IO = 0,          ///< 等待块设备I/O（in_iowait）
+    OFFCPU_FUTEX = 1,       ///< 阻塞在futex中（如等待dl_load_lock）
+    OFFCPU_OTHER = 2,       ///< 其他阻塞
+    OFFCPU_PREEMPT = 3,     ///< 被抢占，仍可运行
+    OFFCPU_MAX = 4,
+};
+
+/**
+ * @brief off-CPU统计的键
+ */
+struct offcpu_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 op;           ///< 进行中的操作（enum loader_op）
+    __u64 path_id;      ///< 操作的库路径编号（dlopen为请求的库名）
+    __u32 reason;       ///< 切出原因（enum offcpu_reason）
+    __s32 stack_id;     ///< user_stacks中的用户栈编号，负数表示未取到
+};
+
+/**
+ * @brief 调用点统计的键
+ */
+struct callsite_key {
+    __u32 tgid;         ///< 进程ID
+    __u32 op;           ///< 操作（enum loader_op，OP_DLOPEN或OP_DLSYM）
+    __s32 stack_id;     ///< user_stacks中的用户栈编号
+    __u32 pad;
+};
+
+/**
+ * @brief 调用点统计的值
+ */
+struct callsite_value {
+    __u64 calls;        ///< 调用次数
+    __u64 total_ns;     ///< 累计耗时（纳秒）
+};
+
+/**
+ * @brief off-CPU统计的值
+ */
+struct offcpu_value {
+    __u64 count;        ///< 切出次数
+    __u64 total_ns;     ///< 累计off-CPU时间（纳秒）
+    __u64 max_ns;       ///< 单次最长off-CPU时间（纳秒）
+};
+
+/**
+ * @brief 进程退出时输出的汇总记录（EVENT_PROC_SUMMARY）
+ */
+struct proc_summary_event {
+    int event_type;             ///< 固定为EVENT_PROC_SUMMARY，与struct event首字段对齐
+    __u32 pid;                  ///< 进程ID
+    __u64 timestamp;            ///< 进程退出的时间戳（纳秒）
+    char comm[TASK_COMM_LEN];   ///< 进程名
+    struct proc_stats stats;    ///< 汇总数据
+};
+
+#endif // DYNLIB_MONITOR_H
@@ -1,1730 +0,0 @@
-/* SPDX-License-Identifier: (LGPL-2.1 OR BSD-2-Clause) */
-
-/* THIS FILE IS AUTOGENERATED BY BPFTOOL! */
-#ifndef __DYNLIB_MONITOR_BPF_SKEL_H__
-#define __DYNLIB_MONITOR_BPF_SKEL_H__
-
-#include <errno.h>
-#include <stdlib.h>
-#include <bpf/libbpf.h>
-
-#define BPF_SKEL_SUPPORTS_MAP_AUTO_ATTACH 1
-
-struct dynlib_monitor_bpf {
-	struct bpf_object_skeleton *skeleton;
-	struct bpf_object *obj;
-	struct {
-		struct bpf_map *handle_to_path;
-		struct bpf_map *events;
-		struct bpf_map *temp_path;
-		struct bpf_map *target_process;
-		struct bpf_map *monitor_process;
-	} maps;
-	struct {
-		struct bpf_program *trace_dlopen;
-		struct bpf_program *trace_dlopen_ret;
-		struct bpf_program *trace_dlclose;
-		struct bpf_program *trace_dlclose_ret;
-		struct bpf_program *trace_dlsym;
-		struct bpf_program *trace_dlsym_ret;
-	} progs;
-	struct {
-		struct bpf_link *trace_dlopen;
-		struct bpf_link *trace_dlopen_ret;
-		struct bpf_link *trace_dlclose;
-		struct bpf_link *trace_dlclose_ret;
-		struct bpf_link *trace_dlsym;
-		struct bpf_link *trace_dlsym_ret;
-	} links;
-
-#ifdef __cplusplus
-	static inline struct dynlib_monitor_bpf *open(const struct bpf_object_open_opts *opts = nullptr);
-	static inline struct dynlib_monitor_bpf *open_and_load();
-	static inline int load(struct dynlib_monitor_bpf *skel);
-	static inline int attach(struct dynlib_monitor_bpf *skel);
-	static inline void detach(struct dynlib_monitor_bpf *skel);
-	static inline void destroy(struct dynlib_monitor_bpf *skel);
-	static inline const void *elf_bytes(size_t *sz);
-#endif /* __cplusplus */
-};
-
-static void
-dynlib_monitor_bpf__destroy(struct dynlib_monitor_bpf *obj)
-{
-	if (!obj)
-		return;
-	if (obj->skeleton)
-		bpf_object__destroy_skeleton(obj->skeleton);
-	free(obj);
-}
-
-static inline int
-dynlib_monitor_bpf__create_skeleton(struct dynlib_monitor_bpf *obj);
-
-static inline struct dynlib_monitor_bpf *
-dynlib_monitor_bpf__open_opts(const struct bpf_object_open_opts *opts)
-{
-	struct dynlib_monitor_bpf *obj;
-	int err;
-
-	obj = (struct dynlib_monitor_bpf *)calloc(1, sizeof(*obj));
-	if (!obj) {
-		errno = ENOMEM;
-		return NULL;
-	}
-
-	err = dynlib_monitor_bpf__create_skeleton(obj);
-	if (err)
-		goto err_out;
-
-	err = bpf_object__open_skeleton(obj->skeleton, opts);
-	if (err)
-		goto err_out;
-
-	return obj;
-err_out:
-	dynlib_monitor_bpf__destroy(obj);
-	errno = -err;
-	return NULL;
-}
-
-static inline struct dynlib_monitor_bpf *
-dynlib_monitor_bpf__open(void)
-{
-	return dynlib_monitor_bpf__open_opts(NULL);
-}
-
-static inline int
-dynlib_monitor_bpf__load(struct dynlib_monitor_bpf *obj)
-{
-	return bpf_object__load_skeleton(obj->skeleton);
-}
-
-static inline struct dynlib_monitor_bpf *
-dynlib_monitor_bpf__open_and_load(void)
-{
-	struct dynlib_monitor_bpf *obj;
-	int err;
-
-	obj = dynlib_monitor_bpf__open();
-	if (!obj)
-		return NULL;
-	err = dynlib_monitor_bpf__load(obj);
-	if (err) {
-		dynlib_monitor_bpf__destroy(obj);
-		errno = -err;
-		return NULL;
-	}
-	return obj;
-}
-
-static inline int
-dynlib_monitor_bpf__attach(struct dynlib_monitor_bpf *obj)
-{
-	return bpf_object__attach_skeleton(obj->skeleton);
-}
-
-static inline void
-dynlib_monitor_bpf__detach(struct dynlib_monitor_bpf *obj)
-{
-	bpf_object__detach_skeleton(obj->skeleton);
-}
-
-static inline const void *dynlib_monitor_bpf__elf_bytes(size_t *sz);
-
-static inline int
-dynlib_monitor_bpf__create_skeleton(struct dynlib_monitor_bpf *obj)
-{
-	struct bpf_object_skeleton *s;
-	struct bpf_map_skeleton *map __attribute__((unused));
-	int err;
-
-	s = (struct bpf_object_skeleton *)calloc(1, sizeof(*s));
-	if (!s)	{
-		err = -ENOMEM;
-		goto err;
-	}
-
-	s->sz = sizeof(*s);
-	s->name = "dynlib_monitor_bpf";
-	s->obj = &obj->obj;
-
-	/* maps */
-	s->map_cnt = 5;
-	s->map_skel_sz = 24;
-	s->maps = (struct bpf_map_skeleton *)calloc(s->map_cnt,
-			sizeof(*s->maps) > 24 ? sizeof(*s->maps) : 24);
-	if (!s->maps) {
-		err = -ENOMEM;
-		goto err;
-	}
-
-	map = (struct bpf_map_skeleton *)((char *)s->maps + 0 * s->map_skel_sz);
-	map->name = "handle_to_path";
-	map->map = &obj->maps.handle_to_path;
-
-	map = (struct bpf_map_skeleton *)((char *)s->maps + 1 * s->map_skel_sz);
-	map->name = "events";
-	map->map = &obj->maps.events;
-
-	map = (struct bpf_map_skeleton *)((char *)s->maps + 2 * s->map_skel_sz);
-	map->name = "temp_path";
-	map->map = &obj->maps.temp_path;
-
-	map = (struct bpf_map_skeleton *)((char *)s->maps + 3 * s->map_skel_sz);
-	map->name = "target_process";
-	map->map = &obj->maps.target_process;
-
-	map = (struct bpf_map_skeleton *)((char *)s->maps + 4 * s->map_skel_sz);
-	map->name = "monitor_process";
-	map->map = &obj->maps.monitor_process;
-
-	/* programs */
-	s->prog_cnt = 6;
-	s->prog_skel_sz = sizeof(*s->progs);
-	s->progs = (struct bpf_prog_skeleton *)calloc(s->prog_cnt, s->prog_skel_sz);
-	if (!s->progs) {
-		err = -ENOMEM;
-		goto err;
-	}
-
-	s->progs[0].name = "trace_dlopen";
-	s->progs[0].prog = &obj->progs.trace_dlopen;
-	s->progs[0].link = &obj->links.trace_dlopen;
-
-	s->progs[1].name = "trace_dlopen_ret";
-	s->progs[1].prog = &obj->progs.trace_dlopen_ret;
-	s->progs[1].link = &obj->links.trace_dlopen_ret;
-
-	s->progs[2].name = "trace_dlclose";
-	s->progs[2].prog = &obj->progs.trace_dlclose;
-	s->progs[2].link = &obj->links.trace_dlclose;
-
-	s->progs[3].name = "trace_dlclose_ret";
-	s->progs[3].prog = &obj->progs.trace_dlclose_ret;
-	s->progs[3].link = &obj->links.trace_dlclose_ret;
-
-	s->progs[4].name = "trace_dlsym";
-	s->progs[4].prog = &obj->progs.trace_dlsym;
-	s->progs[4].link = &obj->links.trace_dlsym;
-
-	s->progs[5].name = "trace_dlsym_ret";
-	s->progs[5].prog = &obj->progs.trace_dlsym_ret;
-	s->progs[5].link = &obj->links.trace_dlsym_ret;
-
-	s->data = dynlib_monitor_bpf__elf_bytes(&s->data_sz);
-
-	obj->skeleton = s;
-	return 0;
-err:
-	bpf_object__destroy_skeleton(s);
-	return err;
-}
-
-static inline const void *dynlib_monitor_bpf__elf_bytes(size_t *sz)
-{
-	static const char data[] __attribute__((__aligned__(8))) = "\
-\x7f\x45\x4c\x46\x02\x01\x01\0\0\0\0\0\0\0\0\0\x01\0\xf7\0\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x10\x8d\0\0\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\x40\0\x26\0\
-\x01\0\xbf\xa1\0\0\0\0\0\0\x07\x01\0\0\xf0\xff\xff\xff\xb7\x02\0\0\x10\0\0\0\
-\x85\0\0\0\x10\0\0\0\xb7\x01\0\0\0\0\0\0\x63\x1a\xec\xff\0\0\0\0\xbf\xa2\0\0\0\
-\0\0\0\x07\x02\0\0\xec\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\
-\0\x01\0\0\0\xbf\x01\0\0\0\0\0\0\x15\x01\x08\0\0\0\0\0\x71\x12\0\0\0\0\0\0\x15\
-\x02\x06\0\0\0\0\0\x71\xa3\xf0\xff\0\0\0\0\x1d\x32\x01\0\0\0\0\0\x05\0\x03\0\0\
-\0\0\0\x71\x12\x01\0\0\0\0\0\x71\xa3\xf1\xff\0\0\0\0\x1d\x32\x12\0\0\0\0\0\xbf\
-\xa2\0\0\0\0\0\0\x07\x02\0\0\xec\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x85\0\0\0\x01\0\0\0\xbf\x01\0\0\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x01\x09\0\0\
-\0\0\0\x71\x12\0\0\0\0\0\0\x15\x02\x07\0\0\0\0\0\x71\xa3\xf0\xff\0\0\0\0\xb7\0\
-\0\0\0\0\0\0\x1d\x32\x01\0\0\0\0\0\x05\0\x03\0\0\0\0\0\x71\x12\x01\0\0\0\0\0\
-\x71\xa3\xf1\xff\0\0\0\0\x1d\x32\x3d\0\0\0\0\0\x95\0\0\0\0\0\0\0\xb7\0\0\0\0\0\
-\0\0\x15\x02\xfd\xff\0\0\0\0\x71\x12\x02\0\0\0\0\0\x71\xa3\xf2\xff\0\0\0\0\x5d\
-\x32\xe9\xff\0\0\0\0\x15\x02\xf9\xff\0\0\0\0\x71\x12\x03\0\0\0\0\0\x71\xa3\xf3\
-\xff\0\0\0\0\x5d\x32\xe5\xff\0\0\0\0\x15\x02\xf5\xff\0\0\0\0\x71\x12\x04\0\0\0\
-\0\0\x71\xa3\xf4\xff\0\0\0\0\x5d\x32\xe1\xff\0\0\0\0\x15\x02\xf1\xff\0\0\0\0\
-\x71\x12\x05\0\0\0\0\0\x71\xa3\xf5\xff\0\0\0\0\x5d\x32\xdd\xff\0\0\0\0\x15\x02\
-\xed\xff\0\0\0\0\x71\x12\x06\0\0\0\0\0\x71\xa3\xf6\xff\0\0\0\0\x5d\x32\xd9\xff\
-\0\0\0\0\x15\x02\xe9\xff\0\0\0\0\x71\x12\x07\0\0\0\0\0\x71\xa3\xf7\xff\0\0\0\0\
-\x5d\x32\xd5\xff\0\0\0\0\x15\x02\xe5\xff\0\0\0\0\x71\x12\x08\0\0\0\0\0\x71\xa3\
-\xf8\xff\0\0\0\0\x5d\x32\xd1\xff\0\0\0\0\x15\x02\xe1\xff\0\0\0\0\x71\x12\x09\0\
-\0\0\0\0\x71\xa3\xf9\xff\0\0\0\0\x5d\x32\xcd\xff\0\0\0\0\x15\x02\xdd\xff\0\0\0\
-\0\x71\x12\x0a\0\0\0\0\0\x71\xa3\xfa\xff\0\0\0\0\x5d\x32\xc9\xff\0\0\0\0\x15\
-\x02\xd9\xff\0\0\0\0\x71\x12\x0b\0\0\0\0\0\x71\xa3\xfb\xff\0\0\0\0\x5d\x32\xc5\
-\xff\0\0\0\0\x15\x02\xd5\xff\0\0\0\0\x71\x12\x0c\0\0\0\0\0\x71\xa3\xfc\xff\0\0\
-\0\0\x5d\x32\xc1\xff\0\0\0\0\x15\x02\xd1\xff\0\0\0\0\x71\x12\x0d\0\0\0\0\0\x71\
-\xa3\xfd\xff\0\0\0\0\x5d\x32\xbd\xff\0\0\0\0\x15\x02\xcd\xff\0\0\0\0\x71\x12\
-\x0e\0\0\0\0\0\x71\xa3\xfe\xff\0\0\0\0\x5d\x32\xb9\xff\0\0\0\0\x15\x02\xc9\xff\
-\0\0\0\0\x71\x11\x0f\0\0\0\0\0\x71\xa2\xff\xff\0\0\0\0\x4f\x21\0\0\0\0\0\0\x57\
-\x01\0\0\xff\0\0\0\x15\x01\xc4\xff\0\0\0\0\x05\0\xb2\xff\0\0\0\0\xb7\0\0\0\x01\
-\0\0\0\x15\x02\xc1\xff\0\0\0\0\x71\x12\x02\0\0\0\0\0\x71\xa3\xf2\xff\0\0\0\0\
-\xb7\0\0\0\0\0\0\0\x5d\x32\xbd\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x02\xbb\xff\
-\0\0\0\0\x71\x12\x03\0\0\0\0\0\x71\xa3\xf3\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\
-\x32\xb7\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x02\xb5\xff\0\0\0\0\x71\x12\x04\0\
-\0\0\0\0\x71\xa3\xf4\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\x32\xb1\xff\0\0\0\0\xb7\
-\0\0\0\x01\0\0\0\x15\x02\xaf\xff\0\0\0\0\x71\x12\x05\0\0\0\0\0\x71\xa3\xf5\xff\
-\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\x32\xab\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x02\
-\xa9\xff\0\0\0\0\x71\x12\x06\0\0\0\0\0\x71\xa3\xf6\xff\0\0\0\0\xb7\0\0\0\0\0\0\
-\0\x5d\x32\xa5\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x02\xa3\xff\0\0\0\0\x71\x12\
-\x07\0\0\0\0\0\x71\xa3\xf7\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\x32\x9f\xff\0\0\0\
-\0\xb7\0\0\0\x01\0\0\0\x15\x02\x9d\xff\0\0\0\0\x71\x12\x08\0\0\0\0\0\x71\xa3\
-\xf8\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\x32\x99\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\
-\x15\x02\x97\xff\0\0\0\0\x71\x12\x09\0\0\0\0\0\x71\xa3\xf9\xff\0\0\0\0\xb7\0\0\
-\0\0\0\0\0\x5d\x32\x93\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x02\x91\xff\0\0\0\0\
-\x71\x12\x0a\0\0\0\0\0\x71\xa3\xfa\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\x32\x8d\
-\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x02\x8b\xff\0\0\0\0\x71\x12\x0b\0\0\0\0\0\
-\x71\xa3\xfb\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\x32\x87\xff\0\0\0\0\xb7\0\0\0\
-\x01\0\0\0\x15\x02\x85\xff\0\0\0\0\x71\x12\x0c\0\0\0\0\0\x71\xa3\xfc\xff\0\0\0\
-\0\xb7\0\0\0\0\0\0\0\x5d\x32\x81\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x02\x7f\
-\xff\0\0\0\0\x71\x12\x0d\0\0\0\0\0\x71\xa3\xfd\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\
-\x5d\x32\x7b\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\x15\x02\x79\xff\0\0\0\0\x71\x12\
-\x0e\0\0\0\0\0\x71\xa3\xfe\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\x32\x75\xff\0\0\0\
-\0\xb7\0\0\0\x01\0\0\0\x15\x02\x73\xff\0\0\0\0\x71\x11\x0f\0\0\0\0\0\x71\xa2\
-\xff\xff\0\0\0\0\xb7\0\0\0\0\0\0\0\x5d\x21\x6f\xff\0\0\0\0\xb7\0\0\0\x01\0\0\0\
-\x05\0\x6d\xff\0\0\0\0\xbf\x16\0\0\0\0\0\0\x79\x68\x68\0\0\0\0\0\x79\x67\x70\0\
-\0\0\0\0\x85\x10\0\0\xff\xff\xff\xff\x57\0\0\0\x01\0\0\0\x15\0\x3f\0\0\0\0\0\
-\xb7\x09\0\0\0\0\0\0\x7b\x9a\xf8\xff\0\0\0\0\x7b\x9a\xf0\xff\0\0\0\0\x7b\x9a\
-\xe8\xff\0\0\0\0\x7b\x9a\xe0\xff\0\0\0\0\x7b\x9a\xd8\xff\0\0\0\0\x7b\x9a\xd0\
-\xff\0\0\0\0\x7b\x9a\xc8\xff\0\0\0\0\x7b\x9a\xc0\xff\0\0\0\0\x7b\x9a\xb8\xff\0\
-\0\0\0\x7b\x9a\xb0\xff\0\0\0\0\x7b\x9a\xa8\xff\0\0\0\0\x7b\x9a\xa0\xff\0\0\0\0\
-\x7b\x9a\x98\xff\0\0\0\0\x7b\x9a\x90\xff\0\0\0\0\x7b\x9a\x88\xff\0\0\0\0\x7b\
-\x9a\x80\xff\0\0\0\0\x7b\x9a\x78\xff\0\0\0\0\x7b\x9a\x70\xff\0\0\0\0\x85\0\0\0\
-\x05\0\0\0\x7b\x0a\x60\xff\0\0\0\0\x85\0\0\0\x0e\0\0\0\x77\0\0\0\x20\0\0\0\x63\
-\x0a\x68\xff\0\0\0\0\x85\0\0\0\x0f\0\0\0\x63\x0a\x6c\xff\0\0\0\0\xbf\xa1\0\0\0\
-\0\0\0\x07\x01\0\0\x70\xff\xff\xff\xb7\x02\0\0\x10\0\0\0\x85\0\0\0\x10\0\0\0\
-\x7b\x8a\x10\xff\0\0\0\0\xbf\xa8\0\0\0\0\0\0\x07\x08\0\0\x20\xff\xff\xff\xbf\
-\x81\0\0\0\0\0\0\xb7\x02\0\0\x40\0\0\0\xbf\x73\0\0\0\0\0\0\x85\0\0\0\x72\0\0\0\
-\x63\x9a\x1c\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\x1c\xff\xff\xff\x18\
-\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbf\x83\0\0\0\0\0\0\xb7\x04\0\0\0\0\0\0\x85\0\
-\0\0\x02\0\0\0\xbf\xa1\0\0\0\0\0\0\x07\x01\0\0\x80\xff\xff\xff\xb7\x02\0\0\x40\
-\0\0\0\xbf\x73\0\0\0\0\0\0\x85\0\0\0\x72\0\0\0\x79\xa1\x10\xff\0\0\0\0\x63\x1a\
-\xec\xff\0\0\0\0\xb7\x01\0\0\x01\0\0\0\x63\x1a\xe8\xff\0\0\0\0\xbf\xa4\0\0\0\0\
-\0\0\x07\x04\0\0\x60\xff\xff\xff\xbf\x61\0\0\0\0\0\0\x18\x02\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\x18\x03\0\0\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xb7\x05\0\0\xa0\0\0\0\
-\x85\0\0\0\x19\0\0\0\xb7\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\xbf\x18\0\0\0\0\0\0\
-\x79\x86\x50\0\0\0\0\0\x85\x10\0\0\xff\xff\xff\xff\x57\0\0\0\x01\0\0\0\x15\0\
-\x2f\x01\0\0\0\0\x7b\x6a\xf8\xff\0\0\0\0\xb7\x07\0\0\0\0\0\0\x7b\x7a\xf0\xff\0\
-\0\0\0\x7b\x7a\xe8\xff\0\0\0\0\x7b\x7a\xe0\xff\0\0\0\0\x7b\x7a\xd8\xff\0\0\0\0\
-\x7b\x7a\xd0\xff\0\0\0\0\x7b\x7a\xc8\xff\0\0\0\0\x7b\x7a\xc0\xff\0\0\0\0\x7b\
-\x7a\xb8\xff\0\0\0\0\x7b\x7a\xb0\xff\0\0\0\0\x7b\x7a\xa8\xff\0\0\0\0\x7b\x7a\
-\xa0\xff\0\0\0\0\x7b\x7a\x98\xff\0\0\0\0\x7b\x7a\x90\xff\0\0\0\0\x7b\x7a\x88\
-\xff\0\0\0\0\x7b\x7a\x80\xff\0\0\0\0\x7b\x7a\x78\xff\0\0\0\0\x7b\x7a\x70\xff\0\
-\0\0\0\x7b\x7a\x68\xff\0\0\0\0\x85\0\0\0\x05\0\0\0\x7b\x0a\x58\xff\0\0\0\0\x85\
-\0\0\0\x0e\0\0\0\x77\0\0\0\x20\0\0\0\x63\x0a\x60\xff\0\0\0\0\x85\0\0\0\x0f\0\0\
-\0\x63\x0a\x64\xff\0\0\0\0\xbf\xa1\0\0\0\0\0\0\x07\x01\0\0\x68\xff\xff\xff\xb7\
-\x02\0\0\x10\0\0\0\x85\0\0\0\x10\0\0\0\xb7\x01\0\0\x01\0\0\0\x63\x1a\xe0\xff\0\
-\0\0\0\x7b\x6a\xb8\xff\0\0\0\0\x63\x7a\x54\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\
-\x02\0\0\x54\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\
-\0\x15\0\xfd\0\0\0\0\0\x15\x06\xfc\0\0\0\0\0\xbf\xa7\0\0\0\0\0\0\x07\x07\0\0\
-\x14\xff\xff\xff\xbf\x71\0\0\0\0\0\0\xb7\x02\0\0\x40\0\0\0\xbf\x03\0\0\0\0\0\0\
-\x85\0\0\0\x73\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xf8\xff\xff\xff\x18\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\xbf\x73\0\0\0\0\0\0\xb7\x04\0\0\0\0\0\0\x85\0\0\0\
-\x02\0\0\0\x71\xa2\x1d\xff\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\xa1\x1c\xff\0\0\0\
-\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xd8\xfe\0\0\0\0\x71\xa2\x15\xff\0\0\0\0\x67\x02\
-\0\0\x08\0\0\0\x71\xa1\x14\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xd0\xfe\0\0\
-\0\0\x71\xa2\x39\xff\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\xa1\x38\xff\0\0\0\0\x4f\
-\x12\0\0\0\0\0\0\x7b\x2a\xc8\xfe\0\0\0\0\x71\xa2\x31\xff\0\0\0\0\x67\x02\0\0\
-\x08\0\0\0\x71\xa1\x30\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xc0\xfe\0\0\0\0\
-\x71\xa2\x29\xff\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\xa1\x28\xff\0\0\0\0\x4f\x12\
-\0\0\0\0\0\0\x7b\x2a\xb8\xfe\0\0\0\0\x71\xa2\x21\xff\0\0\0\0\x67\x02\0\0\x08\0\
-\0\0\x71\xa1\x20\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xa8\xfe\0\0\0\0\x71\
-\xa2\x19\xff\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\xa1\x18\xff\0\0\0\0\x4f\x12\0\0\
-\0\0\0\0\x7b\x2a\x98\xfe\0\0\0\0\x71\xa2\x45\xff\0\0\0\0\x67\x02\0\0\x08\0\0\0\
-\x71\xa1\x44\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xb0\xfe\0\0\0\0\x71\xa1\
-\x46\xff\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\xa2\x47\xff\0\0\0\0\x67\x02\0\0\x18\
-\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xa0\xfe\0\0\0\0\x71\xa2\x3d\xff\0\0\0\0\x67\
-\x02\0\0\x08\0\0\0\x71\xa1\x3c\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x90\xfe\
-\0\0\0\0\x71\xa1\x3e\xff\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\xa2\x3f\xff\0\0\0\0\
-\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xf8\xfe\0\0\0\0\x71\xa2\x35\
-\xff\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\xa1\x34\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\
-\x7b\x2a\x88\xfe\0\0\0\0\x71\xa1\x36\xff\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\xa2\
-\x37\xff\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x08\xff\0\0\
-\0\0\x71\xa2\x2d\xff\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\xa1\x2c\xff\0\0\0\0\x4f\
-\x12\0\0\0\0\0\0\x7b\x2a\x80\xfe\0\0\0\0\x71\xa1\x2e\xff\0\0\0\0\x67\x01\0\0\
-\x10\0\0\0\x71\xa2\x2f\xff\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\0\0\
-\x7b\x2a\0\xff\0\0\0\0\x71\xa9\x25\xff\0\0\0\0\x67\x09\0\0\x08\0\0\0\x71\xa1\
-\x24\xff\0\0\0\0\x4f\x19\0\0\0\0\0\0\x71\xa1\x26\xff\0\0\0\0\x67\x01\0\0\x10\0\
-\0\0\x71\xa5\x27\xff\0\0\0\0\x67\x05\0\0\x18\0\0\0\x4f\x15\0\0\0\0\0\0\x71\xa1\
-\x1e\xff\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\xa2\x1f\xff\0\0\0\0\x67\x02\0\0\x18\
-\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xf0\xfe\0\0\0\0\x71\xa1\x16\xff\0\0\0\0\x67\
-\x01\0\0\x10\0\0\0\x71\xa2\x17\xff\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\
-\0\0\0\x7b\x2a\xe8\xfe\0\0\0\0\x71\xa1\x3a\xff\0\0\0\0\x67\x01\0\0\x10\0\0\0\
-\x71\xa6\x3b\xff\0\0\0\0\x67\x06\0\0\x18\0\0\0\x4f\x16\0\0\0\0\0\0\x71\xa1\x32\
-\xff\0\0\0\0\x67\x01\0\0\x10\0\0\0\x7b\x8a\xe0\xfe\0\0\0\0\x71\xa7\x33\xff\0\0\
-\0\0\x67\x07\0\0\x18\0\0\0\x4f\x17\0\0\0\0\0\0\x71\xa1\x2a\xff\0\0\0\0\x67\x01\
-\0\0\x10\0\0\0\x71\xa8\x2b\xff\0\0\0\0\x67\x08\0\0\x18\0\0\0\x4f\x18\0\0\0\0\0\
-\0\x71\xa1\x22\xff\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\xa0\x23\xff\0\0\0\0\x67\0\
-\0\0\x18\0\0\0\x4f\x10\0\0\0\0\0\0\x71\xa1\x1a\xff\0\0\0\0\x67\x01\0\0\x10\0\0\
-\0\x71\xa4\x1b\xff\0\0\0\0\x67\x04\0\0\x18\0\0\0\x4f\x14\0\0\0\0\0\0\x71\xa1\
-\x41\xff\0\0\0\0\x67\x01\0\0\x08\0\0\0\x71\xa2\x40\xff\0\0\0\0\x4f\x21\0\0\0\0\
-\0\0\x71\xa2\x42\xff\0\0\0\0\x67\x02\0\0\x10\0\0\0\x71\xa3\x43\xff\0\0\0\0\x67\
-\x03\0\0\x18\0\0\0\x4f\x23\0\0\0\0\0\0\x4f\x13\0\0\0\0\0\0\x79\xa1\x98\xfe\0\0\
-\0\0\x4f\x14\0\0\0\0\0\0\x79\xa1\xa8\xfe\0\0\0\0\x4f\x10\0\0\0\0\0\0\x79\xa1\
-\xb8\xfe\0\0\0\0\x4f\x18\0\0\0\0\0\0\x79\xa1\xc0\xfe\0\0\0\0\x4f\x17\0\0\0\0\0\
-\0\x79\xa1\xc8\xfe\0\0\0\0\x4f\x16\0\0\0\0\0\0\x79\xa1\xd0\xfe\0\0\0\0\x79\xa2\
-\xe8\xfe\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xe8\xfe\0\0\0\0\x79\xa1\xd8\xfe\0\
-\0\0\0\x79\xa2\xf0\xfe\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xf0\xfe\0\0\0\0\x4f\
-\x95\0\0\0\0\0\0\x7b\x5a\xd8\xfe\0\0\0\0\x79\xa1\0\xff\0\0\0\0\x79\xa2\x80\xfe\
-\0\0\0\0\x4f\x21\0\0\0\0\0\0\x7b\x1a\0\xff\0\0\0\0\x79\xa1\x08\xff\0\0\0\0\x79\
-\xa2\x88\xfe\0\0\0\0\x4f\x21\0\0\0\0\0\0\x7b\x1a\x08\xff\0\0\0\0\x79\xa1\x90\
-\xfe\0\0\0\0\x79\xa2\xf8\xfe\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xf8\xfe\0\0\0\
-\0\x79\xa5\xa0\xfe\0\0\0\0\x79\xa1\xb0\xfe\0\0\0\0\x4f\x15\0\0\0\0\0\0\x71\xa1\
-\x49\xff\0\0\0\0\x67\x01\0\0\x08\0\0\0\x71\xa2\x48\xff\0\0\0\0\x4f\x21\0\0\0\0\
-\0\0\x71\xa2\x4a\xff\0\0\0\0\x67\x02\0\0\x10\0\0\0\x71\xa9\x4b\xff\0\0\0\0\x67\
-\x09\0\0\x18\0\0\0\x4f\x29\0\0\0\0\0\0\x4f\x19\0\0\0\0\0\0\x67\x09\0\0\x20\0\0\
-\0\x4f\x59\0\0\0\0\0\0\x67\x03\0\0\x20\0\0\0\x79\xa1\xf8\xfe\0\0\0\0\x4f\x13\0\
-\0\0\0\0\0\x67\x06\0\0\x20\0\0\0\x79\xa1\x08\xff\0\0\0\0\x4f\x16\0\0\0\0\0\0\
-\xbf\x62\0\0\0\0\0\0\x67\x07\0\0\x20\0\0\0\x79\xa1\0\xff\0\0\0\0\x4f\x17\0\0\0\
-\0\0\0\xbf\x75\0\0\0\0\0\0\x67\x08\0\0\x20\0\0\0\x79\xa1\xd8\xfe\0\0\0\0\x4f\
-\x18\0\0\0\0\0\0\x67\0\0\0\x20\0\0\0\x79\xa1\xf0\xfe\0\0\0\0\x4f\x10\0\0\0\0\0\
-\0\x67\x04\0\0\x20\0\0\0\x79\xa1\xe8\xfe\0\0\0\0\x4f\x14\0\0\0\0\0\0\x71\xa7\
-\x4d\xff\0\0\0\0\x67\x07\0\0\x08\0\0\0\x71\xa1\x4c\xff\0\0\0\0\x4f\x17\0\0\0\0\
-\0\0\x71\xa1\x4e\xff\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\xa6\x4f\xff\0\0\0\0\x67\
-\x06\0\0\x18\0\0\0\x4f\x16\0\0\0\0\0\0\x7b\x4a\x78\xff\0\0\0\0\x7b\x0a\x80\xff\
-\0\0\0\0\x7b\x8a\x88\xff\0\0\0\0\x7b\x5a\x90\xff\0\0\0\0\x79\xa8\xe0\xfe\0\0\0\
-\0\x7b\x2a\x98\xff\0\0\0\0\x7b\x3a\xa0\xff\0\0\0\0\x7b\x9a\xa8\xff\0\0\0\0\x4f\
-\x76\0\0\0\0\0\0\x71\xa1\x51\xff\0\0\0\0\x67\x01\0\0\x08\0\0\0\x71\xa2\x50\xff\
-\0\0\0\0\x4f\x21\0\0\0\0\0\0\x71\xa2\x52\xff\0\0\0\0\x67\x02\0\0\x10\0\0\0\x71\
-\xa3\x53\xff\0\0\0\0\x67\x03\0\0\x18\0\0\0\x4f\x23\0\0\0\0\0\0\x4f\x13\0\0\0\0\
-\0\0\x67\x03\0\0\x20\0\0\0\x4f\x63\0\0\0\0\0\0\x7b\x3a\xb0\xff\0\0\0\0\xbf\xa2\
-\0\0\0\0\0\0\x07\x02\0\0\x54\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x85\0\0\0\x03\0\0\0\xbf\xa4\0\0\0\0\0\0\x07\x04\0\0\x58\xff\xff\xff\xbf\x81\0\
-\0\0\0\0\0\x18\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x18\x03\0\0\xff\xff\xff\xff\0\0\
-\0\0\0\0\0\0\xb7\x05\0\0\xa0\0\0\0\x85\0\0\0\x19\0\0\0\xb7\0\0\0\0\0\0\0\x95\0\
-\0\0\0\0\0\0\xbf\x17\0\0\0\0\0\0\x79\x76\x70\0\0\0\0\0\x85\x10\0\0\xff\xff\xff\
-\xff\x57\0\0\0\x01\0\0\0\x15\0\x23\x01\0\0\0\0\xb7\x01\0\0\0\0\0\0\x7b\x1a\xf8\
-\xff\0\0\0\0\x7b\x1a\xf0\xff\0\0\0\0\x7b\x1a\xe8\xff\0\0\0\0\x7b\x1a\xe0\xff\0\
-\0\0\0\x7b\x1a\xd8\xff\0\0\0\0\x7b\x1a\xd0\xff\0\0\0\0\x7b\x1a\xc8\xff\0\0\0\0\
-\x7b\x1a\xc0\xff\0\0\0\0\x7b\x1a\xb8\xff\0\0\0\0\x7b\x1a\xb0\xff\0\0\0\0\x7b\
-\x1a\xa8\xff\0\0\0\0\x7b\x1a\xa0\xff\0\0\0\0\x7b\x1a\x98\xff\0\0\0\0\x7b\x1a\
-\x90\xff\0\0\0\0\x7b\x1a\x88\xff\0\0\0\0\x7b\x1a\x80\xff\0\0\0\0\x7b\x1a\x78\
-\xff\0\0\0\0\x7b\x1a\x70\xff\0\0\0\0\x85\0\0\0\x05\0\0\0\x7b\x0a\x60\xff\0\0\0\
-\0\x85\0\0\0\x0e\0\0\0\x77\0\0\0\x20\0\0\0\x63\x0a\x68\xff\0\0\0\0\x85\0\0\0\
-\x0f\0\0\0\x63\x0a\x6c\xff\0\0\0\0\xbf\xa1\0\0\0\0\0\0\x07\x01\0\0\x70\xff\xff\
-\xff\xb7\x02\0\0\x10\0\0\0\x85\0\0\0\x10\0\0\0\xb7\x01\0\0\x02\0\0\0\x63\x1a\
-\xe8\xff\0\0\0\0\x7b\x6a\xc0\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xc0\
-\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x7b\x2a\x38\xff\0\0\0\0\x85\0\
-\0\0\x01\0\0\0\x15\0\xf2\0\0\0\0\0\x71\x02\x31\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\
-\x71\x01\x30\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xe8\xfe\0\0\0\0\x71\x02\x39\
-\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x38\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\
-\x2a\x28\xff\0\0\0\0\x71\x02\x15\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x14\0\
-\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x20\xff\0\0\0\0\x71\x02\x1d\0\0\0\0\0\x67\
-\x02\0\0\x08\0\0\0\x71\x01\x1c\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x18\xff\0\
-\0\0\0\x71\x02\x25\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x24\0\0\0\0\0\x4f\
-\x12\0\0\0\0\0\0\x7b\x2a\x08\xff\0\0\0\0\x71\x02\x2d\0\0\0\0\0\x67\x02\0\0\x08\
-\0\0\0\x71\x01\x2c\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xf8\xfe\0\0\0\0\x71\
-\x02\x35\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x34\0\0\0\0\0\x4f\x12\0\0\0\0\
-\0\0\x7b\x2a\xd8\xfe\0\0\0\0\x71\x02\x09\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\
-\x01\x08\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x10\xff\0\0\0\0\x71\x01\x0a\0\0\
-\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x02\x0b\0\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\
-\x12\0\0\0\0\0\0\x7b\x2a\0\xff\0\0\0\0\x71\x02\x11\0\0\0\0\0\x67\x02\0\0\x08\0\
-\0\0\x71\x01\x10\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xf0\xfe\0\0\0\0\x71\x01\
-\x12\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x02\x13\0\0\0\0\0\x67\x02\0\0\x18\0\0\
-\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xe0\xfe\0\0\0\0\x71\x02\x19\0\0\0\0\0\x67\x02\0\
-\0\x08\0\0\0\x71\x01\x18\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xd0\xfe\0\0\0\0\
-\x71\x01\x1a\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x02\x1b\0\0\0\0\0\x67\x02\0\0\
-\x18\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x58\xff\0\0\0\0\x71\x02\x21\0\0\0\0\0\
-\x67\x02\0\0\x08\0\0\0\x71\x01\x20\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xc8\
-\xfe\0\0\0\0\x71\x01\x22\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x02\x23\0\0\0\0\0\
-\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x50\xff\0\0\0\0\x71\x02\x29\
-\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x28\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\
-\x2a\xc0\xfe\0\0\0\0\x71\x01\x2a\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x02\x2b\0\
-\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x48\xff\0\0\0\0\x71\
-\x01\x32\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x02\x33\0\0\0\0\0\x67\x02\0\0\x18\
-\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x40\xff\0\0\0\0\x71\x01\x3a\0\0\0\0\0\x67\
-\x01\0\0\x10\0\0\0\x71\x08\x3b\0\0\0\0\0\x67\x08\0\0\x18\0\0\0\x4f\x18\0\0\0\0\
-\0\0\x71\x01\x16\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x09\x17\0\0\0\0\0\x67\x09\
-\0\0\x18\0\0\0\x4f\x19\0\0\0\0\0\0\x71\x01\x1e\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\
-\x71\x06\x1f\0\0\0\0\0\x67\x06\0\0\x18\0\0\0\x4f\x16\0\0\0\0\0\0\x71\x01\x26\0\
-\0\0\0\0\x67\x01\0\0\x10\0\0\0\x7b\x7a\x30\xff\0\0\0\0\x71\x03\x27\0\0\0\0\0\
-\x67\x03\0\0\x18\0\0\0\x4f\x13\0\0\0\0\0\0\x71\x01\x2e\0\0\0\0\0\x67\x01\0\0\
-\x10\0\0\0\x71\x07\x2f\0\0\0\0\0\x67\x07\0\0\x18\0\0\0\x4f\x17\0\0\0\0\0\0\x71\
-\x01\x36\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x05\x37\0\0\0\0\0\x67\x05\0\0\x18\
-\0\0\0\x4f\x15\0\0\0\0\0\0\x71\x01\x3d\0\0\0\0\0\x67\x01\0\0\x08\0\0\0\x71\x02\
-\x3c\0\0\0\0\0\x4f\x21\0\0\0\0\0\0\x71\x02\x3e\0\0\0\0\0\x67\x02\0\0\x10\0\0\0\
-\x71\x04\x3f\0\0\0\0\0\x67\x04\0\0\x18\0\0\0\x4f\x24\0\0\0\0\0\0\x4f\x14\0\0\0\
-\0\0\0\x79\xa1\xd8\xfe\0\0\0\0\x4f\x15\0\0\0\0\0\0\x79\xa1\xf8\xfe\0\0\0\0\x4f\
-\x17\0\0\0\0\0\0\x79\xa1\x08\xff\0\0\0\0\x4f\x13\0\0\0\0\0\0\x7b\x3a\x08\xff\0\
-\0\0\0\x79\xa1\x18\xff\0\0\0\0\x4f\x16\0\0\0\0\0\0\x7b\x6a\x18\xff\0\0\0\0\x79\
-\xa1\x20\xff\0\0\0\0\x4f\x19\0\0\0\0\0\0\x79\xa1\x28\xff\0\0\0\0\x4f\x18\0\0\0\
-\0\0\0\x7b\x8a\x28\xff\0\0\0\0\x79\xa1\xe8\xfe\0\0\0\0\x79\xa2\x40\xff\0\0\0\0\
-\x4f\x12\0\0\0\0\0\0\x7b\x2a\x40\xff\0\0\0\0\x79\xa1\xc0\xfe\0\0\0\0\x79\xa2\
-\x48\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x48\xff\0\0\0\0\x79\xa1\x50\xff\0\
-\0\0\0\x79\xa2\xc8\xfe\0\0\0\0\x4f\x21\0\0\0\0\0\0\x7b\x1a\x50\xff\0\0\0\0\x79\
-\xa1\xd0\xfe\0\0\0\0\x79\xa2\x58\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x58\
-\xff\0\0\0\0\x79\xa8\xe0\xfe\0\0\0\0\x79\xa1\xf0\xfe\0\0\0\0\x4f\x18\0\0\0\0\0\
-\0\x79\xa6\0\xff\0\0\0\0\x79\xa1\x10\xff\0\0\0\0\x4f\x16\0\0\0\0\0\0\x71\x02\
-\x0d\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x0c\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\
-\x71\x03\x0e\0\0\0\0\0\x67\x03\0\0\x10\0\0\0\x71\x01\x0f\0\0\0\0\0\x67\x01\0\0\
-\x18\0\0\0\x4f\x31\0\0\0\0\0\0\x4f\x21\0\0\0\0\0\0\x67\x01\0\0\x20\0\0\0\x4f\
-\x61\0\0\0\0\0\0\x67\x09\0\0\x20\0\0\0\x4f\x89\0\0\0\0\0\0\x7b\x9a\x20\xff\0\0\
-\0\0\x79\xa6\x18\xff\0\0\0\0\x67\x06\0\0\x20\0\0\0\x79\xa2\x58\xff\0\0\0\0\x4f\
-\x26\0\0\0\0\0\0\x79\xa3\x08\xff\0\0\0\0\x67\x03\0\0\x20\0\0\0\x79\xa2\x50\xff\
-\0\0\0\0\x4f\x23\0\0\0\0\0\0\x67\x07\0\0\x20\0\0\0\x79\xa2\x48\xff\0\0\0\0\x4f\
-\x27\0\0\0\0\0\0\x67\x05\0\0\x20\0\0\0\x79\xa2\x40\xff\0\0\0\0\x4f\x25\0\0\0\0\
-\0\0\x67\x04\0\0\x20\0\0\0\x79\xa2\x28\xff\0\0\0\0\x4f\x24\0\0\0\0\0\0\x71\x09\
-\x01\0\0\0\0\0\x67\x09\0\0\x08\0\0\0\x71\x02\0\0\0\0\0\0\x4f\x29\0\0\0\0\0\0\
-\x71\x02\x02\0\0\0\0\0\x67\x02\0\0\x10\0\0\0\x71\x08\x03\0\0\0\0\0\x67\x08\0\0\
-\x18\0\0\0\x4f\x28\0\0\0\0\0\0\x7b\x4a\xb8\xff\0\0\0\0\x7b\x5a\xb0\xff\0\0\0\0\
-\x7b\x7a\xa8\xff\0\0\0\0\x7b\x3a\xa0\xff\0\0\0\0\x79\xa7\x30\xff\0\0\0\0\x7b\
-\x6a\x98\xff\0\0\0\0\x79\xa2\x20\xff\0\0\0\0\x7b\x2a\x90\xff\0\0\0\0\x7b\x1a\
-\x88\xff\0\0\0\0\x4f\x98\0\0\0\0\0\0\x71\x01\x05\0\0\0\0\0\x67\x01\0\0\x08\0\0\
-\0\x71\x02\x04\0\0\0\0\0\x4f\x21\0\0\0\0\0\0\x71\x02\x06\0\0\0\0\0\x67\x02\0\0\
-\x10\0\0\0\x71\x03\x07\0\0\0\0\0\x67\x03\0\0\x18\0\0\0\x4f\x23\0\0\0\0\0\0\x4f\
-\x13\0\0\0\0\0\0\x67\x03\0\0\x20\0\0\0\x4f\x83\0\0\0\0\0\0\x7b\x3a\x80\xff\0\0\
-\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x79\xa2\x38\xff\0\0\0\0\x85\0\0\0\x03\
-\0\0\0\xbf\xa4\0\0\0\0\0\0\x07\x04\0\0\x60\xff\xff\xff\xbf\x71\0\0\0\0\0\0\x18\
-\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x18\x03\0\0\xff\xff\xff\xff\0\0\0\0\0\0\0\0\
-\xb7\x05\0\0\xa0\0\0\0\x85\0\0\0\x19\0\0\0\xb7\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\
-\xb7\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\xbf\x18\0\0\0\0\0\0\x79\x87\x68\0\0\0\0\0\
-\x79\x86\x70\0\0\0\0\0\x85\x10\0\0\xff\xff\xff\xff\x57\0\0\0\x01\0\0\0\x15\0\
-\x24\x01\0\0\0\0\xb7\x01\0\0\0\0\0\0\x7b\x1a\xf8\xff\0\0\0\0\x7b\x1a\xf0\xff\0\
-\0\0\0\x7b\x1a\xe8\xff\0\0\0\0\x7b\x1a\xe0\xff\0\0\0\0\x7b\x1a\xd8\xff\0\0\0\0\
-\x7b\x1a\xd0\xff\0\0\0\0\x7b\x1a\xc8\xff\0\0\0\0\x7b\x1a\xc0\xff\0\0\0\0\x7b\
-\x1a\xb8\xff\0\0\0\0\x7b\x1a\xb0\xff\0\0\0\0\x7b\x1a\xa8\xff\0\0\0\0\x7b\x1a\
-\xa0\xff\0\0\0\0\x7b\x1a\x98\xff\0\0\0\0\x7b\x1a\x90\xff\0\0\0\0\x7b\x1a\x88\
-\xff\0\0\0\0\x7b\x1a\x80\xff\0\0\0\0\x7b\x1a\x78\xff\0\0\0\0\x7b\x1a\x70\xff\0\
-\0\0\0\x85\0\0\0\x05\0\0\0\x7b\x0a\x60\xff\0\0\0\0\x85\0\0\0\x0e\0\0\0\x77\0\0\
-\0\x20\0\0\0\x63\x0a\x68\xff\0\0\0\0\x85\0\0\0\x0f\0\0\0\x63\x0a\x6c\xff\0\0\0\
-\0\xbf\xa1\0\0\0\0\0\0\x07\x01\0\0\x70\xff\xff\xff\xb7\x02\0\0\x10\0\0\0\x85\0\
-\0\0\x10\0\0\0\x7b\x6a\xc0\xff\0\0\0\0\xbf\xa1\0\0\0\0\0\0\x07\x01\0\0\xc8\xff\
-\xff\xff\xb7\x02\0\0\x20\0\0\0\xbf\x73\0\0\0\0\0\0\x85\0\0\0\x72\0\0\0\xb7\x01\
-\0\0\x03\0\0\0\x63\x1a\xe8\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xc0\xff\
-\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\x15\0\xef\0\0\
-\0\0\0\x71\x02\x31\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x30\0\0\0\0\0\x4f\
-\x12\0\0\0\0\0\0\x7b\x2a\xe0\xfe\0\0\0\0\x71\x02\x39\0\0\0\0\0\x67\x02\0\0\x08\
-\0\0\0\x71\x01\x38\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x28\xff\0\0\0\0\x71\
-\x02\x1d\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x1c\0\0\0\0\0\x4f\x12\0\0\0\0\
-\0\0\x7b\x2a\x20\xff\0\0\0\0\x71\x02\x25\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\
-\x01\x24\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x18\xff\0\0\0\0\x71\x02\x2d\0\0\
-\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x2c\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\
-\x10\xff\0\0\0\0\x71\x02\x35\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x34\0\0\0\
-\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\0\xff\0\0\0\0\x71\x02\x3d\0\0\0\0\0\x67\x02\0\
-\0\x08\0\0\0\x71\x01\x3c\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xf0\xfe\0\0\0\0\
-\x71\x02\x09\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x08\0\0\0\0\0\x4f\x12\0\0\
-\0\0\0\0\x7b\x2a\x08\xff\0\0\0\0\x71\x01\x0a\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\
-\x71\x02\x0b\0\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xf8\
-\xfe\0\0\0\0\x71\x02\x11\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x10\0\0\0\0\0\
-\x4f\x12\0\0\0\0\0\0\x7b\x2a\xe8\xfe\0\0\0\0\x71\x01\x12\0\0\0\0\0\x67\x01\0\0\
-\x10\0\0\0\x71\x02\x13\0\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\
-\x2a\x48\xff\0\0\0\0\x71\x02\x19\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\x01\x18\0\
-\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xd8\xfe\0\0\0\0\x71\x01\x1a\0\0\0\0\0\x67\
-\x01\0\0\x10\0\0\0\x71\x02\x1b\0\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\
-\0\0\x7b\x2a\x58\xff\0\0\0\0\x71\x02\x21\0\0\0\0\0\x67\x02\0\0\x08\0\0\0\x71\
-\x01\x20\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xd0\xfe\0\0\0\0\x71\x01\x22\0\0\
-\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x02\x23\0\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\
-\x12\0\0\0\0\0\0\x7b\x2a\x50\xff\0\0\0\0\x71\x02\x29\0\0\0\0\0\x67\x02\0\0\x08\
-\0\0\0\x71\x01\x28\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\xc8\xfe\0\0\0\0\x71\
-\x01\x2a\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x02\x2b\0\0\0\0\0\x67\x02\0\0\x18\
-\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x38\xff\0\0\0\0\x71\x01\x32\0\0\0\0\0\x67\
-\x01\0\0\x10\0\0\0\x71\x06\x33\0\0\0\0\0\x67\x06\0\0\x18\0\0\0\x4f\x16\0\0\0\0\
-\0\0\x71\x01\x3a\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x7b\x8a\x30\xff\0\0\0\0\x71\
-\x02\x3b\0\0\0\0\0\x67\x02\0\0\x18\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x40\xff\0\
-\0\0\0\x71\x01\x1e\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x08\x1f\0\0\0\0\0\x67\
-\x08\0\0\x18\0\0\0\x4f\x18\0\0\0\0\0\0\x71\x01\x26\0\0\0\0\0\x67\x01\0\0\x10\0\
-\0\0\x71\x09\x27\0\0\0\0\0\x67\x09\0\0\x18\0\0\0\x4f\x19\0\0\0\0\0\0\x71\x01\
-\x2e\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x03\x2f\0\0\0\0\0\x67\x03\0\0\x18\0\0\
-\0\x4f\x13\0\0\0\0\0\0\x71\x01\x36\0\0\0\0\0\x67\x01\0\0\x10\0\0\0\x71\x07\x37\
-\0\0\0\0\0\x67\x07\0\0\x18\0\0\0\x4f\x17\0\0\0\0\0\0\x71\x01\x3e\0\0\0\0\0\x67\
-\x01\0\0\x10\0\0\0\x71\x05\x3f\0\0\0\0\0\x67\x05\0\0\x18\0\0\0\x4f\x15\0\0\0\0\
-\0\0\x71\x01\x15\0\0\0\0\0\x67\x01\0\0\x08\0\0\0\x71\x02\x14\0\0\0\0\0\x4f\x21\
-\0\0\0\0\0\0\x71\x02\x16\0\0\0\0\0\x67\x02\0\0\x10\0\0\0\x71\x04\x17\0\0\0\0\0\
-\x67\x04\0\0\x18\0\0\0\x4f\x24\0\0\0\0\0\0\x4f\x14\0\0\0\0\0\0\x79\xa1\xf0\xfe\
-\0\0\0\0\x4f\x15\0\0\0\0\0\0\x79\xa1\0\xff\0\0\0\0\x4f\x17\0\0\0\0\0\0\x79\xa1\
-\x10\xff\0\0\0\0\x4f\x13\0\0\0\0\0\0\x7b\x3a\x10\xff\0\0\0\0\x79\xa1\x18\xff\0\
-\0\0\0\x4f\x19\0\0\0\0\0\0\x79\xa1\x20\xff\0\0\0\0\x4f\x18\0\0\0\0\0\0\x79\xa1\
-\x28\xff\0\0\0\0\x79\xa2\x40\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x40\xff\0\
-\0\0\0\x79\xa1\xe0\xfe\0\0\0\0\x4f\x16\0\0\0\0\0\0\x7b\x6a\x28\xff\0\0\0\0\x79\
-\xa1\xc8\xfe\0\0\0\0\x79\xa2\x38\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x38\
-\xff\0\0\0\0\x79\xa1\x50\xff\0\0\0\0\x79\xa2\xd0\xfe\0\0\0\0\x4f\x21\0\0\0\0\0\
-\0\x7b\x1a\x50\xff\0\0\0\0\x79\xa1\x58\xff\0\0\0\0\x79\xa2\xd8\xfe\0\0\0\0\x4f\
-\x21\0\0\0\0\0\0\x7b\x1a\x58\xff\0\0\0\0\x79\xa1\xe8\xfe\0\0\0\0\x79\xa2\x48\
-\xff\0\0\0\0\x4f\x12\0\0\0\0\0\0\x7b\x2a\x48\xff\0\0\0\0\x79\xa6\xf8\xfe\0\0\0\
-\0\x79\xa1\x08\xff\0\0\0\0\x4f\x16\0\0\0\0\0\0\x71\x02\x0d\0\0\0\0\0\x67\x02\0\
-\0\x08\0\0\0\x71\x01\x0c\0\0\0\0\0\x4f\x12\0\0\0\0\0\0\x71\x03\x0e\0\0\0\0\0\
-\x67\x03\0\0\x10\0\0\0\x71\x01\x0f\0\0\0\0\0\x67\x01\0\0\x18\0\0\0\x4f\x31\0\0\
-\0\0\0\0\x4f\x21\0\0\0\0\0\0\x67\x01\0\0\x20\0\0\0\x4f\x61\0\0\0\0\0\0\x67\x04\
-\0\0\x20\0\0\0\x79\xa2\x48\xff\0\0\0\0\x4f\x24\0\0\0\0\0\0\x67\x08\0\0\x20\0\0\
-\0\x79\xa2\x58\xff\0\0\0\0\x4f\x28\0\0\0\0\0\0\x7b\x8a\x58\xff\0\0\0\0\x67\x09\
-\0\0\x20\0\0\0\x79\xa2\x50\xff\0\0\0\0\x4f\x29\0\0\0\0\0\0\xbf\x96\0\0\0\0\0\0\
-\x79\xa3\x10\xff\0\0\0\0\x67\x03\0\0\x20\0\0\0\x79\xa2\x38\xff\0\0\0\0\x4f\x23\
-\0\0\0\0\0\0\x67\x07\0\0\x20\0\0\0\x79\xa2\x28\xff\0\0\0\0\x4f\x27\0\0\0\0\0\0\
-\x67\x05\0\0\x20\0\0\0\x79\xa2\x40\xff\0\0\0\0\x4f\x25\0\0\0\0\0\0\x71\x09\x01\
-\0\0\0\0\0\x67\x09\0\0\x08\0\0\0\x71\x02\0\0\0\0\0\0\x4f\x29\0\0\0\0\0\0\x71\
-\x02\x02\0\0\0\0\0\x67\x02\0\0\x10\0\0\0\x71\x08\x03\0\0\0\0\0\x67\x08\0\0\x18\
-\0\0\0\x4f\x28\0\0\0\0\0\0\x7b\x5a\xb8\xff\0\0\0\0\x7b\x7a\xb0\xff\0\0\0\0\x7b\
-\x3a\xa8\xff\0\0\0\0\x7b\x6a\xa0\xff\0\0\0\0\x79\xa2\x58\xff\0\0\0\0\x7b\x2a\
-\x98\xff\0\0\0\0\x7b\x4a\x90\xff\0\0\0\0\x7b\x1a\x88\xff\0\0\0\0\x4f\x98\0\0\0\
-\0\0\0\x71\x01\x05\0\0\0\0\0\x67\x01\0\0\x08\0\0\0\x71\x02\x04\0\0\0\0\0\x4f\
-\x21\0\0\0\0\0\0\x71\x02\x06\0\0\0\0\0\x67\x02\0\0\x10\0\0\0\x71\x03\x07\0\0\0\
-\0\0\x67\x03\0\0\x18\0\0\0\x4f\x23\0\0\0\0\0\0\x4f\x13\0\0\0\0\0\0\x67\x03\0\0\
-\x20\0\0\0\x4f\x83\0\0\0\0\0\0\x79\xa8\x30\xff\0\0\0\0\x7b\x3a\x80\xff\0\0\0\0\
-\xbf\xa4\0\0\0\0\0\0\x07\x04\0\0\x60\xff\xff\xff\xbf\x81\0\0\0\0\0\0\x18\x02\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x18\x03\0\0\xff\xff\xff\xff\0\0\0\0\0\0\0\0\xb7\x05\
-\0\0\xa0\0\0\0\x85\0\0\0\x19\0\0\0\xb7\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\xbf\x16\
-\0\0\0\0\0\0\x79\x67\x50\0\0\0\0\0\x85\x10\0\0\xff\xff\xff\xff\x57\0\0\0\x01\0\
-\0\0\x15\0\x2a\0\0\0\0\0\xb7\x01\0\0\0\0\0\0\x7b\x1a\xf8\xff\0\0\0\0\x7b\x1a\
-\xf0\xff\0\0\0\0\x7b\x1a\xe8\xff\0\0\0\0\x7b\x1a\xe0\xff\0\0\0\0\x7b\x1a\xd8\
-\xff\0\0\0\0\x7b\x1a\xd0\xff\0\0\0\0\x7b\x1a\xc8\xff\0\0\0\0\x7b\x1a\xc0\xff\0\
-\0\0\0\x7b\x1a\xb8\xff\0\0\0\0\x7b\x1a\xb0\xff\0\0\0\0\x7b\x1a\xa8\xff\0\0\0\0\
-\x7b\x1a\xa0\xff\0\0\0\0\x7b\x1a\x98\xff\0\0\0\0\x7b\x1a\x90\xff\0\0\0\0\x7b\
-\x1a\x88\xff\0\0\0\0\x7b\x1a\x80\xff\0\0\0\0\x7b\x1a\x78\xff\0\0\0\0\x7b\x1a\
-\x70\xff\0\0\0\0\x85\0\0\0\x05\0\0\0\x7b\x0a\x60\xff\0\0\0\0\x85\0\0\0\x0e\0\0\
-\0\x77\0\0\0\x20\0\0\0\x63\x0a\x68\xff\0\0\0\0\x85\0\0\0\x0f\0\0\0\x63\x0a\x6c\
-\xff\0\0\0\0\xbf\xa1\0\0\0\0\0\0\x07\x01\0\0\x70\xff\xff\xff\xb7\x02\0\0\x10\0\
-\0\0\x85\0\0\0\x10\0\0\0\x7b\x7a\xf0\xff\0\0\0\0\xb7\x01\0\0\x03\0\0\0\x63\x1a\
-\xe8\xff\0\0\0\0\xbf\xa4\0\0\0\0\0\0\x07\x04\0\0\x60\xff\xff\xff\xbf\x61\0\0\0\
-\0\0\0\x18\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x18\x03\0\0\xff\xff\xff\xff\0\0\0\0\
-\0\0\0\0\xb7\x05\0\0\xa0\0\0\0\x85\0\0\0\x19\0\0\0\xb7\0\0\0\0\0\0\0\x95\0\0\0\
-\0\0\0\0\x47\x50\x4c\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf0\x06\0\0\x05\0\x08\0\x19\0\0\0\x64\0\
-\0\0\x72\0\0\0\x86\0\0\0\x2d\x01\0\0\x3b\x01\0\0\x44\x01\0\0\x4d\x01\0\0\x0a\
-\x02\0\0\x14\x02\0\0\x22\x02\0\0\x2b\x02\0\0\xe8\x02\0\0\xf1\x02\0\0\xfb\x02\0\
-\0\x09\x03\0\0\x12\x03\0\0\x1b\x03\0\0\xbf\x03\0\0\xc8\x03\0\0\xd2\x03\0\0\xe0\
-\x03\0\0\x60\x04\0\0\x70\x04\0\0\x9f\x05\0\0\xb0\x05\0\0\x01\x06\x04\0\x08\x01\
-\x51\x04\x08\xb8\x04\x01\x56\0\x01\x06\x04\x18\x30\x0d\x78\0\xa8\xaf\x80\x80\0\
-\xa8\xb3\x80\x80\0\x9f\0\x01\x06\x04\x18\xc8\x01\x03\x7a\xd0\0\x04\xc8\x01\xd8\
-\x01\x0c\x30\x9f\x93\x10\x7a\xd0\0\x23\x10\x93\x90\x01\x04\xd8\x01\xf0\x01\x0f\
-\x7a\xd0\0\x93\x08\x93\x08\x7a\xd0\0\x23\x10\x93\x90\x01\x04\xf0\x01\x80\x02\
-\x16\x7a\xd0\0\x93\x08\x7a\xd0\0\x23\x08\x93\x04\x93\x04\x7a\xd0\0\x23\x10\x93\
-\x90\x01\x04\x80\x02\xc0\x03\x1b\x7a\xd0\0\x93\x08\x7a\xd0\0\x23\x08\x93\x04\
-\x7a\xd0\0\x23\x0c\x93\x04\x7a\xd0\0\x23\x10\x93\x90\x01\x04\xc0\x03\xe0\x03\
-\x16\x7a\xd0\0\x93\x88\x01\x7a\xd0\0\x23\x88\x01\x93\x04\x7a\xd0\0\x23\x8c\x01\
-\x93\x14\x04\xe0\x03\xa8\x04\x16\x7a\xd0\0\x93\x8c\x01\x7a\xd0\0\x23\x8c\x01\
-\x93\x04\x7a\xd0\0\x23\x90\x01\x93\x10\0\x01\x09\x04\0\x08\x01\x51\x04\x08\xf0\
-\x0a\x01\x58\0\x01\x09\x04\x10\xf0\x0a\x01\x58\0\x01\x09\x04\x10\x98\x0a\x01\
-\x56\0\x01\x09\x04\x10\xc8\x01\x03\x7a\xd8\x01\x04\xc8\x01\xd8\x01\x0c\x30\x9f\
-\x93\x10\x7a\xd8\x01\x23\x10\x93\x90\x01\x04\xd8\x01\xf0\x01\x0f\x7a\xd8\x01\
-\x93\x08\x93\x08\x7a\xd8\x01\x23\x10\x93\x90\x01\x04\xf0\x01\x80\x02\x16\x7a\
-\xd8\x01\x93\x08\x7a\xd8\x01\x23\x08\x93\x04\x93\x04\x7a\xd8\x01\x23\x10\x93\
-\x90\x01\x04\x80\x02\xa8\x02\x1b\x7a\xd8\x01\x93\x08\x7a\xd8\x01\x23\x08\x93\
-\x04\x7a\xd8\x01\x23\x0c\x93\x04\x7a\xd8\x01\x23\x10\x93\x90\x01\x04\xa8\x02\
-\xb8\x02\x13\x7a\xd8\x01\x93\x60\x7a\xd8\x01\x23\x60\x93\x08\x7a\xd8\x01\x23\
-\x68\x93\x38\x04\xb8\x02\xb0\x12\x16\x7a\xd8\x01\x93\x88\x01\x7a\xd8\x01\x23\
-\x88\x01\x93\x04\x7a\xd8\x01\x23\x8c\x01\x93\x14\x04\xb0\x12\xd8\x12\x13\x7a\
-\xd8\x01\x93\x20\x7a\xd8\x01\x23\x20\x93\x40\x7a\xd8\x01\x23\x60\x93\x40\0\x01\
-\x09\x04\xe8\x02\xa8\x03\x01\x50\0\x01\x0c\x04\0\x08\x01\x51\x04\x08\xa8\x0a\
-\x01\x57\0\x01\x0c\x04\x10\xa8\x0a\x01\x57\0\x01\x0c\x04\x10\xc0\x01\x03\x7a\
-\xa0\x01\x04\xc0\x01\xd0\x01\x0c\x30\x9f\x93\x10\x7a\xa0\x01\x23\x10\x93\x90\
-\x01\x04\xd0\x01\xe8\x01\x0f\x7a\xa0\x01\x93\x08\x93\x08\x7a\xa0\x01\x23\x10\
-\x93\x90\x01\x04\xe8\x01\xf8\x01\x16\x7a\xa0\x01\x93\x08\x7a\xa0\x01\x23\x08\
-\x93\x04\x93\x04\x7a\xa0\x01\x23\x10\x93\x90\x01\x04\xf8\x01\xa0\x02\x1b\x7a\
-\xa0\x01\x93\x08\x7a\xa0\x01\x23\x08\x93\x04\x7a\xa0\x01\x23\x0c\x93\x04\x7a\
-\xa0\x01\x23\x10\x93\x90\x01\x04\xa0\x02\xb0\x02\x13\x7a\xa0\x01\x93\x60\x7a\
-\xa0\x01\x23\x60\x93\x08\x7a\xa0\x01\x23\x68\x93\x38\x04\xb0\x02\xd8\x11\x16\
-\x7a\xa0\x01\x93\x88\x01\x7a\xa0\x01\x23\x88\x01\x93\x04\x7a\xa0\x01\x23\x8c\
-\x01\x93\x14\x04\xd8\x11\xf8\x11\x13\x7a\xa0\x01\x93\x20\x7a\xa0\x01\x23\x20\
-\x93\x40\x7a\xa0\x01\x23\x60\x93\x40\0\x01\x0c\x04\x10\xd0\x09\x01\x56\0\x01\
-\x0c\x04\xe0\x02\xf8\x11\x01\x50\0\x01\x10\x04\0\x08\x01\x51\x04\x08\xd8\x09\
-\x01\x58\0\x01\x10\x04\x18\xf8\x08\x01\x56\0\x01\x10\x04\x18\xd8\x09\x01\x58\0\
-\x01\x10\x04\x18\xc8\x01\x03\x7a\x98\x01\x04\xc8\x01\xd8\x01\x0c\x30\x9f\x93\
-\x10\x7a\x98\x01\x23\x10\x93\x90\x01\x04\xd8\x01\xf0\x01\x0f\x7a\x98\x01\x93\
-\x08\x93\x08\x7a\x98\x01\x23\x10\x93\x90\x01\x04\xf0\x01\x80\x02\x16\x7a\x98\
-\x01\x93\x08\x7a\x98\x01\x23\x08\x93\x04\x93\x04\x7a\x98\x01\x23\x10\x93\x90\
-\x01\x04\x80\x02\xa8\x02\x1b\x7a\x98\x01\x93\x08\x7a\x98\x01\x23\x08\x93\x04\
-\x7a\x98\x01\x23\x0c\x93\x04\x7a\x98\x01\x23\x10\x93\x90\x01\x04\xa8\x02\xe0\
-\x02\x13\x7a\x98\x01\x93\x60\x7a\x98\x01\x23\x60\x93\x08\x7a\x98\x01\x23\x68\
-\x93\x38\x04\xe0\x02\x88\x12\x16\x7a\x98\x01\x93\x88\x01\x7a\x98\x01\x23\x88\
-\x01\x93\x04\x7a\x98\x01\x23\x8c\x01\x93\x14\0\x01\x10\x04\x18\xd0\x0a\x01\x57\
-\0\x01\x10\x04\x88\x03\xd0\x12\x01\x50\0\x01\x13\x04\0\x08\x01\x51\x04\x08\x88\
-\x03\x01\x56\0\x01\x13\x04\x10\xc0\x01\x02\x7a\0\x04\xc0\x01\xd0\x01\x09\x30\
-\x9f\x93\x10\x7a\x10\x93\x90\x01\x04\xd0\x01\xe8\x01\x0b\x7a\0\x93\x08\x93\x08\
-\x7a\x10\x93\x90\x01\x04\xe8\x01\xf8\x01\x0f\x7a\0\x93\x08\x7a\x08\x93\x04\x93\
-\x04\x7a\x10\x93\x90\x01\x04\xf8\x01\xa8\x02\x11\x7a\0\x93\x08\x7a\x08\x93\x04\
-\x7a\x0c\x93\x04\x7a\x10\x93\x90\x01\x04\xa8\x02\xb0\x02\x0f\x7a\0\x93\x90\x01\
-\x7a\x90\x01\x93\x08\x7a\x98\x01\x93\x08\x04\xb0\x02\xf8\x02\x0f\x7a\0\x93\x88\
-\x01\x7a\x88\x01\x93\x04\x7a\x8c\x01\x93\x14\0\x01\x16\x04\x60\xa8\x01\x01\x51\
-\x04\xb8\x02\xf0\x05\x01\x51\0\x01\x16\x04\x90\x01\xa8\x01\x03\x11\x01\x9f\x04\
-\xb8\x02\xc8\x02\x05\x11\x01\x23\x01\x9f\x04\xc8\x02\xe0\x02\x03\x11\x02\x9f\
-\x04\xe0\x02\xe8\x02\x05\x11\x02\x23\x01\x9f\x04\xe8\x02\x80\x03\x03\x11\x03\
-\x9f\x04\x80\x03\x88\x03\x05\x11\x03\x23\x01\x9f\x04\x88\x03\xa0\x03\x03\x11\
-\x04\x9f\x04\xa0\x03\xa8\x03\x05\x11\x04\x23\x01\x9f\x04\xa8\x03\xc0\x03\x03\
-\x11\x05\x9f\x04\xc0\x03\xc8\x03\x05\x11\x05\x23\x01\x9f\x04\xc8\x03\xe0\x03\
-\x03\x11\x06\x9f\x04\xe0\x03\xe8\x03\x05\x11\x06\x23\x01\x9f\x04\xe8\x03\x80\
-\x04\x03\x11\x07\x9f\x04\x80\x04\x88\x04\x05\x11\x07\x23\x01\x9f\x04\x88\x04\
-\xa0\x04\x03\x11\x08\x9f\x04\xa0\x04\xa8\x04\x05\x11\x08\x23\x01\x9f\x04\xa8\
-\x04\xc0\x04\x03\x11\x09\x9f\x04\xc0\x04\xc8\x04\x05\x11\x09\x23\x01\x9f\x04\
-\xc8\x04\xe0\x04\x03\x11\x0a\x9f\x04\xe0\x04\xe8\x04\x05\x11\x0a\x23\x01\x9f\
-\x04\xe8\x04\x80\x05\x03\x11\x0b\x9f\x04\x80\x05\x88\x05\x05\x11\x0b\x23\x01\
-\x9f\x04\x88\x05\xa0\x05\x03\x11\x0c\x9f\x04\xa0\x05\xa8\x05\x05\x11\x0c\x23\
-\x01\x9f\x04\xa8\x05\xc0\x05\x03\x11\x0d\x9f\x04\xc0\x05\xc8\x05\x05\x11\x0d\
-\x23\x01\x9f\x04\xc8\x05\xe0\x05\x03\x11\x0e\x9f\x04\xe0\x05\xe8\x05\x05\x11\
-\x0e\x23\x01\x9f\x04\xe8\x05\xf8\x05\x03\x11\x0f\x9f\x04\xf8\x05\x98\x06\x05\
-\x11\x0f\x23\x01\x9f\0\x01\x16\x04\xd8\x01\xb0\x02\x01\x51\x04\x98\x06\xa0\x0b\
-\x01\x51\0\x01\x16\x04\xf8\x01\x98\x02\x03\x11\0\x9f\x04\x98\x02\xb0\x02\x03\
-\x11\x01\x9f\x04\x98\x06\xa8\x06\x05\x11\x01\x23\x01\x9f\x04\xa8\x06\xc8\x06\
-\x03\x11\x02\x9f\x04\xc8\x06\xd8\x06\x05\x11\x02\x23\x01\x9f\x04\xd8\x06\xf8\
-\x06\x03\x11\x03\x9f\x04\xf8\x06\x88\x07\x05\x11\x03\x23\x01\x9f\x04\x88\x07\
-\xa8\x07\x03\x11\x04\x9f\x04\xa8\x07\xb8\x07\x05\x11\x04\x23\x01\x9f\x04\xb8\
-\x07\xd8\x07\x03\x11\x05\x9f\x04\xd8\x07\xe8\x07\x05\x11\x05\x23\x01\x9f\x04\
-\xe8\x07\x88\x08\x03\x11\x06\x9f\x04\x88\x08\x98\x08\x05\x11\x06\x23\x01\x9f\
-\x04\x98\x08\xb8\x08\x03\x11\x07\x9f\x04\xb8\x08\xc8\x08\x05\x11\x07\x23\x01\
-\x9f\x04\xc8\x08\xe8\x08\x03\x11\x08\x9f\x04\xe8\x08\xf8\x08\x05\x11\x08\x23\
-\x01\x9f\x04\xf8\x08\x98\x09\x03\x11\x09\x9f\x04\x98\x09\xa8\x09\x05\x11\x09\
-\x23\x01\x9f\x04\xa8\x09\xc8\x09\x03\x11\x0a\x9f\x04\xc8\x09\xd8\x09\x05\x11\
-\x0a\x23\x01\x9f\x04\xd8\x09\xf8\x09\x03\x11\x0b\x9f\x04\xf8\x09\x88\x0a\x05\
-\x11\x0b\x23\x01\x9f\x04\x88\x0a\xa8\x0a\x03\x11\x0c\x9f\x04\xa8\x0a\xb8\x0a\
-\x05\x11\x0c\x23\x01\x9f\x04\xb8\x0a\xd8\x0a\x03\x11\x0d\x9f\x04\xd8\x0a\xe8\
-\x0a\x05\x11\x0d\x23\x01\x9f\x04\xe8\x0a\x88\x0b\x03\x11\x0e\x9f\x04\x88\x0b\
-\x98\x0b\x05\x11\x0e\x23\x01\x9f\x04\x98\x0b\xb8\x0b\x03\x11\x0f\x9f\x04\xb8\
-\x0b\xc8\x0b\x05\x11\x0f\x23\x01\x9f\0\x01\x11\x01\x25\x25\x13\x05\x03\x25\x72\
-\x17\x10\x17\x1b\x25\x11\x01\x55\x23\x73\x17\x74\x17\x8c\x01\x17\0\0\x02\x24\0\
-\x03\x25\x3e\x0b\x0b\x0b\0\0\x03\x34\0\x03\x25\x49\x13\x3f\x19\x3a\x0b\x3b\x0b\
-\x02\x18\0\0\x04\x01\x01\x49\x13\0\0\x05\x21\0\x49\x13\x37\x0b\0\0\x06\x24\0\
-\x03\x25\x0b\x0b\x3e\x0b\0\0\x07\x13\x01\x0b\x0b\x3a\x0b\x3b\x0b\0\0\x08\x0d\0\
-\x03\x25\x49\x13\x3a\x0b\x3b\x0b\x38\x0b\0\0\x09\x0f\0\x49\x13\0\0\x0a\x21\0\
-\x49\x13\x37\x05\0\0\x0b\x16\0\x49\x13\x03\x25\x3a\x0b\x3b\x05\0\0\x0c\x34\0\
-\x03\x25\x49\x13\x3a\x0b\x3b\x0b\0\0\x0d\x26\0\x49\x13\0\0\x0e\x15\0\x49\x13\
-\x27\x19\0\0\x0f\x34\0\x03\x25\x49\x13\x3a\x0b\x3b\x05\0\0\x10\x15\x01\x49\x13\
-\x27\x19\0\0\x11\x05\0\x49\x13\0\0\x12\x0f\0\0\0\x13\x26\0\0\0\x14\x04\x01\x49\
-\x13\x0b\x0b\x3a\x0b\x3b\x05\0\0\x15\x28\0\x03\x25\x1c\x0f\0\0\x16\x2e\x01\x03\
-\x25\x3a\x0b\x3b\x0b\x27\x19\x49\x13\x20\x21\x01\0\0\x17\x05\0\x03\x25\x3a\x0b\
-\x3b\x0b\x49\x13\0\0\x18\x34\0\x03\x25\x3a\x0b\x3b\x0b\x49\x13\0\0\x19\x13\x01\
-\x03\x25\x0b\x0b\x3a\x0b\x3b\x05\0\0\x1a\x0d\0\x03\x25\x49\x13\x3a\x0b\x3b\x05\
-\x38\x0b\0\0\x1b\x0d\0\x49\x13\x3a\x0b\x3b\x05\x38\x0b\0\0\x1c\x17\x01\x0b\x0b\
-\x3a\x0b\x3b\x05\0\0\x1d\x0d\0\x03\x25\x49\x13\x3a\x0b\x3b\x05\x0d\x0b\x6b\x0b\
-\0\0\x1e\x13\x01\x03\x25\x0b\x0b\x3a\x0b\x3b\x0b\0\0\x1f\x2e\x01\x11\x1b\x12\
-\x06\x40\x18\x7a\x19\x03\x25\x3a\x0b\x3b\x0b\x27\x19\x49\x13\x3f\x19\0\0\x20\
-\x05\0\x02\x22\x03\x25\x3a\x0b\x3b\x0b\x49\x13\0\0\x21\x1d\x01\x31\x13\x11\x1b\
-\x12\x06\x58\x0b\x59\x0b\x57\x0b\0\0\x22\x05\0\x02\x18\x31\x13\0\0\x23\x05\0\
-\x02\x22\x31\x13\0\0\x24\x34\0\x02\x18\x31\x13\0\0\x25\x34\0\x02\x22\x31\x13\0\
-\0\x26\x48\0\x7f\x13\x7d\x1b\0\0\x27\x2e\x01\x11\x1b\x12\x06\x40\x18\x7a\x19\
-\x03\x25\x3a\x0b\x3b\x0b\x27\x19\x49\x13\0\0\x28\x34\0\x02\x18\x03\x25\x3a\x0b\
-\x3b\x0b\x49\x13\0\0\x29\x34\0\x02\x22\x03\x25\x3a\x0b\x3b\x0b\x49\x13\0\0\x2a\
-\x0b\x01\x55\x23\0\0\x2b\x0b\x01\0\0\x2c\x05\0\x02\x18\x03\x25\x3a\x0b\x3b\x0b\
-\x49\x13\0\0\x2d\x2e\x01\x03\x25\x3a\x0b\x3b\x05\x27\x19\x49\x13\x20\x21\x01\0\
-\0\x2e\x05\0\x03\x25\x3a\x0b\x3b\x05\x49\x13\0\0\x2f\x34\0\x03\x25\x3a\x0b\x3b\
-\x05\x49\x13\0\0\x30\x2e\x01\x11\x1b\x12\x06\x40\x18\x7a\x19\x03\x25\x3a\x0b\
-\x3b\x05\x27\x19\x49\x13\x3f\x19\0\0\x31\x05\0\x02\x22\x03\x25\x3a\x0b\x3b\x05\
-\x49\x13\0\0\x32\x1d\x01\x31\x13\x11\x1b\x12\x06\x58\x0b\x59\x05\x57\x0b\0\0\0\
-\xbd\x08\0\0\x05\0\x01\x08\0\0\0\0\x01\0\x1d\0\x01\x08\0\0\0\0\0\0\0\x02\0\0\0\
-\0\0\0\0\0\x02\x08\0\0\0\x0c\0\0\0\x0c\0\0\0\x02\x6c\x07\x08\x02\x6b\x07\x04\
-\x03\x03\x42\0\0\0\0\x07\x02\xa1\0\x04\x4e\0\0\0\x05\x52\0\0\0\x04\0\x02\x04\
-\x06\x01\x06\x05\x08\x07\x03\x06\x61\0\0\0\0\x24\x02\xa1\x01\x07\x20\0\x1f\x08\
-\x07\x8a\0\0\0\0\x20\0\x08\x09\x9f\0\0\0\0\x21\x08\x08\x0a\xb1\0\0\0\0\x22\x10\
-\x08\x0d\xc3\0\0\0\0\x23\x18\0\x09\x8f\0\0\0\x04\x9b\0\0\0\x05\x52\0\0\0\x01\0\
-\x02\x08\x05\x04\x09\xa4\0\0\0\x04\x9b\0\0\0\x0a\x52\0\0\0\0\x04\0\x09\xb6\0\0\
-\0\x0b\xbf\0\0\0\x0c\x01\xb3\x75\x02\x0b\x07\x08\x09\xc8\0\0\0\x04\x4e\0\0\0\
-\x05\x52\0\0\0\x40\0\x03\x0e\xdf\0\0\0\0\x2f\x02\xa1\x02\x07\x20\0\x2a\x08\x07\
-\x08\x01\0\0\0\x2b\0\x08\x0f\x08\x01\0\0\0\x2c\x08\x08\x10\x08\x01\0\0\0\x2d\
-\x10\x08\x09\x9f\0\0\0\0\x2e\x18\0\x09\x0d\x01\0\0\x04\x9b\0\0\0\x05\x52\0\0\0\
-\x04\0\x03\x11\x24\x01\0\0\0\x3a\x02\xa1\x03\x07\x20\0\x35\x08\x07\x8a\0\0\0\0\
-\x36\0\x08\x09\x8a\0\0\0\0\x37\x08\x08\x0a\x4d\x01\0\0\0\x38\x10\x08\x0d\xc3\0\
-\0\0\0\x39\x18\0\x09\x52\x01\0\0\x0b\x5b\x01\0\0\x13\x01\x03\x77\x02\x12\x07\
-\x04\x03\x14\x6a\x01\0\0\0\x45\x02\xa1\x04\x07\x20\0\x40\x08\x07\x93\x01\0\0\0\
-\x41\0\x08\x09\x8a\0\0\0\0\x42\x08\x08\x0a\x4d\x01\0\0\0\x43\x10\x08\x0d\xa4\
-\x01\0\0\0\x44\x18\0\x09\x98\x01\0\0\x04\x9b\0\0\0\x05\x52\0\0\0\x02\0\x09\xa9\
-\x01\0\0\x04\x4e\0\0\0\x05\x52\0\0\0\x10\0\x03\x15\xc0\x01\0\0\0\x50\x02\xa1\
-\x05\x07\x20\0\x4b\x08\x07\x93\x01\0\0\0\x4c\0\x08\x09\x8a\0\0\0\0\x4d\x08\x08\
-\x0a\x4d\x01\0\0\0\x4e\x10\x08\x0d\xa4\x01\0\0\0\x4f\x18\0\x0c\x16\xf1\x01\0\0\
-\x02\x7a\x0d\xf6\x01\0\0\x09\xfb\x01\0\0\x0e\xb6\0\0\0\x0f\x17\xf1\x01\0\0\x02\
-\x7a\x01\x0f\x18\xf1\x01\0\0\x02\x85\x01\x0f\x19\x1b\x02\0\0\x02\x94\x01\x0d\
-\x20\x02\0\0\x09\x25\x02\0\0\x10\x35\x02\0\0\x11\x39\x02\0\0\x11\x52\x01\0\0\0\
-\x02\x1a\x05\x08\x12\x0f\x1b\x43\x02\0\0\x02\x2f\x0b\x0d\x48\x02\0\0\x09\x4d\
-\x02\0\0\x10\x35\x02\0\0\x11\x39\x02\0\0\x11\x52\x01\0\0\x11\x62\x02\0\0\0\x09\
-\x67\x02\0\0\x13\x0c\x1c\x70\x02\0\0\x02\x56\x0d\x75\x02\0\0\x09\x7a\x02\0\0\
-\x10\x35\x02\0\0\x11\x39\x02\0\0\x11\x62\x02\0\0\x11\x62\x02\0\0\x11\xb6\0\0\0\
-\0\x0f\x1d\x9d\x02\0\0\x02\xc2\x02\x0d\xa2\x02\0\0\x09\xa7\x02\0\0\x10\x35\x02\
-\0\0\x11\x39\x02\0\0\x11\x39\x02\0\0\x11\xb6\0\0\0\x11\x39\x02\0\0\x11\xb6\0\0\
-\0\0\x0c\x1e\xce\x02\0\0\x02\x40\x0d\xd3\x02\0\0\x09\xd8\x02\0\0\x10\x39\x02\0\
-\0\x11\x39\x02\0\0\x11\x62\x02\0\0\0\x0f\x1f\x43\x02\0\0\x02\x3b\x0b\x0c\x20\
-\xf9\x02\0\0\x02\x60\x0d\xfe\x02\0\0\x09\x03\x03\0\0\x10\x35\x02\0\0\x11\x39\
-\x02\0\0\x11\x62\x02\0\0\0\x14\x5b\x01\0\0\x04\x01\x2d\x04\x15\x21\0\x15\x22\
-\x01\x15\x23\x02\x15\x24\x04\0\x14\x4b\x03\0\0\x08\x01\x73\x04\x15\x26\xff\xff\
-\xff\xff\x0f\x15\x27\xff\xff\xff\xff\x0f\x15\x28\x80\x80\x80\x80\xf0\xff\xff\
-\x07\0\x02\x25\x07\x08\x14\x5b\x01\0\0\x04\x01\xbf\x25\x15\x29\0\x15\x2a\x01\0\
-\x16\x2b\0\x8d\x9b\0\0\0\x17\x2c\0\x8d\x98\x03\0\0\x17\x55\0\x8d\x78\x05\0\0\
-\x17\x47\0\x8d\x9b\0\0\0\x18\x56\0\x93\xc8\0\0\0\x18\x0a\0\x9d\x52\x01\0\0\x18\
-\x57\0\x92\x82\x05\0\0\0\x09\x9d\x03\0\0\x19\x54\xa8\x01\x1a\x81\x1a\x2d\x4b\
-\x03\0\0\x01\x1b\x81\0\x1a\x2e\x4b\x03\0\0\x01\x1c\x81\x08\x1a\x2f\x4b\x03\0\0\
-\x01\x1d\x81\x10\x1a\x30\x4b\x03\0\0\x01\x1e\x81\x18\x1a\x31\x4b\x03\0\0\x01\
-\x1f\x81\x20\x1a\x32\x4b\x03\0\0\x01\x20\x81\x28\x1a\x33\x4b\x03\0\0\x01\x21\
-\x81\x30\x1a\x34\x4b\x03\0\0\x01\x22\x81\x38\x1a\x35\x4b\x03\0\0\x01\x23\x81\
-\x40\x1a\x36\x4b\x03\0\0\x01\x24\x81\x48\x1a\x37\x4b\x03\0\0\x01\x25\x81\x50\
-\x1a\x38\x4b\x03\0\0\x01\x26\x81\x58\x1a\x39\x4b\x03\0\0\x01\x27\x81\x60\x1a\
-\x3a\x4b\x03\0\0\x01\x28\x81\x68\x1a\x3b\x4b\x03\0\0\x01\x29\x81\x70\x1a\x3c\
-\x4b\x03\0\0\x01\x2a\x81\x78\x1a\x3d\x4b\x03\0\0\x01\x2b\x81\x80\x1b\x56\x04\0\
-\0\x01\x2c\x81\x88\x1c\x08\x01\x2c\x81\x1a\x3e\xbc\x04\0\0\x01\x2d\x81\0\x1a\
-\x42\xd2\x04\0\0\x01\x2e\x81\0\x1a\x44\xdb\x04\0\0\x01\x2f\x81\0\0\x1a\x47\x4b\
-\x03\0\0\x01\x31\x81\x90\x1a\x48\x4b\x03\0\0\x01\x32\x81\x98\x1b\x97\x04\0\0\
-\x01\x33\x81\xa0\x1c\x08\x01\x33\x81\x1a\x49\xbc\x04\0\0\x01\x34\x81\0\x1a\x4a\
-\xd2\x04\0\0\x01\x35\x81\0\x1a\x4b\x03\x05\0\0\x01\x36\x81\0\0\0\x0b\xc5\x04\0\
-\0\x41\x01\x6d\x76\x0b\xce\x04\0\0\x40\x01\x63\x76\x02\x3f\x07\x02\x0b\xb6\0\0\
-\0\x43\x01\xbb\x75\x19\x44\x08\x01\x03\x81\x1d\x3e\xd2\x04\0\0\x01\x04\x81\x10\
-\0\x1d\x45\xd2\x04\0\0\x01\x05\x81\x02\x10\x1d\x46\xd2\x04\0\0\x01\x06\x81\x01\
-\x12\0\x19\x4b\x08\x01\x09\x81\x1d\x49\xd2\x04\0\0\x01\x0a\x81\x10\0\x1d\x4c\
-\xd2\x04\0\0\x01\x0b\x81\x01\x10\x1d\x4d\xd2\x04\0\0\x01\x0c\x81\x01\x11\x1d\
-\x4e\xd2\x04\0\0\x01\x0d\x81\x01\x12\x1d\x4f\xd2\x04\0\0\x01\x0f\x81\x08\x20\
-\x1d\x07\xd2\x04\0\0\x01\x11\x81\x04\x30\x1d\x50\xd2\x04\0\0\x01\x13\x81\x01\
-\x38\x1d\x51\xd2\x04\0\0\x01\x14\x81\x01\x39\x1d\x52\xd2\x04\0\0\x01\x15\x81\
-\x01\x3a\x1d\x53\xd2\x04\0\0\x01\x17\x81\x04\x3c\0\x09\x7d\x05\0\0\x0d\x4e\0\0\
-\0\x1e\x62\xa0\0\x0d\x08\x58\xb6\0\0\0\0\x0e\0\x08\x59\x52\x01\0\0\0\x0f\x08\
-\x08\x5a\x52\x01\0\0\0\x10\x0c\x08\x5b\xa9\x01\0\0\0\x11\x10\x08\x5c\xc8\0\0\0\
-\0\x12\x20\x08\x5d\xb6\0\0\0\0\x13\x60\x08\x5e\xeb\x05\0\0\0\x14\x68\x08\x5f\
-\x9b\0\0\0\0\x15\x88\x08\x47\x9b\0\0\0\0\x16\x8c\x08\x60\xb6\0\0\0\0\x17\x90\
-\x08\x61\x9b\0\0\0\0\x18\x98\0\x04\x4e\0\0\0\x05\x52\0\0\0\x20\0\x1f\x06\x38\
-\x02\0\0\x01\x5a\x6d\0\x8d\x9b\0\0\0\x20\0\x2c\0\x8d\x98\x03\0\0\x21\x5f\x03\0\
-\0\x07\x10\x02\0\0\0\x8d\x05\x22\x01\x56\x67\x03\0\0\x22\x01\x57\x6f\x03\0\0\
-\x23\x01\x77\x03\0\0\x24\x02\x91\x10\x7f\x03\0\0\x24\x02\x91\x0c\x87\x03\0\0\
-\x25\x02\x8f\x03\0\0\0\x26\x4e\x06\0\0\x08\0\x27\x16\xc8\x05\0\0\x01\x5a\x73\0\
-\x5e\xb3\x08\0\0\x28\x02\x91\x08\x5b\0\x60\xa9\x01\0\0\x28\x02\x91\x04\x0a\0\
-\x64\x52\x01\0\0\x29\x15\x76\0\x65\xe1\x06\0\0\x29\x17\x78\0\x73\xe1\x06\0\0\
-\x2a\0\x29\x16\x77\0\x68\x9b\0\0\0\0\x2a\x01\x29\x18\x77\0\x7b\x9b\0\0\0\0\0\
-\x16\x63\0\xb0\x9b\0\0\0\x17\x2c\0\xb0\x98\x03\0\0\x17\x64\0\xb0\x39\x02\0\0\
-\x18\x65\0\xb5\xb6\0\0\0\x18\x0a\0\xc2\x52\x01\0\0\x18\x57\0\xb6\x82\x05\0\0\
-\x18\x66\0\xc3\xe1\x06\0\0\x2b\x18\x56\0\xc5\xc8\0\0\0\0\0\x09\x4e\0\0\0\x1f\
-\x09\xb0\x09\0\0\x01\x5a\x6e\0\xb0\x9b\0\0\0\x20\x03\x2c\0\xb0\x98\x03\0\0\x21\
-\x9e\x06\0\0\x0a\x90\x09\0\0\0\xb0\x05\x23\x04\xa6\x06\0\0\x23\x05\xae\x06\0\0\
-\x24\x03\x91\xf8\x02\xb6\x06\0\0\x24\x03\x91\xd4\x01\xbe\x06\0\0\x25\x06\xc6\
-\x06\0\0\x25\x07\xce\x06\0\0\0\x26\x4e\x06\0\0\x0b\0\x16\x67\0\xd8\x9b\0\0\0\
-\x17\x2c\0\xd8\x98\x03\0\0\x17\x65\0\xd8\x39\x02\0\0\x18\x57\0\xdd\x82\x05\0\0\
-\x18\x56\0\xe9\xe1\x06\0\0\0\x1f\x0c\x50\x09\0\0\x01\x5a\x6f\0\xd8\x9b\0\0\0\
-\x20\x08\x2c\0\xd8\x98\x03\0\0\x21\x3d\x07\0\0\x0d\x30\x09\0\0\0\xd8\x05\x23\
-\x09\x45\x07\0\0\x23\x0b\x4d\x07\0\0\x25\x0a\x55\x07\0\0\x25\x0c\x5d\x07\0\0\0\
-\x26\x4e\x06\0\0\x0e\0\x1f\x0f\x10\0\0\0\x01\x5a\x70\0\xfb\x9b\0\0\0\x2c\x01\
-\x51\x2c\0\xfb\x98\x03\0\0\0\x2d\x68\0\x07\x01\x9b\0\0\0\x2e\x2c\0\x07\x01\x98\
-\x03\0\0\x2e\x65\0\x07\x01\x39\x02\0\0\x2e\x69\0\x07\x01\x78\x05\0\0\x2f\x57\0\
-\x0c\x01\x82\x05\0\0\x2f\x56\0\x19\x01\xe1\x06\0\0\0\x30\x10\x60\x09\0\0\x01\
-\x5a\x71\0\x07\x01\x9b\0\0\0\x31\x0d\x2c\0\x07\x01\x98\x03\0\0\x32\xc5\x07\0\0\
-\x11\x38\x09\0\0\0\x07\x01\x05\x23\x0f\xce\x07\0\0\x23\x0e\xd7\x07\0\0\x23\x11\
-\xe0\x07\0\0\x25\x10\xe9\x07\0\0\x25\x12\xf2\x07\0\0\0\x26\x4e\x06\0\0\x12\0\
-\x2d\x6a\0\x2a\x01\x9b\0\0\0\x2e\x2c\0\x2a\x01\x98\x03\0\0\x2e\x64\0\x2a\x01\
-\x39\x02\0\0\x2f\x57\0\x2f\x01\x82\x05\0\0\0\x30\x13\x88\x01\0\0\x01\x5a\x72\0\
-\x2a\x01\x9b\0\0\0\x31\x13\x2c\0\x2a\x01\x98\x03\0\0\x32\x4a\x08\0\0\x14\x68\
-\x01\0\0\0\x2a\x01\x05\x22\x01\x56\x53\x08\0\0\x22\x01\x57\x5c\x08\0\0\x25\x14\
-\x65\x08\0\0\0\x26\x4e\x06\0\0\x15\0\x0b\xbc\x08\0\0\x75\x01\x0d\x75\x02\x74\
-\x02\x01\0\x4a\0\0\0\x05\0\x08\0\x03\0\0\0\x0c\0\0\0\x19\0\0\0\x26\0\0\0\x01\
-\x16\x04\x90\x01\xa8\x01\x04\xc0\x02\x98\x06\0\x01\x16\x04\xf8\x01\xb0\x02\x04\
-\xa0\x06\xc8\x0b\0\x03\x06\xb8\x04\x03\x09\xb0\x13\x03\x0c\xd0\x12\x03\x0f\x10\
-\x03\x10\xe0\x12\x03\x13\x88\x03\x03\x16\xc8\x0b\0\xe8\x01\0\0\x05\0\0\0\0\0\0\
-\0\x15\0\0\0\x2e\0\0\0\x5e\0\0\0\x66\0\0\0\x6b\0\0\0\x7f\0\0\0\x8e\0\0\0\x93\0\
-\0\0\x97\0\0\0\xa3\0\0\0\xa7\0\0\0\xba\0\0\0\xc0\0\0\0\xc6\0\0\0\xcd\0\0\0\xd6\
-\0\0\0\xe1\0\0\0\xeb\0\0\0\xf8\0\0\0\xfe\0\0\0\x0d\x01\0\0\x1d\x01\0\0\x2e\x01\
-\0\0\x47\x01\0\0\x5f\x01\0\0\x74\x01\0\0\x79\x01\0\0\x91\x01\0\0\xa5\x01\0\0\
-\xbb\x01\0\0\xcf\x01\0\0\xe9\x01\0\0\xfd\x01\0\0\x05\x02\0\0\x11\x02\0\0\x1b\
-\x02\0\0\x26\x02\0\0\x34\x02\0\0\x45\x02\0\0\x57\x02\0\0\x69\x02\0\0\x6f\x02\0\
-\0\x74\x02\0\0\x85\x02\0\0\x89\x02\0\0\x8d\x02\0\0\x91\x02\0\0\x95\x02\0\0\x99\
-\x02\0\0\x9c\x02\0\0\x9f\x02\0\0\xa3\x02\0\0\xa7\x02\0\0\xaa\x02\0\0\xad\x02\0\
-\0\xb0\x02\0\0\xb3\x02\0\0\xb6\x02\0\0\xb9\x02\0\0\xbc\x02\0\0\xc4\x02\0\0\xc7\
-\x02\0\0\xca\x02\0\0\xd9\x02\0\0\xdf\x02\0\0\xe3\x02\0\0\xe7\x02\0\0\xeb\x02\0\
-\0\xf3\x02\0\0\xf6\x02\0\0\xfa\x02\0\0\0\x03\0\0\x03\x03\0\0\x06\x03\0\0\x0a\
-\x03\0\0\x12\x03\0\0\x16\x03\0\0\x1e\x03\0\0\x22\x03\0\0\x29\x03\0\0\x31\x03\0\
-\0\x34\x03\0\0\x3b\x03\0\0\x43\x03\0\0\x4b\x03\0\0\x54\x03\0\0\x59\x03\0\0\x5b\
-\x03\0\0\x65\x03\0\0\x69\x03\0\0\x6d\x03\0\0\x72\x03\0\0\x7b\x03\0\0\x84\x03\0\
-\0\x90\x03\0\0\x9b\x03\0\0\xa7\x03\0\0\xae\x03\0\0\xb4\x03\0\0\xc9\x03\0\0\xd0\
-\x03\0\0\xd7\x03\0\0\xdc\x03\0\0\xee\x03\0\0\xfe\x03\0\0\x05\x04\0\0\x19\x04\0\
-\0\x2c\x04\0\0\x3f\x04\0\0\x4c\x04\0\0\x5d\x04\0\0\x6b\x04\0\0\x7d\x04\0\0\x89\
-\x04\0\0\x99\x04\0\0\xab\x04\0\0\xb1\x04\0\0\xb6\x04\0\0\xbe\x04\0\0\xc0\x04\0\
-\0\x63\x6c\x61\x6e\x67\x20\x76\x65\x72\x73\x69\x6f\x6e\x20\x31\x39\x2e\x31\x2e\
-\x37\0\x73\x72\x63\x2f\x64\x79\x6e\x6c\x69\x62\x5f\x6d\x6f\x6e\x69\x74\x6f\x72\
-\x2e\x62\x70\x66\x2e\x63\0\x2f\x68\x6f\x6d\x65\x2f\x59\x75\x61\x6e\x6d\x78\x63\
-\x2f\x43\x6f\x75\x72\x73\x65\x2f\x47\x72\x61\x64\x50\x72\x6f\x6a\x65\x63\x74\
-\x2f\x64\x79\x6e\x6c\x69\x62\x5f\x6d\x6f\x6e\x69\x74\x6f\x72\0\x4c\x49\x43\x45\
-\x4e\x53\x45\0\x63\x68\x61\x72\0\x5f\x5f\x41\x52\x52\x41\x59\x5f\x53\x49\x5a\
-\x45\x5f\x54\x59\x50\x45\x5f\x5f\0\x68\x61\x6e\x64\x6c\x65\x5f\x74\x6f\x5f\x70\
-\x61\x74\x68\0\x74\x79\x70\x65\0\x69\x6e\x74\0\x6d\x61\x78\x5f\x65\x6e\x74\x72\
-\x69\x65\x73\0\x6b\x65\x79\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x6c\x6f\x6e\
-\x67\x20\x6c\x6f\x6e\x67\0\x5f\x5f\x75\x36\x34\0\x76\x61\x6c\x75\x65\0\x65\x76\
-\x65\x6e\x74\x73\0\x6b\x65\x79\x5f\x73\x69\x7a\x65\0\x76\x61\x6c\x75\x65\x5f\
-\x73\x69\x7a\x65\0\x74\x65\x6d\x70\x5f\x70\x61\x74\x68\0\x75\x6e\x73\x69\x67\
-\x6e\x65\x64\x20\x69\x6e\x74\0\x5f\x5f\x75\x33\x32\0\x74\x61\x72\x67\x65\x74\
-\x5f\x70\x72\x6f\x63\x65\x73\x73\0\x6d\x6f\x6e\x69\x74\x6f\x72\x5f\x70\x72\x6f\
-\x63\x65\x73\x73\0\x62\x70\x66\x5f\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x6e\
-\x73\0\x62\x70\x66\x5f\x67\x65\x74\x5f\x63\x75\x72\x72\x65\x6e\x74\x5f\x70\x69\
-\x64\x5f\x74\x67\x69\x64\0\x62\x70\x66\x5f\x67\x65\x74\x5f\x63\x75\x72\x72\x65\
-\x6e\x74\x5f\x75\x69\x64\x5f\x67\x69\x64\0\x62\x70\x66\x5f\x67\x65\x74\x5f\x63\
-\x75\x72\x72\x65\x6e\x74\x5f\x63\x6f\x6d\x6d\0\x6c\x6f\x6e\x67\0\x62\x70\x66\
-\x5f\x70\x72\x6f\x62\x65\x5f\x72\x65\x61\x64\x5f\x75\x73\x65\x72\x5f\x73\x74\
-\x72\0\x62\x70\x66\x5f\x6d\x61\x70\x5f\x75\x70\x64\x61\x74\x65\x5f\x65\x6c\x65\
-\x6d\0\x62\x70\x66\x5f\x70\x65\x72\x66\x5f\x65\x76\x65\x6e\x74\x5f\x6f\x75\x74\
-\x70\x75\x74\0\x62\x70\x66\x5f\x6d\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\
-\x6c\x65\x6d\0\x62\x70\x66\x5f\x70\x72\x6f\x62\x65\x5f\x72\x65\x61\x64\x5f\x6b\
-\x65\x72\x6e\x65\x6c\x5f\x73\x74\x72\0\x62\x70\x66\x5f\x6d\x61\x70\x5f\x64\x65\
-\x6c\x65\x74\x65\x5f\x65\x6c\x65\x6d\0\x42\x50\x46\x5f\x41\x4e\x59\0\x42\x50\
-\x46\x5f\x4e\x4f\x45\x58\x49\x53\x54\0\x42\x50\x46\x5f\x45\x58\x49\x53\x54\0\
-\x42\x50\x46\x5f\x46\x5f\x4c\x4f\x43\x4b\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\
-\x6c\x6f\x6e\x67\0\x42\x50\x46\x5f\x46\x5f\x49\x4e\x44\x45\x58\x5f\x4d\x41\x53\
-\x4b\0\x42\x50\x46\x5f\x46\x5f\x43\x55\x52\x52\x45\x4e\x54\x5f\x43\x50\x55\0\
-\x42\x50\x46\x5f\x46\x5f\x43\x54\x58\x4c\x45\x4e\x5f\x4d\x41\x53\x4b\0\x66\x61\
-\x6c\x73\x65\0\x74\x72\x75\x65\0\x5f\x5f\x5f\x5f\x74\x72\x61\x63\x65\x5f\x64\
-\x6c\x6f\x70\x65\x6e\0\x63\x74\x78\0\x72\x31\x35\0\x72\x31\x34\0\x72\x31\x33\0\
-\x72\x31\x32\0\x62\x70\0\x62\x78\0\x72\x31\x31\0\x72\x31\x30\0\x72\x39\0\x72\
-\x38\0\x61\x78\0\x63\x78\0\x64\x78\0\x73\x69\0\x64\x69\0\x6f\x72\x69\x67\x5f\
-\x61\x78\0\x69\x70\0\x63\x73\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x73\x68\x6f\
-\x72\x74\0\x5f\x5f\x75\x31\x36\0\x75\x31\x36\0\x63\x73\x78\0\x75\x36\x34\0\x66\
-\x72\x65\x64\x5f\x63\x73\0\x73\x6c\0\x77\x66\x65\0\x66\x6c\x61\x67\x73\0\x73\
-\x70\0\x73\x73\0\x73\x73\x78\0\x66\x72\x65\x64\x5f\x73\x73\0\x73\x74\x69\0\x73\
-\x77\x65\x76\x65\x6e\x74\0\x6e\x6d\x69\0\x76\x65\x63\x74\x6f\x72\0\x65\x6e\x63\
-\x6c\x61\x76\x65\0\x6c\x6d\0\x6e\x65\x73\x74\x65\x64\0\x69\x6e\x73\x6e\x6c\x65\
-\x6e\0\x70\x74\x5f\x72\x65\x67\x73\0\x66\x69\x6c\x65\x6e\x61\x6d\x65\0\x70\x61\
-\x74\x68\0\x65\0\x74\x69\x6d\x65\x73\x74\x61\x6d\x70\0\x70\x69\x64\0\x75\x69\
-\x64\0\x63\x6f\x6d\x6d\0\x6c\x69\x62\x5f\x70\x61\x74\x68\0\x6c\x69\x62\x5f\x61\
-\x64\x64\x72\0\x73\x79\x6d\x62\x6f\x6c\x5f\x6e\x61\x6d\x65\0\x65\x76\x65\x6e\
-\x74\x5f\x74\x79\x70\x65\0\x73\x79\x6d\x62\x6f\x6c\x5f\x61\x64\x64\x72\0\x72\
-\x65\x73\x75\x6c\x74\0\x65\x76\x65\x6e\x74\0\x5f\x5f\x5f\x5f\x74\x72\x61\x63\
-\x65\x5f\x64\x6c\x6f\x70\x65\x6e\x5f\x72\x65\x74\0\x72\x65\x74\x76\x61\x6c\0\
-\x68\x61\x6e\x64\x6c\x65\0\x74\x65\x6d\x70\0\x5f\x5f\x5f\x5f\x74\x72\x61\x63\
-\x65\x5f\x64\x6c\x63\x6c\x6f\x73\x65\0\x5f\x5f\x5f\x5f\x74\x72\x61\x63\x65\x5f\
-\x64\x6c\x73\x79\x6d\0\x73\x79\x6d\x62\x6f\x6c\0\x5f\x5f\x5f\x5f\x74\x72\x61\
-\x63\x65\x5f\x64\x6c\x73\x79\x6d\x5f\x72\x65\x74\0\x44\x57\x5f\x41\x54\x45\x5f\
-\x75\x6e\x73\x69\x67\x6e\x65\x64\x5f\x33\x32\0\x44\x57\x5f\x41\x54\x45\x5f\x75\
-\x6e\x73\x69\x67\x6e\x65\x64\x5f\x36\x34\0\x74\x72\x61\x63\x65\x5f\x64\x6c\x6f\
-\x70\x65\x6e\0\x74\x72\x61\x63\x65\x5f\x64\x6c\x6f\x70\x65\x6e\x5f\x72\x65\x74\
-\0\x74\x72\x61\x63\x65\x5f\x64\x6c\x63\x6c\x6f\x73\x65\0\x74\x72\x61\x63\x65\
-\x5f\x64\x6c\x63\x6c\x6f\x73\x65\x5f\x72\x65\x74\0\x74\x72\x61\x63\x65\x5f\x64\
-\x6c\x73\x79\x6d\0\x74\x72\x61\x63\x65\x5f\x64\x6c\x73\x79\x6d\x5f\x72\x65\x74\
-\0\x69\x73\x5f\x74\x61\x72\x67\x65\x74\x5f\x70\x72\x6f\x63\x65\x73\x73\0\x5f\
-\x42\x6f\x6f\x6c\0\x62\x6f\x6f\x6c\0\x6d\x6f\x6e\x69\x74\x6f\x72\0\x69\0\x74\
-\x61\x72\x67\x65\x74\0\xbc\0\0\0\x05\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x18\0\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x18\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x18\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\x18\0\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x10\0\0\0\
-\0\0\0\0\x18\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x9f\xeb\x01\0\x18\0\0\0\0\0\0\0\xbc\
-\x06\0\0\xbc\x06\0\0\xba\x0b\0\0\0\0\0\0\0\0\0\x02\x03\0\0\0\x01\0\0\0\0\0\0\
-\x01\x04\0\0\0\x20\0\0\x01\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\x01\0\
-\0\0\x05\0\0\0\0\0\0\x01\x04\0\0\0\x20\0\0\0\0\0\0\0\0\0\0\x02\x06\0\0\0\0\0\0\
-\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\x02\x08\0\0\0\
-\x19\0\0\0\0\0\0\x08\x09\0\0\0\x1f\0\0\0\0\0\0\x01\x08\0\0\0\x40\0\0\0\0\0\0\0\
-\0\0\0\x02\x0c\0\0\0\x32\0\0\0\0\0\0\x01\x01\0\0\0\x08\0\0\x01\0\0\0\0\0\0\0\
-\x03\0\0\0\0\x0b\0\0\0\x04\0\0\0\x40\0\0\0\0\0\0\0\x04\0\0\x04\x20\0\0\0\x37\0\
-\0\0\x01\0\0\0\0\0\0\0\x3c\0\0\0\x05\0\0\0\x40\0\0\0\x48\0\0\0\x07\0\0\0\x80\0\
-\0\0\x4c\0\0\0\x0a\0\0\0\xc0\0\0\0\x52\0\0\0\0\0\0\x0e\x0d\0\0\0\x01\0\0\0\0\0\
-\0\0\0\0\0\x02\x10\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\x04\0\0\
-\0\0\0\0\0\x04\0\0\x04\x20\0\0\0\x37\0\0\0\x0f\0\0\0\0\0\0\0\x61\0\0\0\x0f\0\0\
-\0\x40\0\0\0\x6a\0\0\0\x0f\0\0\0\x80\0\0\0\x3c\0\0\0\x05\0\0\0\xc0\0\0\0\x75\0\
-\0\0\0\0\0\x0e\x11\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\x02\x14\0\0\0\x7c\0\0\0\0\0\0\
-\x08\x15\0\0\0\x82\0\0\0\0\0\0\x01\x04\0\0\0\x20\0\0\0\0\0\0\0\x04\0\0\x04\x20\
-\0\0\0\x37\0\0\0\x01\0\0\0\0\0\0\0\x3c\0\0\0\x01\0\0\0\x40\0\0\0\x48\0\0\0\x13\
-\0\0\0\x80\0\0\0\x4c\0\0\0\x0a\0\0\0\xc0\0\0\0\x8f\0\0\0\0\0\0\x0e\x16\0\0\0\
-\x01\0\0\0\0\0\0\0\0\0\0\x02\x19\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\
-\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\x02\x1b\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x0b\0\0\
-\0\x04\0\0\0\x10\0\0\0\0\0\0\0\x04\0\0\x04\x20\0\0\0\x37\0\0\0\x18\0\0\0\0\0\0\
-\0\x3c\0\0\0\x01\0\0\0\x40\0\0\0\x48\0\0\0\x13\0\0\0\x80\0\0\0\x4c\0\0\0\x1a\0\
-\0\0\xc0\0\0\0\x99\0\0\0\0\0\0\x0e\x1c\0\0\0\x01\0\0\0\0\0\0\0\x04\0\0\x04\x20\
-\0\0\0\x37\0\0\0\x18\0\0\0\0\0\0\0\x3c\0\0\0\x01\0\0\0\x40\0\0\0\x48\0\0\0\x13\
-\0\0\0\x80\0\0\0\x4c\0\0\0\x1a\0\0\0\xc0\0\0\0\xa8\0\0\0\0\0\0\x0e\x1e\0\0\0\
-\x01\0\0\0\0\0\0\0\0\0\0\x02\x21\0\0\0\xb8\0\0\0\x15\0\0\x04\xa8\0\0\0\xc0\0\0\
-\0\x22\0\0\0\0\0\0\0\xc4\0\0\0\x22\0\0\0\x40\0\0\0\xc8\0\0\0\x22\0\0\0\x80\0\0\
-\0\xcc\0\0\0\x22\0\0\0\xc0\0\0\0\xd0\0\0\0\x22\0\0\0\0\x01\0\0\xd3\0\0\0\x22\0\
-\0\0\x40\x01\0\0\xd6\0\0\0\x22\0\0\0\x80\x01\0\0\xda\0\0\0\x22\0\0\0\xc0\x01\0\
-\0\xde\0\0\0\x22\0\0\0\0\x02\0\0\xe1\0\0\0\x22\0\0\0\x40\x02\0\0\xe4\0\0\0\x22\
-\0\0\0\x80\x02\0\0\xe7\0\0\0\x22\0\0\0\xc0\x02\0\0\xea\0\0\0\x22\0\0\0\0\x03\0\
-\0\xed\0\0\0\x22\0\0\0\x40\x03\0\0\xf0\0\0\0\x22\0\0\0\x80\x03\0\0\xf3\0\0\0\
-\x22\0\0\0\xc0\x03\0\0\xfb\0\0\0\x22\0\0\0\0\x04\0\0\0\0\0\0\x23\0\0\0\x40\x04\
-\0\0\xfe\0\0\0\x22\0\0\0\x80\x04\0\0\x04\x01\0\0\x22\0\0\0\xc0\x04\0\0\0\0\0\0\
-\x29\0\0\0\0\x05\0\0\x07\x01\0\0\0\0\0\x01\x08\0\0\0\x40\0\0\0\0\0\0\0\x03\0\0\
-\x05\x08\0\0\0\x15\x01\0\0\x24\0\0\0\0\0\0\0\x18\x01\0\0\x27\0\0\0\0\0\0\0\x1c\
-\x01\0\0\x28\0\0\0\0\0\0\0\x24\x01\0\0\0\0\0\x08\x25\0\0\0\x28\x01\0\0\0\0\0\
-\x08\x26\0\0\0\x2e\x01\0\0\0\0\0\x01\x02\0\0\0\x10\0\0\0\x3d\x01\0\0\0\0\0\x08\
-\x08\0\0\0\x1c\x01\0\0\x03\0\0\x84\x08\0\0\0\x15\x01\0\0\x27\0\0\0\0\0\0\x10\
-\x41\x01\0\0\x27\0\0\0\x10\0\0\x02\x44\x01\0\0\x27\0\0\0\x12\0\0\x01\0\0\0\0\
-\x03\0\0\x05\x08\0\0\0\x48\x01\0\0\x24\0\0\0\0\0\0\0\x4b\x01\0\0\x27\0\0\0\0\0\
-\0\0\x4f\x01\0\0\x2a\0\0\0\0\0\0\0\x4f\x01\0\0\x0a\0\0\x84\x08\0\0\0\x48\x01\0\
-\0\x27\0\0\0\0\0\0\x10\x57\x01\0\0\x27\0\0\0\x10\0\0\x01\x5b\x01\0\0\x27\0\0\0\
-\x11\0\0\x01\x63\x01\0\0\x27\0\0\0\x12\0\0\x01\x67\x01\0\0\x27\0\0\0\x20\0\0\
-\x08\x37\0\0\0\x27\0\0\0\x30\0\0\x04\x6e\x01\0\0\x27\0\0\0\x38\0\0\x01\x76\x01\
-\0\0\x27\0\0\0\x39\0\0\x01\x79\x01\0\0\x27\0\0\0\x3a\0\0\x01\x80\x01\0\0\x27\0\
-\0\0\x3c\0\0\x04\0\0\0\0\x01\0\0\x0d\x02\0\0\0\x88\x01\0\0\x20\0\0\0\x8c\x01\0\
-\0\x01\0\0\x0c\x2b\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\x88\x01\0\0\x20\0\0\0\
-\x93\x04\0\0\x01\0\0\x0c\x2d\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\x88\x01\0\0\
-\x20\0\0\0\x7d\x06\0\0\x01\0\0\x0c\x2f\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\x88\
-\x01\0\0\x20\0\0\0\xef\x07\0\0\x01\0\0\x0c\x31\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\
-\0\0\x88\x01\0\0\x20\0\0\0\x57\x08\0\0\x01\0\0\x0c\x33\0\0\0\0\0\0\0\x01\0\0\
-\x0d\x02\0\0\0\x88\x01\0\0\x20\0\0\0\x39\x09\0\0\x01\0\0\x0c\x35\0\0\0\0\0\0\0\
-\0\0\0\x0d\x38\0\0\0\xc0\x09\0\0\0\0\0\x08\x39\0\0\0\xc5\x09\0\0\0\0\0\x01\x01\
-\0\0\0\x08\0\0\x04\xcb\x09\0\0\0\0\0\x0c\x37\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\
-\x0b\0\0\0\x04\0\0\0\x04\0\0\0\xa4\x0b\0\0\0\0\0\x0e\x3b\0\0\0\x01\0\0\0\xac\
-\x0b\0\0\x05\0\0\x0f\0\0\0\0\x0e\0\0\0\0\0\0\0\x20\0\0\0\x12\0\0\0\0\0\0\0\x20\
-\0\0\0\x17\0\0\0\0\0\0\0\x20\0\0\0\x1d\0\0\0\0\0\0\0\x20\0\0\0\x1f\0\0\0\0\0\0\
-\0\x20\0\0\0\xb2\x0b\0\0\x01\0\0\x0f\0\0\0\0\x3c\0\0\0\0\0\0\0\x04\0\0\0\0\x69\
-\x6e\x74\0\x5f\x5f\x41\x52\x52\x41\x59\x5f\x53\x49\x5a\x45\x5f\x54\x59\x50\x45\
-\x5f\x5f\0\x5f\x5f\x75\x36\x34\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x6c\x6f\
-\x6e\x67\x20\x6c\x6f\x6e\x67\0\x63\x68\x61\x72\0\x74\x79\x70\x65\0\x6d\x61\x78\
-\x5f\x65\x6e\x74\x72\x69\x65\x73\0\x6b\x65\x79\0\x76\x61\x6c\x75\x65\0\x68\x61\
-\x6e\x64\x6c\x65\x5f\x74\x6f\x5f\x70\x61\x74\x68\0\x6b\x65\x79\x5f\x73\x69\x7a\
-\x65\0\x76\x61\x6c\x75\x65\x5f\x73\x69\x7a\x65\0\x65\x76\x65\x6e\x74\x73\0\x5f\
-\x5f\x75\x33\x32\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x69\x6e\x74\0\x74\x65\
-\x6d\x70\x5f\x70\x61\x74\x68\0\x74\x61\x72\x67\x65\x74\x5f\x70\x72\x6f\x63\x65\
-\x73\x73\0\x6d\x6f\x6e\x69\x74\x6f\x72\x5f\x70\x72\x6f\x63\x65\x73\x73\0\x70\
-\x74\x5f\x72\x65\x67\x73\0\x72\x31\x35\0\x72\x31\x34\0\x72\x31\x33\0\x72\x31\
-\x32\0\x62\x70\0\x62\x78\0\x72\x31\x31\0\x72\x31\x30\0\x72\x39\0\x72\x38\0\x61\
-\x78\0\x63\x78\0\x64\x78\0\x73\x69\0\x64\x69\0\x6f\x72\x69\x67\x5f\x61\x78\0\
-\x69\x70\0\x66\x6c\x61\x67\x73\0\x73\x70\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\
-\x6c\x6f\x6e\x67\0\x63\x73\0\x63\x73\x78\0\x66\x72\x65\x64\x5f\x63\x73\0\x75\
-\x31\x36\0\x5f\x5f\x75\x31\x36\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x73\x68\
-\x6f\x72\x74\0\x75\x36\x34\0\x73\x6c\0\x77\x66\x65\0\x73\x73\0\x73\x73\x78\0\
-\x66\x72\x65\x64\x5f\x73\x73\0\x73\x74\x69\0\x73\x77\x65\x76\x65\x6e\x74\0\x6e\
-\x6d\x69\0\x76\x65\x63\x74\x6f\x72\0\x65\x6e\x63\x6c\x61\x76\x65\0\x6c\x6d\0\
-\x6e\x65\x73\x74\x65\x64\0\x69\x6e\x73\x6e\x6c\x65\x6e\0\x63\x74\x78\0\x74\x72\
-\x61\x63\x65\x5f\x64\x6c\x6f\x70\x65\x6e\0\x75\x70\x72\x6f\x62\x65\x2f\x2f\x75\
-\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\x36\x3a\x64\x6c\
-\x6f\x70\x65\x6e\0\x2f\x68\x6f\x6d\x65\x2f\x59\x75\x61\x6e\x6d\x78\x63\x2f\x43\
-\x6f\x75\x72\x73\x65\x2f\x47\x72\x61\x64\x50\x72\x6f\x6a\x65\x63\x74\x2f\x64\
-\x79\x6e\x6c\x69\x62\x5f\x6d\x6f\x6e\x69\x74\x6f\x72\x2f\x73\x72\x63\x2f\x64\
-\x79\x6e\x6c\x69\x62\x5f\x6d\x6f\x6e\x69\x74\x6f\x72\x2e\x62\x70\x66\x2e\x63\0\
-\x69\x6e\x74\x20\x42\x50\x46\x5f\x4b\x50\x52\x4f\x42\x45\x28\x74\x72\x61\x63\
-\x65\x5f\x64\x6c\x6f\x70\x65\x6e\x2c\x20\x63\x6f\x6e\x73\x74\x20\x63\x68\x61\
-\x72\x20\x2a\x66\x69\x6c\x65\x6e\x61\x6d\x65\x2c\x20\x69\x6e\x74\x20\x66\x6c\
-\x61\x67\x73\x29\0\x30\x3a\x31\x33\0\x30\x3a\x31\x34\0\x20\x20\x20\x20\x69\x66\
-\x20\x28\x21\x69\x73\x5f\x74\x61\x72\x67\x65\x74\x5f\x70\x72\x6f\x63\x65\x73\
-\x73\x28\x29\x29\0\x20\x20\x20\x20\x73\x74\x72\x75\x63\x74\x20\x65\x76\x65\x6e\
-\x74\x20\x65\x20\x3d\x20\x7b\x7d\x3b\0\x20\x20\x20\x20\x65\x2e\x74\x69\x6d\x65\
-\x73\x74\x61\x6d\x70\x20\x3d\x20\x62\x70\x66\x5f\x6b\x74\x69\x6d\x65\x5f\x67\
-\x65\x74\x5f\x6e\x73\x28\x29\x3b\0\x20\x20\x20\x20\x65\x2e\x70\x69\x64\x20\x3d\
-\x20\x62\x70\x66\x5f\x67\x65\x74\x5f\x63\x75\x72\x72\x65\x6e\x74\x5f\x70\x69\
-\x64\x5f\x74\x67\x69\x64\x28\x29\x20\x3e\x3e\x20\x33\x32\x3b\0\x20\x20\x20\x20\
-\x65\x2e\x75\x69\x64\x20\x3d\x20\x62\x70\x66\x5f\x67\x65\x74\x5f\x63\x75\x72\
-\x72\x65\x6e\x74\x5f\x75\x69\x64\x5f\x67\x69\x64\x28\x29\x20\x26\x20\x30\x78\
-\x46\x46\x46\x46\x46\x46\x46\x46\x3b\0\x20\x20\x20\x20\x62\x70\x66\x5f\x67\x65\
-\x74\x5f\x63\x75\x72\x72\x65\x6e\x74\x5f\x63\x6f\x6d\x6d\x28\x26\x65\x2e\x63\
-\x6f\x6d\x6d\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x65\x2e\x63\x6f\x6d\x6d\x29\
-\x29\x3b\0\x20\x20\x20\x20\x62\x70\x66\x5f\x70\x72\x6f\x62\x65\x5f\x72\x65\x61\
-\x64\x5f\x75\x73\x65\x72\x5f\x73\x74\x72\x28\x70\x61\x74\x68\x2c\x20\x73\x69\
-\x7a\x65\x6f\x66\x28\x70\x61\x74\x68\x29\x2c\x20\x66\x69\x6c\x65\x6e\x61\x6d\
-\x65\x29\x3b\0\x20\x20\x20\x20\x5f\x5f\x75\x33\x32\x20\x6b\x65\x79\x20\x3d\x20\
-\x30\x3b\0\x20\x20\x20\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x75\x70\x64\x61\x74\
-\x65\x5f\x65\x6c\x65\x6d\x28\x26\x74\x65\x6d\x70\x5f\x70\x61\x74\x68\x2c\x20\
-\x26\x6b\x65\x79\x2c\x20\x70\x61\x74\x68\x2c\x20\x42\x50\x46\x5f\x41\x4e\x59\
-\x29\x3b\0\x20\x20\x20\x20\x62\x70\x66\x5f\x70\x72\x6f\x62\x65\x5f\x72\x65\x61\
-\x64\x5f\x75\x73\x65\x72\x5f\x73\x74\x72\x28\x65\x2e\x6c\x69\x62\x5f\x70\x61\
-\x74\x68\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x65\x2e\x6c\x69\x62\x5f\x70\x61\
-\x74\x68\x29\x2c\x20\x66\x69\x6c\x65\x6e\x61\x6d\x65\x29\x3b\0\x20\x20\x20\x20\
-\x65\x2e\x66\x6c\x61\x67\x73\x20\x3d\x20\x66\x6c\x61\x67\x73\x3b\0\x20\x20\x20\
-\x20\x65\x2e\x65\x76\x65\x6e\x74\x5f\x74\x79\x70\x65\x20\x3d\x20\x31\x3b\x20\
-\x20\x2f\x2f\x20\xe5\x8a\xa0\xe8\xbd\xbd\xe4\xba\x8b\xe4\xbb\xb6\0\x20\x20\x20\
-\x20\x62\x70\x66\x5f\x70\x65\x72\x66\x5f\x65\x76\x65\x6e\x74\x5f\x6f\x75\x74\
-\x70\x75\x74\x28\x63\x74\x78\x2c\x20\x26\x65\x76\x65\x6e\x74\x73\x2c\x20\x42\
-\x50\x46\x5f\x46\x5f\x43\x55\x52\x52\x45\x4e\x54\x5f\x43\x50\x55\x2c\x20\x26\
-\x65\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x65\x29\x29\x3b\0\x74\x72\x61\x63\x65\
-\x5f\x64\x6c\x6f\x70\x65\x6e\x5f\x72\x65\x74\0\x75\x72\x65\x74\x70\x72\x6f\x62\
-\x65\x2f\x2f\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\
-\x36\x3a\x64\x6c\x6f\x70\x65\x6e\0\x69\x6e\x74\x20\x42\x50\x46\x5f\x4b\x52\x45\
-\x54\x50\x52\x4f\x42\x45\x28\x74\x72\x61\x63\x65\x5f\x64\x6c\x6f\x70\x65\x6e\
-\x5f\x72\x65\x74\x2c\x20\x76\x6f\x69\x64\x20\x2a\x72\x65\x74\x76\x61\x6c\x29\0\
-\x30\x3a\x31\x30\0\x20\x20\x20\x20\x5f\x5f\x75\x36\x34\x20\x68\x61\x6e\x64\x6c\
-\x65\x20\x3d\x20\x28\x5f\x5f\x75\x36\x34\x29\x72\x65\x74\x76\x61\x6c\x3b\0\x20\
-\x20\x20\x20\x65\x2e\x6c\x69\x62\x5f\x61\x64\x64\x72\x20\x3d\x20\x68\x61\x6e\
-\x64\x6c\x65\x3b\0\x20\x20\x20\x20\x63\x68\x61\x72\x20\x2a\x74\x65\x6d\x70\x20\
-\x3d\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\x6c\
-\x65\x6d\x28\x26\x74\x65\x6d\x70\x5f\x70\x61\x74\x68\x2c\x20\x26\x6b\x65\x79\
-\x29\x3b\0\x20\x20\x20\x20\x69\x66\x20\x28\x74\x65\x6d\x70\x20\x26\x26\x20\x68\
-\x61\x6e\x64\x6c\x65\x20\x21\x3d\x20\x30\x29\x20\x7b\0\x20\x20\x20\x20\x20\x20\
-\x20\x20\x62\x70\x66\x5f\x70\x72\x6f\x62\x65\x5f\x72\x65\x61\x64\x5f\x6b\x65\
-\x72\x6e\x65\x6c\x5f\x73\x74\x72\x28\x70\x61\x74\x68\x2c\x20\x73\x69\x7a\x65\
-\x6f\x66\x28\x70\x61\x74\x68\x29\x2c\x20\x74\x65\x6d\x70\x29\x3b\0\x20\x20\x20\
-\x20\x20\x20\x20\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x75\x70\x64\x61\x74\x65\
-\x5f\x65\x6c\x65\x6d\x28\x26\x68\x61\x6e\x64\x6c\x65\x5f\x74\x6f\x5f\x70\x61\
-\x74\x68\x2c\x20\x26\x68\x61\x6e\x64\x6c\x65\x2c\x20\x70\x61\x74\x68\x2c\x20\
-\x42\x50\x46\x5f\x41\x4e\x59\x29\x3b\0\x20\x20\x20\x20\x20\x20\x20\x20\x5f\x5f\
-\x62\x75\x69\x6c\x74\x69\x6e\x5f\x6d\x65\x6d\x63\x70\x79\x28\x65\x2e\x6c\x69\
-\x62\x5f\x70\x61\x74\x68\x2c\x20\x70\x61\x74\x68\x2c\x20\x73\x69\x7a\x65\x6f\
-\x66\x28\x70\x61\x74\x68\x29\x29\x3b\0\x20\x20\x20\x20\x20\x20\x20\x20\x62\x70\
-\x66\x5f\x6d\x61\x70\x5f\x64\x65\x6c\x65\x74\x65\x5f\x65\x6c\x65\x6d\x28\x26\
-\x74\x65\x6d\x70\x5f\x70\x61\x74\x68\x2c\x20\x26\x6b\x65\x79\x29\x3b\0\x74\x72\
-\x61\x63\x65\x5f\x64\x6c\x63\x6c\x6f\x73\x65\0\x75\x70\x72\x6f\x62\x65\x2f\x2f\
-\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\x36\x3a\x64\
-\x6c\x63\x6c\x6f\x73\x65\0\x69\x6e\x74\x20\x42\x50\x46\x5f\x4b\x50\x52\x4f\x42\
-\x45\x28\x74\x72\x61\x63\x65\x5f\x64\x6c\x63\x6c\x6f\x73\x65\x2c\x20\x76\x6f\
-\x69\x64\x20\x2a\x68\x61\x6e\x64\x6c\x65\x29\0\x20\x20\x20\x20\x65\x2e\x65\x76\
-\x65\x6e\x74\x5f\x74\x79\x70\x65\x20\x3d\x20\x32\x3b\x20\x20\x2f\x2f\x20\xe5\
-\x8d\xb8\xe8\xbd\xbd\xe4\xba\x8b\xe4\xbb\xb6\0\x20\x20\x20\x20\x65\x2e\x6c\x69\
-\x62\x5f\x61\x64\x64\x72\x20\x3d\x20\x28\x5f\x5f\x75\x36\x34\x29\x68\x61\x6e\
-\x64\x6c\x65\x3b\0\x20\x20\x20\x20\x63\x68\x61\x72\x20\x2a\x70\x61\x74\x68\x20\
-\x3d\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\x6c\
-\x65\x6d\x28\x26\x68\x61\x6e\x64\x6c\x65\x5f\x74\x6f\x5f\x70\x61\x74\x68\x2c\
-\x20\x26\x65\x2e\x6c\x69\x62\x5f\x61\x64\x64\x72\x29\x3b\0\x20\x20\x20\x20\x69\
-\x66\x20\x28\x70\x61\x74\x68\x29\x20\x7b\0\x20\x20\x20\x20\x20\x20\x20\x20\x5f\
-\x5f\x62\x75\x69\x6c\x74\x69\x6e\x5f\x6d\x65\x6d\x63\x70\x79\x28\x65\x2e\x6c\
-\x69\x62\x5f\x70\x61\x74\x68\x2c\x20\x70\x61\x74\x68\x2c\x20\x73\x69\x7a\x65\
-\x6f\x66\x28\x65\x2e\x6c\x69\x62\x5f\x70\x61\x74\x68\x29\x29\x3b\0\x20\x20\x20\
-\x20\x20\x20\x20\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x64\x65\x6c\x65\x74\x65\
-\x5f\x65\x6c\x65\x6d\x28\x26\x68\x61\x6e\x64\x6c\x65\x5f\x74\x6f\x5f\x70\x61\
-\x74\x68\x2c\x20\x26\x65\x2e\x6c\x69\x62\x5f\x61\x64\x64\x72\x29\x3b\0\x74\x72\
-\x61\x63\x65\x5f\x64\x6c\x63\x6c\x6f\x73\x65\x5f\x72\x65\x74\0\x75\x72\x65\x74\
-\x70\x72\x6f\x62\x65\x2f\x2f\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\
-\x2e\x73\x6f\x2e\x36\x3a\x64\x6c\x63\x6c\x6f\x73\x65\0\x69\x6e\x74\x20\x42\x50\
-\x46\x5f\x4b\x52\x45\x54\x50\x52\x4f\x42\x45\x28\x74\x72\x61\x63\x65\x5f\x64\
-\x6c\x63\x6c\x6f\x73\x65\x5f\x72\x65\x74\x2c\x20\x69\x6e\x74\x20\x72\x65\x74\
-\x76\x61\x6c\x29\0\x74\x72\x61\x63\x65\x5f\x64\x6c\x73\x79\x6d\0\x75\x70\x72\
-\x6f\x62\x65\x2f\x2f\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\
-\x6f\x2e\x36\x3a\x64\x6c\x73\x79\x6d\0\x69\x6e\x74\x20\x42\x50\x46\x5f\x4b\x50\
-\x52\x4f\x42\x45\x28\x74\x72\x61\x63\x65\x5f\x64\x6c\x73\x79\x6d\x2c\x20\x76\
-\x6f\x69\x64\x20\x2a\x68\x61\x6e\x64\x6c\x65\x2c\x20\x63\x6f\x6e\x73\x74\x20\
-\x63\x68\x61\x72\x20\x2a\x73\x79\x6d\x62\x6f\x6c\x29\0\x20\x20\x20\x20\x62\x70\
-\x66\x5f\x70\x72\x6f\x62\x65\x5f\x72\x65\x61\x64\x5f\x75\x73\x65\x72\x5f\x73\
-\x74\x72\x28\x65\x2e\x73\x79\x6d\x62\x6f\x6c\x5f\x6e\x61\x6d\x65\x2c\x20\x73\
-\x69\x7a\x65\x6f\x66\x28\x65\x2e\x73\x79\x6d\x62\x6f\x6c\x5f\x6e\x61\x6d\x65\
-\x29\x2c\x20\x73\x79\x6d\x62\x6f\x6c\x29\x3b\0\x20\x20\x20\x20\x65\x2e\x65\x76\
-\x65\x6e\x74\x5f\x74\x79\x70\x65\x20\x3d\x20\x33\x3b\x20\x20\x2f\x2f\x20\xe7\
-\xac\xa6\xe5\x8f\xb7\xe8\xa7\xa3\xe6\x9e\x90\xe4\xba\x8b\xe4\xbb\xb6\0\x74\x72\
-\x61\x63\x65\x5f\x64\x6c\x73\x79\x6d\x5f\x72\x65\x74\0\x75\x72\x65\x74\x70\x72\
-\x6f\x62\x65\x2f\x2f\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\
-\x6f\x2e\x36\x3a\x64\x6c\x73\x79\x6d\0\x69\x6e\x74\x20\x42\x50\x46\x5f\x4b\x52\
-\x45\x54\x50\x52\x4f\x42\x45\x28\x74\x72\x61\x63\x65\x5f\x64\x6c\x73\x79\x6d\
-\x5f\x72\x65\x74\x2c\x20\x76\x6f\x69\x64\x20\x2a\x72\x65\x74\x76\x61\x6c\x29\0\
-\x20\x20\x20\x20\x65\x2e\x73\x79\x6d\x62\x6f\x6c\x5f\x61\x64\x64\x72\x20\x3d\
-\x20\x28\x5f\x5f\x75\x36\x34\x29\x72\x65\x74\x76\x61\x6c\x3b\0\x62\x6f\x6f\x6c\
-\0\x5f\x42\x6f\x6f\x6c\0\x69\x73\x5f\x74\x61\x72\x67\x65\x74\x5f\x70\x72\x6f\
-\x63\x65\x73\x73\0\x2e\x74\x65\x78\x74\0\x73\x74\x61\x74\x69\x63\x20\x69\x6e\
-\x6c\x69\x6e\x65\x20\x62\x6f\x6f\x6c\x20\x69\x73\x5f\x74\x61\x72\x67\x65\x74\
-\x5f\x70\x72\x6f\x63\x65\x73\x73\x28\x76\x6f\x69\x64\x29\0\x20\x20\x20\x20\x62\
-\x70\x66\x5f\x67\x65\x74\x5f\x63\x75\x72\x72\x65\x6e\x74\x5f\x63\x6f\x6d\x6d\
-\x28\x26\x63\x6f\x6d\x6d\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x63\x6f\x6d\x6d\
-\x29\x29\x3b\0\x20\x20\x20\x20\x63\x68\x61\x72\x20\x2a\x6d\x6f\x6e\x69\x74\x6f\
-\x72\x20\x3d\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\
-\x65\x6c\x65\x6d\x28\x26\x6d\x6f\x6e\x69\x74\x6f\x72\x5f\x70\x72\x6f\x63\x65\
-\x73\x73\x2c\x20\x26\x6b\x65\x79\x29\x3b\0\x20\x20\x20\x20\x69\x66\x20\x28\x6d\
-\x6f\x6e\x69\x74\x6f\x72\x20\x26\x26\x20\x6d\x6f\x6e\x69\x74\x6f\x72\x5b\x30\
-\x5d\x20\x21\x3d\x20\x27\x5c\x30\x27\x29\x20\x7b\0\x20\x20\x20\x20\x20\x20\x20\
-\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6d\x6f\x6e\x69\x74\x6f\x72\x5b\x69\x5d\
-\x20\x21\x3d\x20\x63\x6f\x6d\x6d\x5b\x69\x5d\x29\x20\x7b\0\x20\x20\x20\x20\x63\
-\x68\x61\x72\x20\x2a\x74\x61\x72\x67\x65\x74\x20\x3d\x20\x62\x70\x66\x5f\x6d\
-\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\x6c\x65\x6d\x28\x26\x74\x61\x72\
-\x67\x65\x74\x5f\x70\x72\x6f\x63\x65\x73\x73\x2c\x20\x26\x6b\x65\x79\x29\x3b\0\
-\x20\x20\x20\x20\x69\x66\x20\x28\x21\x74\x61\x72\x67\x65\x74\x20\x7c\x7c\x20\
-\x74\x61\x72\x67\x65\x74\x5b\x30\x5d\x20\x3d\x3d\x20\x27\x5c\x30\x27\x29\x20\
-\x7b\0\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x61\x72\x67\x65\x74\
-\x5b\x69\x5d\x20\x21\x3d\x20\x63\x6f\x6d\x6d\x5b\x69\x5d\x29\x20\x7b\0\x7d\0\
-\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6d\x6f\x6e\
-\x69\x74\x6f\x72\x5b\x69\x5d\x20\x3d\x3d\x20\x27\x5c\x30\x27\x29\x20\x7b\0\x20\
-\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x61\x72\x67\x65\x74\x5b\x69\
-\x5d\x20\x3d\x3d\x20\x27\x5c\x30\x27\x29\x20\x7b\0\x4c\x49\x43\x45\x4e\x53\x45\
-\0\x2e\x6d\x61\x70\x73\0\x6c\x69\x63\x65\x6e\x73\x65\0\0\0\x9f\xeb\x01\0\x20\0\
-\0\0\0\0\0\0\x74\0\0\0\x74\0\0\0\xbc\x0f\0\0\x30\x10\0\0\x9c\0\0\0\x08\0\0\0\
-\x99\x01\0\0\x01\0\0\0\0\0\0\0\x2c\0\0\0\xa4\x04\0\0\x01\0\0\0\0\0\0\0\x2e\0\0\
-\0\x8b\x06\0\0\x01\0\0\0\0\0\0\0\x30\0\0\0\x01\x08\0\0\x01\0\0\0\0\0\0\0\x32\0\
-\0\0\x63\x08\0\0\x01\0\0\0\0\0\0\0\x34\0\0\0\x49\x09\0\0\x01\0\0\0\0\0\0\0\x36\
-\0\0\0\xdd\x09\0\0\x01\0\0\0\0\0\0\0\x3a\0\0\0\x10\0\0\0\x99\x01\0\0\x17\0\0\0\
-\0\0\0\0\xba\x01\0\0\x03\x02\0\0\0\x34\x02\0\x08\0\0\0\xba\x01\0\0\x03\x02\0\0\
-\x05\x34\x02\0\x18\0\0\0\xba\x01\0\0\x4b\x02\0\0\x0a\x3c\x02\0\x28\0\0\0\xba\
-\x01\0\0\x4b\x02\0\0\x09\x3c\x02\0\x38\0\0\0\xba\x01\0\0\x69\x02\0\0\x12\x48\
-\x02\0\xc8\0\0\0\xba\x01\0\0\x82\x02\0\0\x13\x58\x02\0\xd0\0\0\0\xba\x01\0\0\
-\x82\x02\0\0\x11\x58\x02\0\xd8\0\0\0\xba\x01\0\0\xa8\x02\0\0\x0d\x5c\x02\0\xe0\
-\0\0\0\xba\x01\0\0\xa8\x02\0\0\x28\x5c\x02\0\xe8\0\0\0\xba\x01\0\0\xa8\x02\0\0\
-\x0b\x5c\x02\0\xf0\0\0\0\xba\x01\0\0\xd6\x02\0\0\x0d\x60\x02\0\xf8\0\0\0\xba\
-\x01\0\0\xd6\x02\0\0\x0b\x60\x02\0\0\x01\0\0\xba\x01\0\0\x69\x02\0\0\x12\x48\
-\x02\0\x10\x01\0\0\xba\x01\0\0\x0a\x03\0\0\x05\x64\x02\0\x38\x01\0\0\xba\x01\0\
-\0\x3d\x03\0\0\x05\x70\x02\0\x58\x01\0\0\xba\x01\0\0\x78\x03\0\0\x0b\x74\x02\0\
-\x70\x01\0\0\xba\x01\0\0\x8b\x03\0\0\x05\x78\x02\0\x98\x01\0\0\xba\x01\0\0\x69\
-\x02\0\0\x12\x48\x02\0\xa8\x01\0\0\xba\x01\0\0\xc5\x03\0\0\x05\x80\x02\0\xc0\
-\x01\0\0\xba\x01\0\0\x0c\x04\0\0\x0d\x88\x02\0\xd8\x01\0\0\xba\x01\0\0\x21\x04\
-\0\0\x12\x84\x02\0\xf0\x01\0\0\xba\x01\0\0\x48\x04\0\0\x05\x94\x02\0\x28\x02\0\
-\0\xba\x01\0\0\x03\x02\0\0\x05\x34\x02\0\xa4\x04\0\0\x1a\0\0\0\0\0\0\0\xba\x01\
-\0\0\xc8\x04\0\0\0\xc0\x02\0\x08\0\0\0\xba\x01\0\0\xc8\x04\0\0\x05\xc0\x02\0\
-\x10\0\0\0\xba\x01\0\0\x4b\x02\0\0\x0a\xc8\x02\0\x20\0\0\0\xba\x01\0\0\x4b\x02\
-\0\0\x09\xc8\x02\0\x28\0\0\0\xba\x01\0\0\xff\x04\0\0\x0b\xd4\x02\0\x38\0\0\0\
-\xba\x01\0\0\x69\x02\0\0\x12\xd8\x02\0\xc8\0\0\0\xba\x01\0\0\x82\x02\0\0\x13\
-\xe4\x02\0\xd0\0\0\0\xba\x01\0\0\x82\x02\0\0\x11\xe4\x02\0\xd8\0\0\0\xba\x01\0\
-\0\xa8\x02\0\0\x0d\xe8\x02\0\xe0\0\0\0\xba\x01\0\0\xa8\x02\0\0\x28\xe8\x02\0\
-\xe8\0\0\0\xba\x01\0\0\xa8\x02\0\0\x0b\xe8\x02\0\xf0\0\0\0\xba\x01\0\0\xd6\x02\
-\0\0\x0d\xec\x02\0\xf8\0\0\0\xba\x01\0\0\xd6\x02\0\0\x0b\xec\x02\0\0\x01\0\0\
-\xba\x01\0\0\x69\x02\0\0\x12\xd8\x02\0\x10\x01\0\0\xba\x01\0\0\x0a\x03\0\0\x05\
-\xf0\x02\0\x28\x01\0\0\xba\x01\0\0\x21\x04\0\0\x12\xfc\x02\0\x30\x01\0\0\xba\
-\x01\0\0\x21\x05\0\0\x10\xf8\x02\0\x38\x01\0\0\xba\x01\0\0\x78\x03\0\0\x0b\x08\
-\x03\0\x50\x01\0\0\xba\x01\0\0\x3a\x05\0\0\x12\x0c\x03\0\x68\x01\0\0\xba\x01\0\
-\0\x72\x05\0\0\x0e\x10\x03\0\x88\x01\0\0\xba\x01\0\0\x91\x05\0\0\x09\x18\x03\0\
-\xb8\x01\0\0\xba\x01\0\0\xce\x05\0\0\x09\x1c\x03\0\xe0\x01\0\0\xba\x01\0\0\x14\
-\x06\0\0\x09\x20\x03\0\x40\x09\0\0\xba\x01\0\0\x4e\x06\0\0\x09\x24\x03\0\x68\
-\x09\0\0\xba\x01\0\0\x48\x04\0\0\x05\x34\x03\0\xa0\x09\0\0\xba\x01\0\0\xc8\x04\
-\0\0\x05\xc0\x02\0\x8b\x06\0\0\x17\0\0\0\0\0\0\0\xba\x01\0\0\xad\x06\0\0\0\x60\
-\x03\0\x08\0\0\0\xba\x01\0\0\xad\x06\0\0\x05\x60\x03\0\x10\0\0\0\xba\x01\0\0\
-\x4b\x02\0\0\x0a\x68\x03\0\x20\0\0\0\xba\x01\0\0\x4b\x02\0\0\x09\x68\x03\0\x30\
-\0\0\0\xba\x01\0\0\x69\x02\0\0\x12\x74\x03\0\xc0\0\0\0\xba\x01\0\0\x82\x02\0\0\
-\x13\x80\x03\0\xc8\0\0\0\xba\x01\0\0\x82\x02\0\0\x11\x80\x03\0\xd0\0\0\0\xba\
-\x01\0\0\xa8\x02\0\0\x0d\x84\x03\0\xd8\0\0\0\xba\x01\0\0\xa8\x02\0\0\x28\x84\
-\x03\0\xe0\0\0\0\xba\x01\0\0\xa8\x02\0\0\x0b\x84\x03\0\xe8\0\0\0\xba\x01\0\0\
-\xd6\x02\0\0\x0d\x88\x03\0\xf0\0\0\0\xba\x01\0\0\xd6\x02\0\0\x0b\x88\x03\0\xf8\
-\0\0\0\xba\x01\0\0\x69\x02\0\0\x12\x74\x03\0\x08\x01\0\0\xba\x01\0\0\x0a\x03\0\
-\0\x05\x8c\x03\0\x20\x01\0\0\xba\x01\0\0\xd9\x06\0\0\x12\x98\x03\0\x28\x01\0\0\
-\xba\x01\0\0\0\x07\0\0\x10\x94\x03\0\x30\x01\0\0\xba\x01\0\0\x69\x02\0\0\x12\
-\x74\x03\0\x40\x01\0\0\xba\x01\0\0\x20\x07\0\0\x12\xa4\x03\0\x60\x01\0\0\xba\
-\x01\0\0\x64\x07\0\0\x09\xa8\x03\0\x68\x01\0\0\xba\x01\0\0\x74\x07\0\0\x09\xac\
-\x03\0\xd8\x08\0\0\xba\x01\0\0\xb4\x07\0\0\x09\xb4\x03\0\x08\x09\0\0\xba\x01\0\
-\0\x48\x04\0\0\x05\xc4\x03\0\x40\x09\0\0\xba\x01\0\0\xad\x06\0\0\x05\x60\x03\0\
-\x01\x08\0\0\x01\0\0\0\0\0\0\0\xba\x01\0\0\x26\x08\0\0\x05\xec\x03\0\x63\x08\0\
-\0\x18\0\0\0\0\0\0\0\xba\x01\0\0\x83\x08\0\0\0\x1c\x04\0\x08\0\0\0\xba\x01\0\0\
-\x83\x08\0\0\x05\x1c\x04\0\x18\0\0\0\xba\x01\0\0\x4b\x02\0\0\x0a\x24\x04\0\x28\
-\0\0\0\xba\x01\0\0\x4b\x02\0\0\x09\x24\x04\0\x38\0\0\0\xba\x01\0\0\x69\x02\0\0\
-\x12\x30\x04\0\xc8\0\0\0\xba\x01\0\0\x82\x02\0\0\x13\x3c\x04\0\xd0\0\0\0\xba\
-\x01\0\0\x82\x02\0\0\x11\x3c\x04\0\xd8\0\0\0\xba\x01\0\0\xa8\x02\0\0\x0d\x40\
-\x04\0\xe0\0\0\0\xba\x01\0\0\xa8\x02\0\0\x28\x40\x04\0\xe8\0\0\0\xba\x01\0\0\
-\xa8\x02\0\0\x0b\x40\x04\0\xf0\0\0\0\xba\x01\0\0\xd6\x02\0\0\x0d\x44\x04\0\xf8\
-\0\0\0\xba\x01\0\0\xd6\x02\0\0\x0b\x44\x04\0\0\x01\0\0\xba\x01\0\0\x69\x02\0\0\
-\x12\x30\x04\0\x10\x01\0\0\xba\x01\0\0\x0a\x03\0\0\x05\x48\x04\0\x20\x01\0\0\
-\xba\x01\0\0\0\x07\0\0\x10\x50\x04\0\x28\x01\0\0\xba\x01\0\0\x69\x02\0\0\x12\
-\x30\x04\0\x38\x01\0\0\xba\x01\0\0\xc1\x08\0\0\x05\x54\x04\0\x58\x01\0\0\xba\
-\x01\0\0\x0c\x09\0\0\x12\x58\x04\0\x60\x01\0\0\xba\x01\0\0\x69\x02\0\0\x12\x30\
-\x04\0\x70\x01\0\0\xba\x01\0\0\x20\x07\0\0\x12\x64\x04\0\x88\x01\0\0\xba\x01\0\
-\0\x64\x07\0\0\x09\x68\x04\0\x90\x01\0\0\xba\x01\0\0\x74\x07\0\0\x09\x6c\x04\0\
-\x18\x09\0\0\xba\x01\0\0\x48\x04\0\0\x05\x7c\x04\0\x50\x09\0\0\xba\x01\0\0\x83\
-\x08\0\0\x05\x1c\x04\0\x49\x09\0\0\x12\0\0\0\0\0\0\0\xba\x01\0\0\x6c\x09\0\0\0\
-\xa8\x04\0\x08\0\0\0\xba\x01\0\0\x6c\x09\0\0\x05\xa8\x04\0\x10\0\0\0\xba\x01\0\
-\0\x4b\x02\0\0\x0a\xb0\x04\0\x20\0\0\0\xba\x01\0\0\x4b\x02\0\0\x09\xb0\x04\0\
-\x30\0\0\0\xba\x01\0\0\x69\x02\0\0\x12\xbc\x04\0\xc0\0\0\0\xba\x01\0\0\x82\x02\
-\0\0\x13\xc8\x04\0\xc8\0\0\0\xba\x01\0\0\x82\x02\0\0\x11\xc8\x04\0\xd0\0\0\0\
-\xba\x01\0\0\xa8\x02\0\0\x0d\xcc\x04\0\xd8\0\0\0\xba\x01\0\0\xa8\x02\0\0\x28\
-\xcc\x04\0\xe0\0\0\0\xba\x01\0\0\xa8\x02\0\0\x0b\xcc\x04\0\xe8\0\0\0\xba\x01\0\
-\0\xd6\x02\0\0\x0d\xd0\x04\0\xf0\0\0\0\xba\x01\0\0\xd6\x02\0\0\x0b\xd0\x04\0\
-\xf8\0\0\0\xba\x01\0\0\x69\x02\0\0\x12\xbc\x04\0\x08\x01\0\0\xba\x01\0\0\x0a\
-\x03\0\0\x05\xd4\x04\0\x18\x01\0\0\xba\x01\0\0\x9d\x09\0\0\x13\xdc\x04\0\x28\
-\x01\0\0\xba\x01\0\0\x0c\x09\0\0\x12\xe0\x04\0\x40\x01\0\0\xba\x01\0\0\x48\x04\
-\0\0\x05\xec\x04\0\x78\x01\0\0\xba\x01\0\0\x6c\x09\0\0\x05\xa8\x04\0\xdd\x09\0\
-\0\x85\0\0\0\0\0\0\0\xba\x01\0\0\xe3\x09\0\0\0\x78\x01\0\x10\0\0\0\xba\x01\0\0\
-\x0e\x0a\0\0\x05\x84\x01\0\x28\0\0\0\xba\x01\0\0\x78\x03\0\0\x0b\x90\x01\0\x40\
-\0\0\0\xba\x01\0\0\x3d\x0a\0\0\x15\x94\x01\0\x60\0\0\0\xba\x01\0\0\x7e\x0a\0\0\
-\x11\x98\x01\0\x68\0\0\0\xba\x01\0\0\x7e\x0a\0\0\x14\x98\x01\0\x70\0\0\0\xba\
-\x01\0\0\x7e\x0a\0\0\x09\x98\x01\0\x90\0\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\
-\x01\0\x98\0\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\xa0\0\0\0\xba\x01\0\0\
-\xa7\x0a\0\0\x11\xa4\x01\0\xb8\0\0\0\xba\x01\0\0\xd0\x0a\0\0\x14\xcc\x01\0\xe0\
-\0\0\0\xba\x01\0\0\x0f\x0b\0\0\x11\xd8\x01\0\xe8\0\0\0\xba\x01\0\0\x0f\x0b\0\0\
-\x14\xd8\x01\0\xf0\0\0\0\xba\x01\0\0\x0f\x0b\0\0\x09\xd8\x01\0\xf8\0\0\0\xba\
-\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\x08\x01\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\
-\x01\0\x18\x01\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x20\x01\0\0\xba\x01\0\
-\0\x37\x0b\0\0\x1a\xf0\x01\0\x28\x01\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\
-\x30\x01\0\0\xba\x01\0\0\x5b\x0b\0\0\x01\x10\x02\0\x40\x01\0\0\xba\x01\0\0\x5d\
-\x0b\0\0\x11\xb0\x01\0\x48\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x50\
-\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\x58\x01\0\0\xba\x01\0\0\xa7\x0a\
-\0\0\x11\xa4\x01\0\x60\x01\0\0\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\x01\0\x68\x01\0\
-\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x70\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\
-\x1f\xa4\x01\0\x78\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x80\x01\0\0\
-\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\x01\0\x88\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\
-\xa4\x01\0\x90\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\x98\x01\0\0\xba\
-\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\xa0\x01\0\0\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\
-\x01\0\xa8\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\xb0\x01\0\0\xba\x01\0\
-\0\xa7\x0a\0\0\x1f\xa4\x01\0\xb8\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\
-\xc0\x01\0\0\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\x01\0\xc8\x01\0\0\xba\x01\0\0\xa7\
-\x0a\0\0\x11\xa4\x01\0\xd0\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\xd8\
-\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\xe0\x01\0\0\xba\x01\0\0\x5d\x0b\
-\0\0\x11\xb0\x01\0\xe8\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\xf0\x01\0\
-\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\xf8\x01\0\0\xba\x01\0\0\xa7\x0a\0\0\
-\x11\xa4\x01\0\0\x02\0\0\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\x01\0\x08\x02\0\0\xba\
-\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x10\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\
-\x01\0\x18\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x20\x02\0\0\xba\x01\0\
-\0\x5d\x0b\0\0\x11\xb0\x01\0\x28\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\
-\x30\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\x38\x02\0\0\xba\x01\0\0\xa7\
-\x0a\0\0\x11\xa4\x01\0\x40\x02\0\0\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\x01\0\x48\
-\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x50\x02\0\0\xba\x01\0\0\xa7\x0a\
-\0\0\x1f\xa4\x01\0\x58\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x60\x02\0\
-\0\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\x01\0\x68\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\
-\x11\xa4\x01\0\x70\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\x78\x02\0\0\
-\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x80\x02\0\0\xba\x01\0\0\x5d\x0b\0\0\x11\
-\xb0\x01\0\x88\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x90\x02\0\0\xba\
-\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\x98\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\
-\x01\0\xa0\x02\0\0\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\x01\0\xa8\x02\0\0\xba\x01\0\
-\0\xa7\x0a\0\0\x11\xa4\x01\0\xb0\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\
-\xb8\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\xc0\x02\0\0\xba\x01\0\0\x5d\
-\x0b\0\0\x11\xb0\x01\0\xc8\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\xd0\
-\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x1f\xa4\x01\0\xd8\x02\0\0\xba\x01\0\0\xa7\x0a\
-\0\0\x11\xa4\x01\0\xe0\x02\0\0\xba\x01\0\0\x5d\x0b\0\0\x11\xb0\x01\0\xe8\x02\0\
-\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\xf0\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\
-\x1f\xa4\x01\0\xf8\x02\0\0\xba\x01\0\0\xa7\x0a\0\0\x11\xa4\x01\0\x20\x03\0\0\
-\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\x28\x03\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\
-\xf0\x01\0\x30\x03\0\0\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\x40\x03\0\0\xba\
-\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x50\x03\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\
-\x01\0\x58\x03\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x60\x03\0\0\xba\x01\0\
-\0\x37\x0b\0\0\x1a\xf0\x01\0\x70\x03\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\
-\x80\x03\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\x88\x03\0\0\xba\x01\0\0\x37\
-\x0b\0\0\x0d\xf0\x01\0\x90\x03\0\0\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\xa0\
-\x03\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\xb0\x03\0\0\xba\x01\0\0\x83\x0b\
-\0\0\x0d\xfc\x01\0\xb8\x03\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\xc0\x03\0\
-\0\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\xd0\x03\0\0\xba\x01\0\0\x37\x0b\0\0\
-\x0d\xf0\x01\0\xe0\x03\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\xe8\x03\0\0\
-\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\xf0\x03\0\0\xba\x01\0\0\x37\x0b\0\0\x1a\
-\xf0\x01\0\0\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x10\x04\0\0\xba\x01\
-\0\0\x83\x0b\0\0\x0d\xfc\x01\0\x18\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\
-\0\x20\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\x30\x04\0\0\xba\x01\0\0\
-\x37\x0b\0\0\x0d\xf0\x01\0\x40\x04\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\
-\x48\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x50\x04\0\0\xba\x01\0\0\x37\
-\x0b\0\0\x1a\xf0\x01\0\x60\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x70\
-\x04\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\x78\x04\0\0\xba\x01\0\0\x37\x0b\
-\0\0\x0d\xf0\x01\0\x80\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\x90\x04\0\
-\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\xa0\x04\0\0\xba\x01\0\0\x83\x0b\0\0\
-\x0d\xfc\x01\0\xa8\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\xb0\x04\0\0\
-\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\xc0\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\
-\xf0\x01\0\xd0\x04\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\xd8\x04\0\0\xba\
-\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\xe0\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\
-\x01\0\xf0\x04\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\0\x05\0\0\xba\x01\0\0\
-\x83\x0b\0\0\x0d\xfc\x01\0\x08\x05\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\
-\x10\x05\0\0\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\x20\x05\0\0\xba\x01\0\0\x37\
-\x0b\0\0\x0d\xf0\x01\0\x30\x05\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\x38\
-\x05\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x40\x05\0\0\xba\x01\0\0\x37\x0b\
-\0\0\x1a\xf0\x01\0\x50\x05\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x60\x05\0\
-\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\x68\x05\0\0\xba\x01\0\0\x37\x0b\0\0\
-\x0d\xf0\x01\0\x70\x05\0\0\xba\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\x80\x05\0\0\
-\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\x90\x05\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\
-\xfc\x01\0\x98\x05\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\x01\0\xa0\x05\0\0\xba\
-\x01\0\0\x37\x0b\0\0\x1a\xf0\x01\0\xb0\x05\0\0\xba\x01\0\0\x37\x0b\0\0\x0d\xf0\
-\x01\0\xc0\x05\0\0\xba\x01\0\0\x83\x0b\0\0\x0d\xfc\x01\0\x10\0\0\0\x99\x01\0\0\
-\x02\0\0\0\x08\0\0\0\x21\0\0\0\x41\x02\0\0\0\0\0\0\x10\0\0\0\x21\0\0\0\x46\x02\
-\0\0\0\0\0\0\xa4\x04\0\0\x01\0\0\0\x08\0\0\0\x21\0\0\0\xfa\x04\0\0\0\0\0\0\x8b\
-\x06\0\0\x01\0\0\0\x08\0\0\0\x21\0\0\0\x46\x02\0\0\0\0\0\0\x63\x08\0\0\x02\0\0\
-\0\x08\0\0\0\x21\0\0\0\x41\x02\0\0\0\0\0\0\x10\0\0\0\x21\0\0\0\x46\x02\0\0\0\0\
-\0\0\x49\x09\0\0\x01\0\0\0\x08\0\0\0\x21\0\0\0\xfa\x04\0\0\0\0\0\0\x0c\0\0\0\
-\xff\xff\xff\xff\x04\0\x08\0\x08\x7c\x0b\0\x14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x38\x02\0\0\0\0\0\0\x14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb0\x09\0\0\0\0\0\0\x14\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x50\x09\0\0\0\0\0\0\x14\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x10\0\0\0\0\0\0\0\x14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x60\x09\0\0\0\0\0\0\
-\x14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x88\x01\0\0\0\0\0\0\x14\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\xc8\x05\0\0\0\0\0\0\x06\x05\0\0\x05\0\x08\0\x69\0\0\0\x08\x01\x01\
-\xfb\x0e\x0d\0\x01\x01\x01\x01\0\0\0\x01\0\0\x01\x01\x01\x1f\x03\0\0\0\0\x30\0\
-\0\0\x34\0\0\0\x03\x01\x1f\x02\x0f\x05\x1e\x03\x45\0\0\0\0\x4e\x52\xff\x74\x73\
-\xb9\x69\x51\x5a\xc3\x5f\xba\xa1\xa6\xee\xf8\x5e\0\0\0\x01\x06\x98\xe7\x1b\x04\
-\x43\x82\x3b\x33\xe0\xb6\x5d\x8d\x55\x2a\x1c\x68\0\0\0\x02\xa5\xa8\xa4\xf9\x34\
-\xaa\x57\x11\xde\xc2\x3f\xec\x64\x5c\x40\x01\x04\0\0\x09\x02\0\0\0\0\0\0\0\0\
-\x03\x8c\x01\x01\x05\x05\x0a\x20\x05\x0a\x30\x05\x09\x06\x2e\x03\xf1\x7e\x20\
-\x05\x12\x06\x03\x92\x01\x20\x05\x13\x08\x24\x05\x11\x06\x20\x05\x0d\x06\x21\
-\x05\x28\x06\x20\x05\x0b\x20\x05\x0d\x06\x21\x05\x0b\x06\x20\x05\x12\x06\x03\
-\x7a\x20\x05\x05\x35\x06\x03\xe7\x7e\x2e\x06\x03\x9c\x01\x3c\x05\x0b\x4b\x05\
-\x05\x3d\x05\x12\x03\x74\x58\x05\x05\x03\x0e\x2e\x05\x0d\x3e\x05\x12\x3b\x06\
-\x03\xdf\x7e\x20\x05\x05\x06\x03\xa5\x01\x2e\x03\x68\x74\x02\x02\0\x01\x01\x04\
-\0\0\x09\x02\0\0\0\0\0\0\0\0\x03\xaf\x01\x01\x05\x05\x0a\x20\x05\x0a\x22\x05\
-\x09\x06\x2e\x05\x0b\x06\x23\x05\x12\x2f\x05\x13\x08\x23\x05\x11\x06\x20\x05\
-\x0d\x06\x21\x05\x28\x06\x20\x05\x0b\x20\x05\x0d\x06\x21\x05\x0b\x06\x20\x05\
-\x12\x06\x1b\x05\x05\x34\x06\x03\xc4\x7e\x2e\x05\x12\x06\x03\xbf\x01\x20\x05\
-\x10\x1f\x05\x0b\x24\x05\x12\x3d\x05\x0e\x3d\x06\x03\xbc\x7e\x2e\x05\x09\x06\
-\x03\xc6\x01\x2e\x06\x03\xba\x7e\x4a\x06\x03\xc7\x01\x2e\x59\x06\x03\xb8\x7e\
-\x02\xea\x01\x01\x06\x03\xc9\x01\x2e\x06\x03\xb7\x7e\x3c\x05\x05\x06\x03\xcd\
-\x01\x2e\x03\x63\x74\x02\x02\0\x01\x01\x04\0\0\x09\x02\0\0\0\0\0\0\0\0\x03\xd7\
-\x01\x01\x05\x05\x0a\x20\x05\x0a\x22\x05\x09\x06\x2e\x03\xa6\x7e\x20\x05\x12\
-\x06\x03\xdd\x01\x20\x05\x13\x08\x23\x05\x11\x06\x20\x05\x0d\x06\x21\x05\x28\
-\x06\x20\x05\x0b\x20\x05\x0d\x06\x21\x05\x0b\x06\x20\x05\x12\x06\x1b\x05\x05\
-\x34\x06\x03\x9d\x7e\x2e\x05\x12\x06\x03\xe6\x01\x20\x05\x10\x1f\x05\x12\x03\
-\x78\x20\x03\x0c\x2e\x05\x09\x4b\x21\x02\xee\x01\x14\x06\x03\x93\x7e\x4a\x05\
-\x05\x06\x03\xf1\x01\x2e\x03\x67\x74\x02\x02\0\x01\x01\x04\0\x05\x05\x0a\0\x09\
-\x02\0\0\0\0\0\0\0\0\x03\xfa\x01\x01\x02\x02\0\x01\x01\x04\0\0\x09\x02\0\0\0\0\
-\0\0\0\0\x03\x86\x02\x01\x05\x05\x0a\x20\x05\x0a\x30\x05\x09\x06\x2e\x03\xf7\
-\x7d\x20\x05\x12\x06\x03\x8c\x02\x20\x05\x13\x08\x23\x05\x11\x06\x20\x05\x0d\
-\x06\x21\x05\x28\x06\x20\x05\x0b\x20\x05\x0d\x06\x21\x05\x0b\x06\x20\x05\x12\
-\x06\x1b\x05\x05\x34\x05\x10\x30\x05\x12\x03\x78\x20\x05\x05\x03\x09\x2e\x06\
-\x03\xeb\x7d\x3c\x05\x12\x06\x03\x96\x02\x20\x03\x76\x20\x03\x0d\x2e\x05\x09\
-\x3d\x21\x06\x03\xe5\x7d\x02\xef\x01\x01\x05\x05\x06\x03\x9f\x02\x2e\x03\x68\
-\x74\x02\x02\0\x01\x01\x04\0\0\x09\x02\0\0\0\0\0\0\0\0\x03\xa9\x02\x01\x05\x05\
-\x0a\x20\x05\x0a\x22\x05\x09\x06\x2e\x03\xd4\x7d\x20\x05\x12\x06\x03\xaf\x02\
-\x20\x05\x13\x08\x23\x05\x11\x06\x20\x05\x0d\x06\x21\x05\x28\x06\x20\x05\x0b\
-\x20\x05\x0d\x06\x21\x05\x0b\x06\x20\x05\x12\x06\x1b\x05\x05\x34\x05\x13\x30\
-\x05\x12\x2f\x06\x03\xc8\x7d\x20\x05\x05\x06\x03\xbb\x02\x2e\x03\x6f\x74\x02\
-\x02\0\x01\x01\x04\0\0\x09\x02\0\0\0\0\0\0\0\0\x03\xde\0\x01\x05\x05\x0a\x30\
-\x06\x03\x9f\x7f\x2e\x05\x0b\x06\x03\xe4\0\x20\x05\x15\x3d\x05\x11\x4b\x05\x14\
-\x06\x20\x05\x09\x20\x03\x9a\x7f\x20\x03\xe6\0\x20\x05\x11\x06\x31\x05\x1f\x06\
-\x20\x05\x11\x20\x03\x97\x7f\x20\x05\x14\x06\x03\xf3\0\x2e\x06\x03\x8d\x7f\x4a\
-\x05\x11\x06\x03\xf6\0\x20\x05\x14\x06\x20\x05\x09\x20\x05\x1a\x06\x26\x05\x0d\
-\x06\x2e\x2e\x05\x1a\x20\x05\x0d\x20\x05\x01\x06\x28\x06\x03\xfc\x7e\x20\x05\
-\x11\x06\x03\xec\0\x20\x1d\x05\x1f\x06\x20\x05\x11\x20\x06\x23\x1d\x05\x1f\x06\
-\x20\x05\x11\x20\x06\x23\x1d\x05\x1f\x06\x20\x05\x11\x20\x06\x23\x1d\x05\x1f\
-\x06\x20\x05\x11\x20\x06\x23\x1d\x05\x1f\x06\x20\x05\x11\x20\x06\x23\x1d\x05\
-\x1f\x06\x20\x05\x11\x20\x06\x23\x1d\x05\x1f\x06\x20\x05\x11\x20\x06\x23\x1d\
-\x05\x1f\x06\x20\x05\x11\x20\x06\x23\x1d\x05\x1f\x06\x20\x05\x11\x20\x06\x23\
-\x1d\x05\x1f\x06\x20\x05\x11\x20\x06\x23\x1d\x05\x1f\x06\x20\x05\x11\x20\x06\
-\x23\x1d\x05\x1f\x06\x20\x05\x11\x20\x06\x23\x1d\x05\x1f\x06\x20\x05\x11\x20\
-\x06\x23\x1d\x05\x1f\x06\x20\x05\x11\x20\x03\x97\x7f\x4a\x05\x0d\x06\x03\xff\0\
-\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\0\x20\x1d\x05\
-\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\0\x20\x1d\x05\x1a\x06\x20\
-\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\0\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\
-\x03\x84\x7f\x20\x06\x03\xff\0\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\
-\x20\x06\x03\xff\0\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\
-\xff\0\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\0\x20\
-\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\0\x20\x1d\x05\x1a\
-\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\0\x20\x1d\x05\x1a\x06\x20\x05\
-\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\0\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\
-\x84\x7f\x20\x06\x03\xff\0\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\
-\x06\x03\xff\0\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\
-\0\x20\x1d\x05\x1a\x06\x20\x05\x0d\x2e\x03\x84\x7f\x20\x06\x03\xff\0\x20\x02\
-\x01\0\x01\x01\x2f\x68\x6f\x6d\x65\x2f\x59\x75\x61\x6e\x6d\x78\x63\x2f\x43\x6f\
-\x75\x72\x73\x65\x2f\x47\x72\x61\x64\x50\x72\x6f\x6a\x65\x63\x74\x2f\x64\x79\
-\x6e\x6c\x69\x62\x5f\x6d\x6f\x6e\x69\x74\x6f\x72\0\x73\x72\x63\0\x2f\x75\x73\
-\x72\x2f\x69\x6e\x63\x6c\x75\x64\x65\x2f\x62\x70\x66\0\x73\x72\x63\x2f\x64\x79\
-\x6e\x6c\x69\x62\x5f\x6d\x6f\x6e\x69\x74\x6f\x72\x2e\x62\x70\x66\x2e\x63\0\x76\
-\x6d\x6c\x69\x6e\x75\x78\x2e\x68\0\x62\x70\x66\x5f\x68\x65\x6c\x70\x65\x72\x5f\
-\x64\x65\x66\x73\x2e\x68\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\x54\x02\0\0\x04\0\xf1\xff\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\
-\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x04\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\x97\0\0\0\x02\0\x02\0\0\0\0\0\0\0\0\0\xc8\x05\0\0\0\0\0\0\0\0\0\0\
-\x03\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x08\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x0a\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x03\0\x0b\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x0d\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x03\0\x12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x15\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x03\0\x18\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x19\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x1f\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x03\0\x21\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x23\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\xfa\0\0\0\x12\0\x04\0\0\0\0\0\0\0\0\0\x38\x02\0\0\0\0\0\0\
-\xab\x01\0\0\x11\0\x10\0\x40\0\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\x79\0\0\0\x11\0\
-\x10\0\x20\0\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\x26\0\0\0\x12\0\x06\0\0\0\0\0\0\0\0\
-\0\xb0\x09\0\0\0\0\0\0\xb5\x01\0\0\x11\0\x10\0\0\0\0\0\0\0\0\0\x20\0\0\0\0\0\0\
-\0\xd2\x01\0\0\x12\0\x08\0\0\0\0\0\0\0\0\0\x50\x09\0\0\0\0\0\0\x47\0\0\0\x12\0\
-\x0a\0\0\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x54\x01\0\0\x12\0\x0b\0\0\0\0\0\0\0\0\
-\0\x60\x09\0\0\0\0\0\0\x37\0\0\0\x12\0\x0d\0\0\0\0\0\0\0\0\0\x88\x01\0\0\0\0\0\
-\0\xa9\0\0\0\x11\0\x10\0\x80\0\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\x9a\0\0\0\x11\0\
-\x10\0\x60\0\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\x82\x02\0\0\x11\0\x0f\0\0\0\0\0\0\0\
-\0\0\x04\0\0\0\0\0\0\0\x40\0\0\0\0\0\0\0\x01\0\0\0\x1c\0\0\0\xb8\0\0\0\0\0\0\0\
-\x01\0\0\0\x1d\0\0\0\x18\0\0\0\0\0\0\0\x0a\0\0\0\x02\0\0\0\x70\x01\0\0\0\0\0\0\
-\x01\0\0\0\x14\0\0\0\xf8\x01\0\0\0\0\0\0\x01\0\0\0\x15\0\0\0\x10\0\0\0\0\0\0\0\
-\x0a\0\0\0\x02\0\0\0\x50\x01\0\0\0\0\0\0\x01\0\0\0\x14\0\0\0\xb8\x01\0\0\0\0\0\
-\0\x01\0\0\0\x17\0\0\0\x40\x09\0\0\0\0\0\0\x01\0\0\0\x14\0\0\0\x70\x09\0\0\0\0\
-\0\0\x01\0\0\0\x15\0\0\0\x10\0\0\0\0\0\0\0\x0a\0\0\0\x02\0\0\0\x40\x01\0\0\0\0\
-\0\0\x01\0\0\0\x17\0\0\0\xd8\x08\0\0\0\0\0\0\x01\0\0\0\x17\0\0\0\x10\x09\0\0\0\
-\0\0\0\x01\0\0\0\x15\0\0\0\x18\0\0\0\0\0\0\0\x0a\0\0\0\x02\0\0\0\x70\x01\0\0\0\
-\0\0\0\x01\0\0\0\x17\0\0\0\x20\x09\0\0\0\0\0\0\x01\0\0\0\x15\0\0\0\x10\0\0\0\0\
-\0\0\0\x0a\0\0\0\x02\0\0\0\x48\x01\0\0\0\0\0\0\x01\0\0\0\x15\0\0\0\x08\0\0\0\0\
-\0\0\0\x03\0\0\0\x0b\0\0\0\x11\0\0\0\0\0\0\0\x03\0\0\0\x0d\0\0\0\x15\0\0\0\0\0\
-\0\0\x03\0\0\0\x11\0\0\0\x23\0\0\0\0\0\0\0\x03\0\0\0\x0f\0\0\0\x27\0\0\0\0\0\0\
-\0\x03\0\0\0\x0c\0\0\0\x2b\0\0\0\0\0\0\0\x03\0\0\0\x0a\0\0\0\x08\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x0c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x10\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x14\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x18\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x1c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x20\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x24\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x28\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x2c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x30\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x34\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x38\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x3c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x40\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x44\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x48\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x4c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x50\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x54\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x58\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x5c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x60\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x64\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x68\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x6c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x70\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x74\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x78\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x7c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x80\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x84\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x88\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x8c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x90\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x94\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x98\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x9c\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xa0\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xa4\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xa8\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xac\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xb0\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xb4\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xb8\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xbc\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xc0\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xc4\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xc8\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xcc\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xd0\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xd4\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xd8\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xdc\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xe0\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xe4\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xe8\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xec\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xf0\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xf4\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xf8\0\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\xfc\0\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\0\x01\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x04\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x08\x01\0\0\0\0\0\
-\0\x03\0\0\0\x0e\0\0\0\x0c\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x10\x01\0\0\0\0\
-\0\0\x03\0\0\0\x0e\0\0\0\x14\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x18\x01\0\0\0\
-\0\0\0\x03\0\0\0\x0e\0\0\0\x1c\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x20\x01\0\0\
-\0\0\0\0\x03\0\0\0\x0e\0\0\0\x24\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x28\x01\0\
-\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x2c\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x30\x01\
-\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x34\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x38\
-\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x3c\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\
-\x40\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x44\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\
-\0\x48\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x4c\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\
-\0\0\x50\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x54\x01\0\0\0\0\0\0\x03\0\0\0\x0e\
-\0\0\0\x58\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x5c\x01\0\0\0\0\0\0\x03\0\0\0\
-\x0e\0\0\0\x60\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x64\x01\0\0\0\0\0\0\x03\0\0\
-\0\x0e\0\0\0\x68\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x6c\x01\0\0\0\0\0\0\x03\0\
-\0\0\x0e\0\0\0\x70\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x74\x01\0\0\0\0\0\0\x03\
-\0\0\0\x0e\0\0\0\x78\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x7c\x01\0\0\0\0\0\0\
-\x03\0\0\0\x0e\0\0\0\x80\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x84\x01\0\0\0\0\0\
-\0\x03\0\0\0\x0e\0\0\0\x88\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x8c\x01\0\0\0\0\
-\0\0\x03\0\0\0\x0e\0\0\0\x90\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x94\x01\0\0\0\
-\0\0\0\x03\0\0\0\x0e\0\0\0\x98\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\x9c\x01\0\0\
-\0\0\0\0\x03\0\0\0\x0e\0\0\0\xa0\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xa4\x01\0\
-\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xa8\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xac\x01\
-\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xb0\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xb4\
-\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xb8\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\
-\xbc\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xc0\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\
-\0\xc4\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xc8\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\
-\0\0\xcc\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xd0\x01\0\0\0\0\0\0\x03\0\0\0\x0e\
-\0\0\0\xd4\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xd8\x01\0\0\0\0\0\0\x03\0\0\0\
-\x0e\0\0\0\xdc\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xe0\x01\0\0\0\0\0\0\x03\0\0\
-\0\x0e\0\0\0\xe4\x01\0\0\0\0\0\0\x03\0\0\0\x0e\0\0\0\xe8\x01\0\0\0\0\0\0\x03\0\
-\0\0\x0e\0\0\0\x08\0\0\0\0\0\0\0\x02\0\0\0\x1e\0\0\0\x10\0\0\0\0\0\0\0\x02\0\0\
-\0\x17\0\0\0\x18\0\0\0\0\0\0\0\x02\0\0\0\x15\0\0\0\x20\0\0\0\0\0\0\0\x02\0\0\0\
-\x14\0\0\0\x28\0\0\0\0\0\0\0\x02\0\0\0\x1d\0\0\0\x30\0\0\0\0\0\0\0\x02\0\0\0\
-\x1c\0\0\0\x38\0\0\0\0\0\0\0\x02\0\0\0\x03\0\0\0\x40\0\0\0\0\0\0\0\x02\0\0\0\
-\x03\0\0\0\x48\0\0\0\0\0\0\0\x02\0\0\0\x03\0\0\0\x50\0\0\0\0\0\0\0\x02\0\0\0\
-\x05\0\0\0\x58\0\0\0\0\0\0\0\x02\0\0\0\x05\0\0\0\x60\0\0\0\0\0\0\0\x02\0\0\0\
-\x05\0\0\0\x68\0\0\0\0\0\0\0\x02\0\0\0\x06\0\0\0\x70\0\0\0\0\0\0\0\x02\0\0\0\
-\x06\0\0\0\x78\0\0\0\0\0\0\0\x02\0\0\0\x06\0\0\0\x80\0\0\0\0\0\0\0\x02\0\0\0\
-\x07\0\0\0\x88\0\0\0\0\0\0\0\x02\0\0\0\x08\0\0\0\x90\0\0\0\0\0\0\0\x02\0\0\0\
-\x08\0\0\0\x98\0\0\0\0\0\0\0\x02\0\0\0\x08\0\0\0\xa0\0\0\0\0\0\0\0\x02\0\0\0\
-\x09\0\0\0\xa8\0\0\0\0\0\0\0\x02\0\0\0\x09\0\0\0\xb0\0\0\0\0\0\0\0\x02\0\0\0\
-\x09\0\0\0\xb8\0\0\0\0\0\0\0\x02\0\0\0\x02\0\0\0\x84\x06\0\0\0\0\0\0\x04\0\0\0\
-\x17\0\0\0\x90\x06\0\0\0\0\0\0\x04\0\0\0\x15\0\0\0\x9c\x06\0\0\0\0\0\0\x04\0\0\
-\0\x14\0\0\0\xa8\x06\0\0\0\0\0\0\x04\0\0\0\x1d\0\0\0\xb4\x06\0\0\0\0\0\0\x04\0\
-\0\0\x1c\0\0\0\xcc\x06\0\0\0\0\0\0\x04\0\0\0\x1e\0\0\0\x2c\0\0\0\0\0\0\0\x04\0\
-\0\0\x03\0\0\0\x3c\0\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x4c\0\0\0\0\0\0\0\x04\0\0\
-\0\x06\0\0\0\x5c\0\0\0\0\0\0\0\x04\0\0\0\x07\0\0\0\x6c\0\0\0\0\0\0\0\x04\0\0\0\
-\x08\0\0\0\x7c\0\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\x8c\0\0\0\0\0\0\0\x04\0\0\0\
-\x02\0\0\0\xa0\0\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xb0\0\0\0\0\0\0\0\x04\0\0\0\
-\x03\0\0\0\xc0\0\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xd0\0\0\0\0\0\0\0\x04\0\0\0\
-\x03\0\0\0\xe0\0\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xf0\0\0\0\0\0\0\0\x04\0\0\0\
-\x03\0\0\0\0\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x10\x01\0\0\0\0\0\0\x04\0\0\0\
-\x03\0\0\0\x20\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x30\x01\0\0\0\0\0\0\x04\0\0\
-\0\x03\0\0\0\x40\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x50\x01\0\0\0\0\0\0\x04\0\
-\0\0\x03\0\0\0\x60\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x70\x01\0\0\0\0\0\0\x04\
-\0\0\0\x03\0\0\0\x80\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x90\x01\0\0\0\0\0\0\
-\x04\0\0\0\x03\0\0\0\xa0\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xb0\x01\0\0\0\0\0\
-\0\x04\0\0\0\x03\0\0\0\xc0\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xd0\x01\0\0\0\0\
-\0\0\x04\0\0\0\x03\0\0\0\xe0\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xf0\x01\0\0\0\
-\0\0\0\x04\0\0\0\x03\0\0\0\0\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x18\x02\0\0\0\
-\0\0\0\x04\0\0\0\x05\0\0\0\x28\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x38\x02\0\0\
-\0\0\0\0\x04\0\0\0\x05\0\0\0\x48\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x58\x02\0\
-\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x68\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x78\x02\
-\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x88\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x98\
-\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xa8\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\
-\xb8\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xc8\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\
-\0\xd8\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xe8\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\
-\0\0\xf8\x02\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x08\x03\0\0\0\0\0\0\x04\0\0\0\x05\
-\0\0\0\x18\x03\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x28\x03\0\0\0\0\0\0\x04\0\0\0\
-\x05\0\0\0\x38\x03\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x48\x03\0\0\0\0\0\0\x04\0\0\
-\0\x05\0\0\0\x58\x03\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x68\x03\0\0\0\0\0\0\x04\0\
-\0\0\x05\0\0\0\x78\x03\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x88\x03\0\0\0\0\0\0\x04\
-\0\0\0\x05\0\0\0\x98\x03\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xa8\x03\0\0\0\0\0\0\
-\x04\0\0\0\x05\0\0\0\xc0\x03\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\xd0\x03\0\0\0\0\0\
-\0\x04\0\0\0\x06\0\0\0\xe0\x03\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\xf0\x03\0\0\0\0\
-\0\0\x04\0\0\0\x06\0\0\0\0\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\x10\x04\0\0\0\0\
-\0\0\x04\0\0\0\x06\0\0\0\x20\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\x30\x04\0\0\0\
-\0\0\0\x04\0\0\0\x06\0\0\0\x40\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\x50\x04\0\0\
-\0\0\0\0\x04\0\0\0\x06\0\0\0\x60\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\x70\x04\0\
-\0\0\0\0\0\x04\0\0\0\x06\0\0\0\x80\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\x90\x04\
-\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\xa0\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\xb0\
-\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\xc0\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\
-\xd0\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\xe0\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\
-\0\xf0\x04\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\0\x05\0\0\0\0\0\0\x04\0\0\0\x06\0\0\
-\0\x10\x05\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\x20\x05\0\0\0\0\0\0\x04\0\0\0\x06\0\
-\0\0\x38\x05\0\0\0\0\0\0\x04\0\0\0\x07\0\0\0\x50\x05\0\0\0\0\0\0\x04\0\0\0\x08\
-\0\0\0\x60\x05\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\x70\x05\0\0\0\0\0\0\x04\0\0\0\
-\x08\0\0\0\x80\x05\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\x90\x05\0\0\0\0\0\0\x04\0\0\
-\0\x08\0\0\0\xa0\x05\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\xb0\x05\0\0\0\0\0\0\x04\0\
-\0\0\x08\0\0\0\xc0\x05\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\xd0\x05\0\0\0\0\0\0\x04\
-\0\0\0\x08\0\0\0\xe0\x05\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\xf0\x05\0\0\0\0\0\0\
-\x04\0\0\0\x08\0\0\0\0\x06\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\x10\x06\0\0\0\0\0\0\
-\x04\0\0\0\x08\0\0\0\x20\x06\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\x30\x06\0\0\0\0\0\
-\0\x04\0\0\0\x08\0\0\0\x40\x06\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\x50\x06\0\0\0\0\
-\0\0\x04\0\0\0\x08\0\0\0\x60\x06\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\x70\x06\0\0\0\
-\0\0\0\x04\0\0\0\x08\0\0\0\x80\x06\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\x90\x06\0\0\
-\0\0\0\0\x04\0\0\0\x08\0\0\0\xa0\x06\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\xb0\x06\0\
-\0\0\0\0\0\x04\0\0\0\x08\0\0\0\xc0\x06\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\xd8\x06\
-\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\xe8\x06\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\xf8\
-\x06\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\x08\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\
-\x18\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\x28\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\
-\0\x38\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\x48\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\
-\0\0\x58\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\x68\x07\0\0\0\0\0\0\x04\0\0\0\x09\
-\0\0\0\x78\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\x88\x07\0\0\0\0\0\0\x04\0\0\0\
-\x09\0\0\0\x98\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\xa8\x07\0\0\0\0\0\0\x04\0\0\
-\0\x09\0\0\0\xb8\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\xc8\x07\0\0\0\0\0\0\x04\0\
-\0\0\x09\0\0\0\xd8\x07\0\0\0\0\0\0\x04\0\0\0\x09\0\0\0\xe8\x07\0\0\0\0\0\0\x04\
-\0\0\0\x09\0\0\0\0\x08\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x10\x08\0\0\0\0\0\0\x04\
-\0\0\0\x02\0\0\0\x20\x08\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x30\x08\0\0\0\0\0\0\
-\x04\0\0\0\x02\0\0\0\x40\x08\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x50\x08\0\0\0\0\0\
-\0\x04\0\0\0\x02\0\0\0\x60\x08\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x70\x08\0\0\0\0\
-\0\0\x04\0\0\0\x02\0\0\0\x80\x08\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x90\x08\0\0\0\
-\0\0\0\x04\0\0\0\x02\0\0\0\xa0\x08\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xb0\x08\0\0\
-\0\0\0\0\x04\0\0\0\x02\0\0\0\xc0\x08\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xd0\x08\0\
-\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xe0\x08\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xf0\x08\
-\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\0\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x10\x09\
-\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x20\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x30\
-\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x40\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\
-\x50\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x60\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\
-\0\x70\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x80\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\
-\0\0\x90\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xa0\x09\0\0\0\0\0\0\x04\0\0\0\x02\
-\0\0\0\xb0\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xc0\x09\0\0\0\0\0\0\x04\0\0\0\
-\x02\0\0\0\xd0\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xe0\x09\0\0\0\0\0\0\x04\0\0\
-\0\x02\0\0\0\xf0\x09\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\0\x0a\0\0\0\0\0\0\x04\0\0\
-\0\x02\0\0\0\x10\x0a\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x20\x0a\0\0\0\0\0\0\x04\0\
-\0\0\x02\0\0\0\x30\x0a\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x40\x0a\0\0\0\0\0\0\x04\
-\0\0\0\x02\0\0\0\x50\x0a\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x60\x0a\0\0\0\0\0\0\
-\x04\0\0\0\x02\0\0\0\x70\x0a\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x80\x0a\0\0\0\0\0\
-\0\x04\0\0\0\x02\0\0\0\x90\x0a\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xa0\x0a\0\0\0\0\
-\0\0\x04\0\0\0\x02\0\0\0\xb0\x0a\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xc0\x0a\0\0\0\
-\0\0\0\x04\0\0\0\x02\0\0\0\xd0\x0a\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xe0\x0a\0\0\
-\0\0\0\0\x04\0\0\0\x02\0\0\0\xf0\x0a\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\0\x0b\0\0\
-\0\0\0\0\x04\0\0\0\x02\0\0\0\x10\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x20\x0b\0\
-\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x30\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x40\x0b\
-\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x50\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x60\
-\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x70\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\
-\x80\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x90\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\
-\0\xa0\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xb0\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\
-\0\0\xc0\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xd0\x0b\0\0\0\0\0\0\x04\0\0\0\x02\
-\0\0\0\xe0\x0b\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xf0\x0b\0\0\0\0\0\0\x04\0\0\0\
-\x02\0\0\0\0\x0c\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x10\x0c\0\0\0\0\0\0\x04\0\0\0\
-\x02\0\0\0\x20\x0c\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x30\x0c\0\0\0\0\0\0\x04\0\0\
-\0\x02\0\0\0\x40\x0c\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x50\x0c\0\0\0\0\0\0\x04\0\
-\0\0\x02\0\0\0\x60\x0c\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x70\x0c\0\0\0\0\0\0\x04\
-\0\0\0\x02\0\0\0\x80\x0c\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x90\x0c\0\0\0\0\0\0\
-\x04\0\0\0\x02\0\0\0\xa0\x0c\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xb0\x0c\0\0\0\0\0\
-\0\x04\0\0\0\x02\0\0\0\xc0\x0c\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xd0\x0c\0\0\0\0\
-\0\0\x04\0\0\0\x02\0\0\0\xe0\x0c\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xf0\x0c\0\0\0\
-\0\0\0\x04\0\0\0\x02\0\0\0\0\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x10\x0d\0\0\0\
-\0\0\0\x04\0\0\0\x02\0\0\0\x20\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x30\x0d\0\0\
-\0\0\0\0\x04\0\0\0\x02\0\0\0\x40\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x50\x0d\0\
-\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x60\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x70\x0d\
-\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x80\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x90\
-\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xa0\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\
-\xb0\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xc0\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\
-\0\xd0\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xe0\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\
-\0\0\xf0\x0d\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\0\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\
-\0\0\x10\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x20\x0e\0\0\0\0\0\0\x04\0\0\0\x02\
-\0\0\0\x30\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x40\x0e\0\0\0\0\0\0\x04\0\0\0\
-\x02\0\0\0\x50\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x60\x0e\0\0\0\0\0\0\x04\0\0\
-\0\x02\0\0\0\x70\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x80\x0e\0\0\0\0\0\0\x04\0\
-\0\0\x02\0\0\0\x90\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xa0\x0e\0\0\0\0\0\0\x04\
-\0\0\0\x02\0\0\0\xb0\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xc0\x0e\0\0\0\0\0\0\
-\x04\0\0\0\x02\0\0\0\xd0\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xe0\x0e\0\0\0\0\0\
-\0\x04\0\0\0\x02\0\0\0\xf0\x0e\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\0\x0f\0\0\0\0\0\
-\0\x04\0\0\0\x02\0\0\0\x10\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x20\x0f\0\0\0\0\
-\0\0\x04\0\0\0\x02\0\0\0\x30\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x40\x0f\0\0\0\
-\0\0\0\x04\0\0\0\x02\0\0\0\x50\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x60\x0f\0\0\
-\0\0\0\0\x04\0\0\0\x02\0\0\0\x70\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x80\x0f\0\
-\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x90\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xa0\x0f\
-\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xb0\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xc0\
-\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xd0\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\
-\xe0\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\xf0\x0f\0\0\0\0\0\0\x04\0\0\0\x02\0\0\
-\0\0\x10\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x10\x10\0\0\0\0\0\0\x04\0\0\0\x02\0\0\
-\0\x20\x10\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x30\x10\0\0\0\0\0\0\x04\0\0\0\x02\0\
-\0\0\x40\x10\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x5c\x10\0\0\0\0\0\0\x04\0\0\0\x03\
-\0\0\0\x6c\x10\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x84\x10\0\0\0\0\0\0\x04\0\0\0\
-\x05\0\0\0\x9c\x10\0\0\0\0\0\0\x04\0\0\0\x06\0\0\0\xb4\x10\0\0\0\0\0\0\x04\0\0\
-\0\x08\0\0\0\xc4\x10\0\0\0\0\0\0\x04\0\0\0\x08\0\0\0\xdc\x10\0\0\0\0\0\0\x04\0\
-\0\0\x09\0\0\0\x14\0\0\0\0\0\0\0\x03\0\0\0\x10\0\0\0\x18\0\0\0\0\0\0\0\x02\0\0\
-\0\x03\0\0\0\x2c\0\0\0\0\0\0\0\x03\0\0\0\x10\0\0\0\x30\0\0\0\0\0\0\0\x02\0\0\0\
-\x05\0\0\0\x44\0\0\0\0\0\0\0\x03\0\0\0\x10\0\0\0\x48\0\0\0\0\0\0\0\x02\0\0\0\
-\x06\0\0\0\x5c\0\0\0\0\0\0\0\x03\0\0\0\x10\0\0\0\x60\0\0\0\0\0\0\0\x02\0\0\0\
-\x07\0\0\0\x74\0\0\0\0\0\0\0\x03\0\0\0\x10\0\0\0\x78\0\0\0\0\0\0\0\x02\0\0\0\
-\x08\0\0\0\x8c\0\0\0\0\0\0\0\x03\0\0\0\x10\0\0\0\x90\0\0\0\0\0\0\0\x02\0\0\0\
-\x09\0\0\0\xa4\0\0\0\0\0\0\0\x03\0\0\0\x10\0\0\0\xa8\0\0\0\0\0\0\0\x02\0\0\0\
-\x02\0\0\0\x22\0\0\0\0\0\0\0\x03\0\0\0\x12\0\0\0\x26\0\0\0\0\0\0\0\x03\0\0\0\
-\x12\0\0\0\x2a\0\0\0\0\0\0\0\x03\0\0\0\x12\0\0\0\x36\0\0\0\0\0\0\0\x03\0\0\0\
-\x12\0\0\0\x4b\0\0\0\0\0\0\0\x03\0\0\0\x12\0\0\0\x60\0\0\0\0\0\0\0\x03\0\0\0\
-\x12\0\0\0\x7a\0\0\0\0\0\0\0\x02\0\0\0\x03\0\0\0\xf9\0\0\0\0\0\0\0\x02\0\0\0\
-\x05\0\0\0\x8e\x01\0\0\0\0\0\0\x02\0\0\0\x06\0\0\0\x0d\x02\0\0\0\0\0\0\x02\0\0\
-\0\x07\0\0\0\x23\x02\0\0\0\0\0\0\x02\0\0\0\x08\0\0\0\xa6\x02\0\0\0\0\0\0\x02\0\
-\0\0\x09\0\0\0\x09\x03\0\0\0\0\0\0\x02\0\0\0\x02\0\0\0\x13\x16\x18\x19\x1a\x1b\
-\x1e\x17\x15\x14\x1d\x1c\0\x2e\x64\x65\x62\x75\x67\x5f\x61\x62\x62\x72\x65\x76\
-\0\x2e\x72\x65\x6c\x2e\x74\x65\x78\x74\0\x2e\x72\x65\x6c\x2e\x42\x54\x46\x2e\
-\x65\x78\x74\0\x74\x72\x61\x63\x65\x5f\x64\x6c\x6f\x70\x65\x6e\x5f\x72\x65\x74\
-\0\x74\x72\x61\x63\x65\x5f\x64\x6c\x73\x79\x6d\x5f\x72\x65\x74\0\x74\x72\x61\
-\x63\x65\x5f\x64\x6c\x63\x6c\x6f\x73\x65\x5f\x72\x65\x74\0\x2e\x64\x65\x62\x75\
-\x67\x5f\x72\x6e\x67\x6c\x69\x73\x74\x73\0\x2e\x64\x65\x62\x75\x67\x5f\x6c\x6f\
-\x63\x6c\x69\x73\x74\x73\0\x65\x76\x65\x6e\x74\x73\0\x2e\x72\x65\x6c\x2e\x64\
-\x65\x62\x75\x67\x5f\x73\x74\x72\x5f\x6f\x66\x66\x73\x65\x74\x73\0\x69\x73\x5f\
-\x74\x61\x72\x67\x65\x74\x5f\x70\x72\x6f\x63\x65\x73\x73\0\x6d\x6f\x6e\x69\x74\
-\x6f\x72\x5f\x70\x72\x6f\x63\x65\x73\x73\0\x2e\x6d\x61\x70\x73\0\x2e\x64\x65\
-\x62\x75\x67\x5f\x73\x74\x72\0\x2e\x64\x65\x62\x75\x67\x5f\x6c\x69\x6e\x65\x5f\
-\x73\x74\x72\0\x2e\x72\x65\x6c\x2e\x64\x65\x62\x75\x67\x5f\x61\x64\x64\x72\0\
-\x2e\x72\x65\x6c\x2e\x64\x65\x62\x75\x67\x5f\x69\x6e\x66\x6f\0\x74\x72\x61\x63\
-\x65\x5f\x64\x6c\x6f\x70\x65\x6e\0\x2e\x72\x65\x6c\x75\x70\x72\x6f\x62\x65\x2f\
-\x2f\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\x36\x3a\
-\x64\x6c\x6f\x70\x65\x6e\0\x2e\x72\x65\x6c\x75\x72\x65\x74\x70\x72\x6f\x62\x65\
-\x2f\x2f\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\x36\
-\x3a\x64\x6c\x6f\x70\x65\x6e\0\x74\x72\x61\x63\x65\x5f\x64\x6c\x73\x79\x6d\0\
-\x2e\x72\x65\x6c\x75\x70\x72\x6f\x62\x65\x2f\x2f\x75\x73\x72\x2f\x6c\x69\x62\
-\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\x36\x3a\x64\x6c\x73\x79\x6d\0\x2e\x72\x65\
-\x6c\x75\x72\x65\x74\x70\x72\x6f\x62\x65\x2f\x2f\x75\x73\x72\x2f\x6c\x69\x62\
-\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\x36\x3a\x64\x6c\x73\x79\x6d\0\x74\x65\x6d\
-\x70\x5f\x70\x61\x74\x68\0\x68\x61\x6e\x64\x6c\x65\x5f\x74\x6f\x5f\x70\x61\x74\
-\x68\0\x2e\x6c\x6c\x76\x6d\x5f\x61\x64\x64\x72\x73\x69\x67\0\x74\x72\x61\x63\
-\x65\x5f\x64\x6c\x63\x6c\x6f\x73\x65\0\x2e\x72\x65\x6c\x75\x70\x72\x6f\x62\x65\
-\x2f\x2f\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\x36\
-\x3a\x64\x6c\x63\x6c\x6f\x73\x65\0\x75\x72\x65\x74\x70\x72\x6f\x62\x65\x2f\x2f\
-\x75\x73\x72\x2f\x6c\x69\x62\x2f\x6c\x69\x62\x63\x2e\x73\x6f\x2e\x36\x3a\x64\
-\x6c\x63\x6c\x6f\x73\x65\0\x6c\x69\x63\x65\x6e\x73\x65\0\x2e\x72\x65\x6c\x2e\
-\x64\x65\x62\x75\x67\x5f\x6c\x69\x6e\x65\0\x2e\x72\x65\x6c\x2e\x64\x65\x62\x75\
-\x67\x5f\x66\x72\x61\x6d\x65\0\x64\x79\x6e\x6c\x69\x62\x5f\x6d\x6f\x6e\x69\x74\
-\x6f\x72\x2e\x62\x70\x66\x2e\x63\0\x2e\x73\x74\x72\x74\x61\x62\0\x2e\x73\x79\
-\x6d\x74\x61\x62\0\x2e\x72\x65\x6c\x2e\x42\x54\x46\0\x4c\x49\x43\x45\x4e\x53\
-\x45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x69\x02\0\0\x03\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x84\x8a\0\0\0\0\0\0\x8a\x02\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x13\0\0\0\x01\0\0\0\x06\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\0\0\xc8\x05\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x0f\0\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\x78\x6d\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\x25\0\0\0\x02\0\0\0\x08\0\0\0\
-\0\0\0\0\x10\0\0\0\0\0\0\0\x0b\x01\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\x08\x06\0\0\0\0\0\0\x38\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\x07\x01\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x98\
-\x6d\0\0\0\0\0\0\x30\0\0\0\0\0\0\0\x25\0\0\0\x04\0\0\0\x08\0\0\0\0\0\0\0\x10\0\
-\0\0\0\0\0\0\x30\x01\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x40\x08\0\
-\0\0\0\0\0\xb0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x2c\x01\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xc8\x6d\0\0\0\0\0\0\
-\x50\0\0\0\0\0\0\0\x25\0\0\0\x06\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\xe4\
-\x01\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xf0\x11\0\0\0\0\0\0\x50\
-\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xe0\x01\0\0\
-\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x18\x6e\0\0\0\0\0\0\x40\0\0\0\0\0\
-\0\0\x25\0\0\0\x08\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x06\x02\0\0\x01\0\
-\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x40\x1b\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x64\x01\0\0\x01\0\0\0\x06\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x50\x1b\0\0\0\0\0\0\x60\x09\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x60\x01\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\x58\x6e\0\0\0\0\0\0\x30\0\0\0\0\0\0\0\x25\0\0\0\x0b\0\0\0\x08\
-\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x88\x01\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\xb0\x24\0\0\0\0\0\0\x88\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x84\x01\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x88\x6e\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\x25\0\0\0\x0d\0\0\0\x08\0\0\0\0\0\0\0\
-\x10\0\0\0\0\0\0\0\x2b\x02\0\0\x01\0\0\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x38\
-\x26\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\xb9\0\0\0\x01\0\0\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x40\x26\0\0\0\0\0\
-\0\xa0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x69\0\0\
-\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xe0\x26\0\0\0\0\0\0\xf4\x06\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\x01\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xd4\x2d\0\0\0\0\0\0\x7e\x02\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xee\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\x52\x30\0\0\0\0\0\0\xc1\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xea\0\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\xa8\x6e\0\0\0\0\0\0\x60\0\0\0\0\0\0\0\x25\0\0\0\x13\0\0\0\x08\0\0\0\0\0\0\
-\0\x10\0\0\0\0\0\0\0\x59\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x13\
-\x39\0\0\0\0\0\0\x4e\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x84\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x61\x39\0\0\0\0\0\0\
-\xec\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x80\0\0\
-\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\x6f\0\0\0\0\0\0\x90\x07\0\0\
-\0\0\0\0\x25\0\0\0\x16\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\xbf\0\0\0\x01\
-\0\0\0\x30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x4d\x3b\0\0\0\0\0\0\xc7\x04\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\xde\0\0\0\x01\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x14\x40\0\0\0\0\0\0\xc0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xda\0\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\x98\x76\0\0\0\0\0\0\x70\x01\0\0\0\0\0\0\x25\0\0\0\x19\0\0\0\x08\
-\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x7d\x02\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\xd4\x40\0\0\0\0\0\0\x8e\x12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\x79\x02\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\x08\x78\0\0\0\0\0\0\x60\0\0\0\0\0\0\0\x25\0\0\0\x1b\0\0\0\x08\0\0\0\0\0\0\0\
-\x10\0\0\0\0\0\0\0\x1d\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x64\x53\
-\0\0\0\0\0\0\xec\x10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\x19\0\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x68\x78\0\0\0\0\0\0\
-\x60\x10\0\0\0\0\0\0\x25\0\0\0\x1d\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\
-\x47\x02\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x50\x64\0\0\0\0\0\0\xb8\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x43\x02\0\0\
-\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xc8\x88\0\0\0\0\0\0\xe0\0\0\0\0\0\
-\0\0\x25\0\0\0\x1f\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x37\x02\0\0\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\x65\0\0\0\0\0\0\x0a\x05\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x33\x02\0\0\x09\0\0\0\x40\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\xa8\x89\0\0\0\0\0\0\xd0\0\0\0\0\0\0\0\x25\0\0\0\x21\
-\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\xca\0\0\0\x01\0\0\0\x30\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\x12\x6a\0\0\0\0\0\0\x7a\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\
-\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\xc4\x01\0\0\x03\x4c\xff\x6f\0\0\0\x80\0\0\0\0\0\
-\0\0\0\0\0\0\0\x78\x8a\0\0\0\0\0\0\x0c\0\0\0\0\0\0\0\x25\0\0\0\0\0\0\0\x01\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x71\x02\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x90\x6a\0\0\0\0\0\0\xe8\x02\0\0\0\0\0\0\x01\0\0\0\x13\0\0\0\x08\0\0\0\0\0\0\
-\0\x18\0\0\0\0\0\0\0";
-
-	*sz = sizeof(data) - 1;
-	return (const void *)data;
-}
-
-#ifdef __cplusplus
-struct dynlib_monitor_bpf *dynlib_monitor_bpf::open(const struct bpf_object_open_opts *opts) { return dynlib_monitor_bpf__open_opts(opts); }
-struct dynlib_monitor_bpf *dynlib_monitor_bpf::open_and_load() { return dynlib_monitor_bpf__open_and_load(); }
-int dynlib_monitor_bpf::load(struct dynlib_monitor_bpf *skel) { return dynlib_monitor_bpf__load(skel); }
-int dynlib_monitor_bpf::attach(struct dynlib_monitor_bpf *skel) { return dynlib_monitor_bpf__attach(skel); }
-void dynlib_monitor_bpf::detach(struct dynlib_monitor_bpf *skel) { dynlib_monitor_bpf__detach(skel); }
-void dynlib_monitor_bpf::destroy(struct dynlib_monitor_bpf *skel) { dynlib_monitor_bpf__destroy(skel); }
-const void *dynlib_monitor_bpf::elf_bytes(size_t *sz) { return dynlib_monitor_bpf__elf_bytes(sz); }
-#endif /* __cplusplus */
-
-__attribute__((unused)) static void
-dynlib_monitor_bpf__assert(struct dynlib_monitor_bpf *s __attribute__((unused)))
-{
-#ifdef __cplusplus
-#define _Static_assert static_assert
-#endif
-#ifdef __cplusplus
-#undef _Static_assert
-#endif
-}
-
-#endif /* __DYNLIB_MONITOR_BPF_SKEL_H__ */
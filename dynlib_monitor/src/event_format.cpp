@@ -0,0 +1,203 @@
+#include <dlfcn.h>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include "event_format.h"
+
+std::string format_duration(__u64 ns)
+{
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1);
+    if (ns < 1000) {
+        ss << ns << "ns";
+    } else if (ns < 1000000) {
+        ss << ns / 1e3 << "us";
+    } else if (ns < 1000000000) {
+        ss << ns / 1e6 << "ms";
+    } else {
+        ss << ns / 1e9 << "s";
+    }
+    return ss.str();
+}
+
+std::string get_dlopen_flags(int flags)
+{
+    std::vector<std::string> flag_strings;
+    
+    if (flags & RTLD_LAZY) flag_strings.push_back("RTLD_LAZY");
+    if (flags & RTLD_NOW) flag_strings.push_back("RTLD_NOW");
+    if (flags & RTLD_GLOBAL) flag_strings.push_back("RTLD_GLOBAL");
+    if (flags & RTLD_LOCAL) flag_strings.push_back("RTLD_LOCAL");
+    
+    if (flag_strings.empty()) return "0";
+    
+    std::string result = flag_strings[0];
+    for (size_t i = 1; i < flag_strings.size(); i++) {
+        result += " | " + flag_strings[i];
+    }
+    return result;
+}
+
+std::string namespace_name(__s64 lmid)
+{
+    if (lmid == 0) {
+        return "默认（LM_ID_BASE）";
+    }
+    if (lmid == LM_ID_NEWLM_UNKNOWN) {
+        return "新建（编号未知）";
+    }
+    return std::to_string(lmid);
+}
+
+const char *event_path(const struct event *e)
+{
+    return e->path_len ? e->data : "";
+}
+
+const char *event_symbol(const struct event *e)
+{
+    return e->symbol_len ? e->data + e->path_len : "";
+}
+
+__u32 event_libc_id(const struct event *e)
+{
+    return e->libc_id & ~(LIBC_ID_INTERNAL | LIBC_ID_VARIANT);
+}
+
+const char *event_type_name(int event_type)
+{
+    switch (event_type) {
+        case EVENT_DLOPEN: return "dlopen";
+        case EVENT_DLCLOSE: return "dlclose";
+        case EVENT_DLSYM: return "dlsym";
+        case EVENT_CTOR: return "构造函数";
+        case EVENT_DTOR: return "析构函数";
+        default: return "unknown";
+    }
+}
+
+const char *rtld_phase_name(int phase)
+{
+    switch (phase) {
+        case RTLD_PHASE_INIT: return "启动加载依赖";
+        case RTLD_PHASE_MAP: return "映射";
+        case RTLD_PHASE_RELOC: return "重定位";
+        case RTLD_PHASE_UNMAP: return "卸载";
+        default: return "未知";
+    }
+}
+
+const char *rtld_context_name(int context)
+{
+    return context == RTLD_CTX_DLOPEN ? "dlopen" : "进程启动";
+}
+
+const char *init_context_name(int context)
+{
+    switch (context) {
+        case INIT_CTX_STARTUP: return "进程启动";
+        case INIT_CTX_DLOPEN: return "dlopen";
+        case INIT_CTX_DLCLOSE: return "dlclose";
+        case INIT_CTX_EXIT: return "进程退出";
+        default: return "未知";
+    }
+}
+
+const char *init_fini_source_name(int source)
+{
+    switch (source) {
+        case SRC_CALL_INIT: return "call_init";
+        case SRC_DL_INIT: return "_dl_init（含依赖库）";
+        case SRC_CALL_FINI: return "_dl_call_fini";
+        case SRC_CLOSE_WORKER: return "_dl_close_worker（含依赖库及卸载）";
+        case SRC_DL_FINI: return "_dl_fini（全部库）";
+        default: return "未知";
+    }
+}
+
+const char *dl_syscall_name(int cls)
+{
+    switch (cls) {
+        case SC_OPEN: return "open/openat";
+        case SC_READ: return "read/pread64";
+        case SC_MMAP: return "mmap";
+        case SC_MPROTECT: return "mprotect";
+        case SC_MUNMAP: return "munmap";
+        case SC_STAT: return "fstat/newfstatat/statx";
+        case SC_CLOSE: return "close";
+        default: return "其他";
+    }
+}
+
+const char *search_context_name(int context)
+{
+    switch (context) {
+        case SEARCH_CTX_DLOPEN: return "dlopen";
+        case SEARCH_CTX_STARTUP: return "启动加载依赖";
+        default: return "未知";
+    }
+}
+
+const char *dl_api_name(__u32 api)
+{
+    switch (api) {
+        case API_DL_ITERATE_PHDR: return "dl_iterate_phdr";
+        case API_DLADDR: return "dladdr";
+        case API_DLADDR1: return "dladdr1";
+        case API_UNWIND_FIND_FDE: return "_Unwind_Find_FDE";
+        default: return "未知";
+    }
+}
+
+const char *loader_op_name(__u32 op)
+{
+    switch (op) {
+        case OP_DLOPEN: return "dlopen";
+        case OP_DLCLOSE: return "dlclose";
+        case OP_DLSYM: return "dlsym";
+        case OP_ITERATE_PHDR: return "dl_iterate_phdr";
+        default: return "其他";
+    }
+}
+
+const char *offcpu_reason_name(__u32 reason)
+{
+    switch (reason) {
+        case OFFCPU_IO: return "I/O";
+        case OFFCPU_FUTEX: return "futex";
+        case OFFCPU_OTHER: return "其他";
+        case OFFCPU_PREEMPT: return "抢占";
+        default: return "未知";
+    }
+}
+
+std::string internal_dlopen_api(const std::string& library, const std::string& caller)
+{
+    std::string name = library.substr(library.rfind('/') + 1);
+    if (name.compare(0, 7, "libnss_") == 0) {
+        return "NSS（getpwnam、getaddrinfo等）";
+    }
+    if (library.find("/gconv/") != std::string::npos) {
+        return "iconv（gconv模块）";
+    }
+    if (name.compare(0, 7, "libidn2") == 0) {
+        return "getaddrinfo（AI_IDN，libidn2）";
+    }
+    if (name.compare(0, 8, "libgcc_s") == 0) {
+        return "libgcc_s（pthread_cancel、pthread_exit、backtrace等）";
+    }
+
+    if (caller.find("nss") != std::string::npos || caller.find("module_load") != std::string::npos) {
+        return "NSS（getpwnam、getaddrinfo等）";
+    }
+    if (caller.find("gconv") != std::string::npos) {
+        return "iconv（gconv模块）";
+    }
+    if (caller.find("idna") != std::string::npos || caller.find("idn2") != std::string::npos) {
+        return "getaddrinfo（AI_IDN，libidn2）";
+    }
+    if (caller.find("unwind") != std::string::npos || caller.find("libgcc") != std::string::npos) {
+        return "libgcc_s（pthread_cancel、pthread_exit、backtrace等）";
+    }
+    return caller;
+}
@@ -0,0 +1,66 @@
+#ifndef EVENT_FORMAT_H
+#define EVENT_FORMAT_H
+
+/*
+ * 事件解码和输出格式化：不依赖BPF对象和进程状态的纯函数，
+ * 供监控程序输出使用，也便于单独测试
+ */
+
+#include <linux/types.h>
+#include <string>
+#include "dynlib_monitor.h"
+
+// 将纳秒格式化为便于阅读的时间
+std::string format_duration(__u64 ns);
+
+// dlopen标志的文字表示，如“RTLD_NOW | RTLD_GLOBAL”，无标志时为“0”
+std::string get_dlopen_flags(int flags);
+
+// 命名空间的显示名称
+std::string namespace_name(__s64 lmid);
+
+// 事件字符串区中的库路径，未携带时返回空串
+const char *event_path(const struct event *e);
+
+// 事件字符串区中的符号名，位于库路径之后
+const char *event_symbol(const struct event *e);
+
+// 事件来自的C库编号，去掉cookie中的标志位
+__u32 event_libc_id(const struct event *e);
+
+// 操作类型对应的函数名
+const char *event_type_name(int event_type);
+
+// 动态链接器阶段名称
+const char *rtld_phase_name(int phase);
+
+// 加载阶段的触发场景名称
+const char *rtld_context_name(int context);
+
+// 构造/析构函数的执行场景名称
+const char *init_context_name(int context);
+
+// 构造/析构耗时的来源探针名称
+const char *init_fini_source_name(int source);
+
+// 系统调用分类名称
+const char *dl_syscall_name(int cls);
+
+// 库搜索探测的场景名称
+const char *search_context_name(int context);
+
+// 遍历接口名称
+const char *dl_api_name(__u32 api);
+
+// 动态链接操作名称
+const char *loader_op_name(__u32 op);
+
+// off-CPU原因名称
+const char *offcpu_reason_name(__u32 reason);
+
+// 推断触发加载的C库接口：先按库名判断，glibc内部加载的库是固定的几类，
+// 不依赖C库的符号表（NSS在2.33后经module_load加载，已剥离的C库中也只有地址）；
+// 库名无法判断时再按调用方函数名，仍无法判断时返回调用方函数名（可能为空）
+std::string internal_dlopen_api(const std::string& library, const std::string& caller);
+
+#endif // EVENT_FORMAT_H
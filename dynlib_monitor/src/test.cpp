@@ -5,6 +5,7 @@
 #include <chrono>     // 时间相关功能
 #include <thread>     // 线程休眠
 #include <string>     // 字符串操作
+#include <cstring>    // 命令行参数比较
 
 /**
  * @brief 随机休眠函数
@@ -20,6 +21,41 @@ void random_sleep() {
     std::this_thread::sleep_for(std::chrono::milliseconds(dis(gen)));
 }
 
+/**
+ * @brief dlsym压力测试
+ * 
+ * 不间断地重复调用dlsym，用于在高事件速率下对比监控程序的
+ * 吞吐量（事件/秒）和丢失率。
+ * 
+ * @param iterations dlsym调用次数
+ * @return 成功返回0，否则返回1
+ */
+int run_dlsym_benchmark(long iterations) {
+    void* math_handle = dlopen("libm.so.6", RTLD_LAZY);
+    if (!math_handle) {
+        std::cerr << "无法加载 libm.so: " << dlerror() << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; i++) {
+        if (!dlsym(math_handle, "cos")) {
+            std::cerr << "无法获取 cos 函数: " << dlerror() << std::endl;
+            dlclose(math_handle);
+            return 1;
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "dlsym 调用次数: " << iterations << "\n"
+              << "耗时: " << elapsed.count() << " 秒\n"
+              << "速率: " << iterations / elapsed.count() << " 次/秒\n"
+              << "单次耗时: " << elapsed.count() * 1e9 / iterations << " 纳秒" << std::endl;
+
+    dlclose(math_handle);
+    return 0;
+}
+
 /**
  * @brief 主函数
  * 
@@ -30,8 +66,14 @@ void random_sleep() {
  * 3. 显式加载crypt库libcrypt.so
  * 4. 依次解析和测试各个库中的函数
  * 5. 最后卸载所有动态库
+ * 
+ * 使用 --bench [次数] 参数时改为执行dlsym压力测试。
  */
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        return run_dlsym_benchmark(argc > 2 ? std::stol(argv[2]) : 1000000);
+    }
+
     std::cout << "开始测试动态库加载和函数调用..." << std::endl;
     
     // 加载数学库
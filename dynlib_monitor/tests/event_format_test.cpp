@@ -0,0 +1,176 @@
+// 事件解码和格式化函数的单元测试，运行：make test
+#include <dlfcn.h>
+#include <iostream>
+#include <string>
+#include "event_format.h"
+
+static int failures = 0;
+
+#define CHECK_EQ(actual, expected)                                                      \
+    do {                                                                                \
+        std::string a_ = (actual), e_ = (expected);                                     \
+        if (a_ != e_) {                                                                 \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " << #actual << "\n"         \
+                      << "  实际: \"" << a_ << "\"\n  期望: \"" << e_ << "\"\n";        \
+            failures++;                                                                 \
+        }                                                                               \
+    } while (0)
+
+// 构造带变长字符串区的事件：库路径之后紧跟符号名
+struct event_buffer {
+    alignas(struct event) char bytes[sizeof(struct event) + 256] = {};
+
+    event_buffer(const std::string& path, const std::string& symbol)
+    {
+        struct event *e = get();
+        if (!path.empty()) {
+            e->path_len = path.size() + 1;
+            path.copy(e->data, path.size());
+        }
+        if (!symbol.empty()) {
+            e->symbol_len = symbol.size() + 1;
+            symbol.copy(e->data + e->path_len, symbol.size());
+        }
+    }
+
+    struct event *get() { return reinterpret_cast<struct event *>(bytes); }
+};
+
+static void test_dlopen_flags()
+{
+    CHECK_EQ(get_dlopen_flags(0), "0");
+    CHECK_EQ(get_dlopen_flags(RTLD_LAZY), "RTLD_LAZY");
+    CHECK_EQ(get_dlopen_flags(RTLD_NOW | RTLD_GLOBAL), "RTLD_NOW | RTLD_GLOBAL");
+}
+
+static void test_event_strings()
+{
+    event_buffer both("/usr/lib/libfoo.so.1", "libfoo.so.1");
+    CHECK_EQ(event_path(both.get()), "/usr/lib/libfoo.so.1");
+    CHECK_EQ(event_symbol(both.get()), "libfoo.so.1");
+
+    // dlsym事件可能只携带符号名，符号名从字符串区开头开始
+    event_buffer symbol_only("", "malloc");
+    CHECK_EQ(event_path(symbol_only.get()), "");
+    CHECK_EQ(event_symbol(symbol_only.get()), "malloc");
+
+    event_buffer empty("", "");
+    CHECK_EQ(event_path(empty.get()), "");
+    CHECK_EQ(event_symbol(empty.get()), "");
+}
+
+static void test_format_duration()
+{
+    CHECK_EQ(format_duration(999), "999ns");
+    CHECK_EQ(format_duration(1500), "1.5us");
+    CHECK_EQ(format_duration(2500000), "2.5ms");
+    CHECK_EQ(format_duration(3000000000ULL), "3.0s");
+    CHECK_EQ(event_type_name(EVENT_DLSYM), "dlsym");
+    CHECK_EQ(event_type_name(-1), "unknown");
+}
+
+static void test_rtld_names()
+{
+    CHECK_EQ(rtld_phase_name(RTLD_PHASE_RELOC), "重定位");
+    CHECK_EQ(rtld_phase_name(RTLD_PHASE_MAX), "未知");
+    CHECK_EQ(rtld_context_name(RTLD_CTX_DLOPEN), "dlopen");
+    CHECK_EQ(rtld_context_name(RTLD_CTX_STARTUP), "进程启动");
+}
+
+static void test_init_fini_names()
+{
+    CHECK_EQ(init_context_name(INIT_CTX_DLCLOSE), "dlclose");
+    CHECK_EQ(init_context_name(INIT_CTX_EXIT), "进程退出");
+    CHECK_EQ(init_fini_source_name(SRC_DL_FINI), "_dl_fini（全部库）");
+    CHECK_EQ(init_fini_source_name(-1), "未知");
+}
+
+static void test_loader_op_name()
+{
+    CHECK_EQ(loader_op_name(OP_DLOPEN), "dlopen");
+    CHECK_EQ(loader_op_name(OP_ITERATE_PHDR), "dl_iterate_phdr");
+    CHECK_EQ(loader_op_name(0xff), "其他");
+}
+
+static void test_dl_api_name()
+{
+    CHECK_EQ(dl_api_name(API_DL_ITERATE_PHDR), "dl_iterate_phdr");
+    CHECK_EQ(dl_api_name(API_DLADDR1), "dladdr1");
+    CHECK_EQ(dl_api_name(API_UNWIND_FIND_FDE), "_Unwind_Find_FDE");
+}
+
+static void test_internal_dlopen_api()
+{
+    // 按库名判断，不需要调用方符号
+    CHECK_EQ(internal_dlopen_api("libnss_files.so.2", ""), "NSS（getpwnam、getaddrinfo等）");
+    CHECK_EQ(internal_dlopen_api("/usr/lib/x86_64-linux-gnu/gconv/UTF-16.so", ""), "iconv（gconv模块）");
+    CHECK_EQ(internal_dlopen_api("libidn2.so.0", ""), "getaddrinfo（AI_IDN，libidn2）");
+    CHECK_EQ(internal_dlopen_api("libgcc_s.so.1", "__libc_unwind_link_get+0x4d"),
+             "libgcc_s（pthread_cancel、pthread_exit、backtrace等）");
+    // 只看文件名，目录名中的libnss_不算
+    CHECK_EQ(internal_dlopen_api("/opt/libnss_extra/libbar.so", ""), "");
+
+    // 库名无法判断时按调用方函数名
+    CHECK_EQ(internal_dlopen_api("libbar.so", "module_load+0x42"), "NSS（getpwnam、getaddrinfo等）");
+    CHECK_EQ(internal_dlopen_api("libbar.so", "__gconv_find_shlib+0x10"), "iconv（gconv模块）");
+    CHECK_EQ(internal_dlopen_api("libbar.so", "foo+0x1"), "foo+0x1");
+    CHECK_EQ(internal_dlopen_api("", ""), "");
+}
+
+static void test_namespaces()
+{
+    CHECK_EQ(namespace_name(0), "默认（LM_ID_BASE）");
+    CHECK_EQ(namespace_name(LM_ID_NEWLM_UNKNOWN), "新建（编号未知）");
+    CHECK_EQ(namespace_name(3), "3");
+
+    // 附加cookie中的接口标志不影响C库编号
+    event_buffer buf("", "");
+    buf.get()->libc_id = 2 | LIBC_ID_INTERNAL;
+    CHECK_EQ(std::to_string(event_libc_id(buf.get())), "2");
+    buf.get()->libc_id = 1 | LIBC_ID_VARIANT;
+    CHECK_EQ(std::to_string(event_libc_id(buf.get())), "1");
+}
+
+static void test_dl_syscall_name()
+{
+    CHECK_EQ(dl_syscall_name(SC_OPEN), "open/openat");
+    CHECK_EQ(dl_syscall_name(SC_MMAP), "mmap");
+    CHECK_EQ(dl_syscall_name(SC_MAX), "其他");
+}
+
+static void test_search_context_name()
+{
+    CHECK_EQ(search_context_name(SEARCH_CTX_DLOPEN), "dlopen");
+    CHECK_EQ(search_context_name(SEARCH_CTX_STARTUP), "启动加载依赖");
+    CHECK_EQ(search_context_name(-1), "未知");
+}
+
+static void test_offcpu_reason_name()
+{
+    CHECK_EQ(offcpu_reason_name(OFFCPU_IO), "I/O");
+    CHECK_EQ(offcpu_reason_name(OFFCPU_FUTEX), "futex");
+    CHECK_EQ(offcpu_reason_name(OFFCPU_MAX), "未知");
+}
+
+int main()
+{
+    test_dlopen_flags();
+    test_event_strings();
+    test_format_duration();
+    test_rtld_names();
+    test_init_fini_names();
+    test_loader_op_name();
+    test_dl_api_name();
+    test_internal_dlopen_api();
+    test_namespaces();
+    test_dl_syscall_name();
+    test_search_context_name();
+    test_offcpu_reason_name();
+
+    if (failures) {
+        std::cerr << failures << " 项检查失败\n";
+        return 1;
+    }
+    std::cout << "全部检查通过\n";
+    return 0;
+}